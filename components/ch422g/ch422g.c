@@ -8,6 +8,7 @@
 #include "esp_log.h"
 #include "esp_check.h"
 #include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "i2c_bus.h"
 
 #define CH422_I2C_FREQ_HZ         (100000)
@@ -34,6 +35,10 @@ typedef struct {
 
 static ch422g_ctx_t s_ctx = {0};
 
+/* Serialises shadow updates: boot stages drive different EXIO pins concurrently.
+ * Kept outside s_ctx so it survives deinit/init cycles. */
+static SemaphoreHandle_t s_lock;
+
 static void ch422g_cleanup_devices(void)
 {
     if (s_ctx.dev_wr_set) {
@@ -94,6 +99,11 @@ esp_err_t ch422g_init(void)
         return ESP_OK;
     }
 
+    if (!s_lock) {
+        s_lock = xSemaphoreCreateMutex();
+        ESP_RETURN_ON_FALSE(s_lock, ESP_ERR_NO_MEM, TAG, "no memory for lock");
+    }
+
     s_ctx.bus = i2c_bus_get();
     ESP_RETURN_ON_FALSE(s_ctx.bus, ESP_ERR_INVALID_STATE, TAG, "I2C bus not initialised");
 
@@ -133,8 +143,16 @@ esp_err_t ch422g_init(void)
 
 esp_err_t ch422g_set_pin(ch422g_pin_t exio, bool level)
 {
-    ESP_RETURN_ON_FALSE(s_ctx.initialized, ESP_ERR_INVALID_STATE, TAG, "driver not initialised");
     ESP_RETURN_ON_FALSE(exio < 8, ESP_ERR_INVALID_ARG, TAG, "invalid EXIO index");
+    ESP_RETURN_ON_FALSE(s_lock, ESP_ERR_INVALID_STATE, TAG, "driver not initialised");
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    esp_err_t err = ESP_OK;
+    if (!s_ctx.initialized) {
+        ESP_LOGE(TAG, "driver not initialised");
+        err = ESP_ERR_INVALID_STATE;
+        goto out;
+    }
 
     uint8_t mask = (uint8_t)(1u << exio);
     uint8_t new_state = s_ctx.wr_io_shadow;
@@ -144,35 +162,54 @@ esp_err_t ch422g_set_pin(ch422g_pin_t exio, bool level)
         new_state &= (uint8_t)~mask;
     }
 
-    if (new_state == s_ctx.wr_io_shadow) {
-        return ESP_OK;
+    if (new_state != s_ctx.wr_io_shadow) {
+        s_ctx.wr_io_shadow = new_state;
+        err = ch422g_write_state();
     }
 
-    s_ctx.wr_io_shadow = new_state;
-    return ch422g_write_state();
+out:
+    xSemaphoreGive(s_lock);
+    return err;
 }
 
 bool ch422g_get_pin(ch422g_pin_t exio)
 {
-    if (!s_ctx.initialized || exio >= 8) {
+    if (!s_lock || exio >= 8) {
         return false;
     }
 
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    bool level = false;
+    if (!s_ctx.initialized) {
+        goto out;
+    }
+
     if (s_ctx.dev_rd_io) {
         uint8_t data = 0;
         esp_err_t err = i2c_master_receive(s_ctx.dev_rd_io, &data, sizeof(data), CH422_I2C_TIMEOUT_TICKS);
         if (err == ESP_OK) {
-            return ((data >> exio) & 0x01u) != 0;
+            level = ((data >> exio) & 0x01u) != 0;
+            goto out;
         }
         ESP_LOGW(TAG, "RD_IO read failed (%s), falling back to shadow", esp_err_to_name(err));
     }
 
-    return ((s_ctx.wr_io_shadow >> exio) & 0x01u) != 0;
+    level = ((s_ctx.wr_io_shadow >> exio) & 0x01u) != 0;
+
+out:
+    xSemaphoreGive(s_lock);
+    return level;
 }
 
 void ch422g_deinit(void)
 {
+    if (s_lock) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+    }
     ch422g_cleanup_devices();
     s_ctx = (ch422g_ctx_t){0};
+    if (s_lock) {
+        xSemaphoreGive(s_lock);
+    }
 }
 
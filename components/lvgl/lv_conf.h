@@ -14,6 +14,14 @@
 #define LV_MEM_AUTO_DEFRAG 1
 #define LV_MEMCPY_MEMSET_STD 0
 
+// Système d'exploitation : rendu logiciel réparti sur les deux cœurs
+#define LV_USE_OS LV_OS_FREERTOS
+#define LV_DRAW_SW_DRAW_UNIT_CNT 2
+
+// Noyaux RGB565 (remplissage, mélange, copie) de components/rgb565_simd
+#define LV_USE_DRAW_SW_ASM LV_DRAW_SW_ASM_CUSTOM
+#define LV_DRAW_SW_ASM_CUSTOM_INCLUDE "lv_blend_rgb565_simd.h"
+
 // Support HAL
 #define LV_DISP_DEF_REFR_PERIOD 16
 #define LV_INDEV_DEF_READ_PERIOD 16
@@ -24,6 +32,7 @@
 #define LV_USE_PERF_MONITOR 0
 #define LV_USE_MEM_MONITOR 0
 #define LV_USE_REFR_DEBUG 0
+#define LV_USE_SNAPSHOT 1
 
 // Widgets activés
 #define LV_USE_ARC 1
@@ -0,0 +1,33 @@
+#pragma once
+
+/*
+ * LVGL software-renderer hooks (LV_USE_DRAW_SW_ASM = LV_DRAW_SW_ASM_CUSTOM).
+ *
+ * Included by LVGL's lv_draw_sw_blend_to_*.c through
+ * LV_DRAW_SW_ASM_CUSTOM_INCLUDE. Each hook returns LV_RESULT_OK when it
+ * handled the blend, LV_RESULT_INVALID to fall back to LVGL's C loop.
+ * Only the opaque fill and copy to RGB565 are overridden: opacity and mask
+ * blends have no PIE version and keep LVGL's C loops.
+ */
+
+#include "rgb565_simd.h"
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) \
+    lv_blend_rgb565_simd_fill(dsc)
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc) \
+    lv_blend_rgb565_simd_copy(dsc)
+
+static inline lv_result_t lv_blend_rgb565_simd_fill(lv_draw_sw_blend_fill_dsc_t *dsc)
+{
+    rgb565_fill(dsc->dest_buf, dsc->dest_w, dsc->dest_h,
+                dsc->dest_stride / (int32_t)sizeof(uint16_t), lv_color_to_u16(dsc->color));
+    return LV_RESULT_OK;
+}
+
+static inline lv_result_t lv_blend_rgb565_simd_copy(lv_draw_sw_blend_image_dsc_t *dsc)
+{
+    rgb565_copy(dsc->dest_buf, dsc->dest_stride / (int32_t)sizeof(uint16_t),
+                dsc->src_buf, dsc->src_stride / (int32_t)sizeof(uint16_t),
+                dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * RGB565 pixel kernels used by the LVGL software renderer.
+ *
+ * Every kernel has a portable scalar reference (*_ref) that reproduces
+ * LVGL's own C loops bit for bit, and an optimized version that must give
+ * the same output. Strides are in pixels. Only the memory-bound fill and
+ * copy have a PIE version; blends are left to LVGL.
+ */
+
+/** @brief Solid fill */
+void rgb565_fill(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride, uint16_t color);
+/** @brief Opaque RGB565 image copy */
+void rgb565_copy(uint16_t *dst, int32_t dst_stride, const uint16_t *src, int32_t src_stride,
+                 int32_t w, int32_t h);
+
+void rgb565_fill_ref(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride, uint16_t color);
+void rgb565_copy_ref(uint16_t *dst, int32_t dst_stride, const uint16_t *src, int32_t src_stride,
+                     int32_t w, int32_t h);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,89 @@
+/*
+ * Optimized RGB565 kernels.
+ *
+ * Solid fills and opaque copies are memory bound: rows are split into an
+ * unaligned head, a run of 16-byte blocks written with the ESP32-S3 PIE
+ * 128-bit load/store instructions (rgb565_simd_esp32s3.S), and a tail.
+ * Opacity and mask blends have no PIE version and stay with LVGL's C loops.
+ */
+#include <string.h>
+#include "rgb565_simd.h"
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+/* Narrow rows are not worth the alignment prologue */
+#define RGB565_SIMD_MIN_PX 16
+
+#if CONFIG_IDF_TARGET_ESP32S3
+void rgb565_simd_fill_blocks_s3(uint16_t *dst, uint32_t blocks, const uint32_t *color2);
+void rgb565_simd_copy_blocks_s3(uint16_t *dst, const uint16_t *src, uint32_t blocks);
+#define fill_blocks rgb565_simd_fill_blocks_s3
+#define copy_blocks rgb565_simd_copy_blocks_s3
+#else
+static void fill_blocks(uint16_t *dst, uint32_t blocks, const uint32_t *color2)
+{
+    uint32_t pattern[4] = {*color2, *color2, *color2, *color2};
+    for (uint32_t b = 0; b < blocks; b++) {
+        memcpy(dst, pattern, sizeof(pattern));
+        dst += 8;
+    }
+}
+
+static void copy_blocks(uint16_t *dst, const uint16_t *src, uint32_t blocks)
+{
+    memcpy(dst, src, (size_t)blocks * 16);
+}
+#endif
+
+static void fill_row(uint16_t *dst, int32_t w, uint16_t color, const uint32_t *color2)
+{
+    if (w >= RGB565_SIMD_MIN_PX) {
+        while ((uintptr_t)dst & 15) {
+            *dst++ = color;
+            w--;
+        }
+        uint32_t blocks = (uint32_t)w >> 3;
+        fill_blocks(dst, blocks, color2);
+        dst += blocks * 8;
+        w -= (int32_t)blocks * 8;
+    }
+    while (w-- > 0) {
+        *dst++ = color;
+    }
+}
+
+void rgb565_fill(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride, uint16_t color)
+{
+    const uint32_t color2 = color | ((uint32_t)color << 16);
+    for (int32_t y = 0; y < h; y++) {
+        fill_row(dst, w, color, &color2);
+        dst += dst_stride;
+    }
+}
+
+void rgb565_copy(uint16_t *dst, int32_t dst_stride, const uint16_t *src, int32_t src_stride,
+                 int32_t w, int32_t h)
+{
+    for (int32_t y = 0; y < h; y++) {
+        uint16_t *d = dst;
+        const uint16_t *s = src;
+        int32_t n = w;
+        /* The block path needs source and destination on the same 16-byte phase */
+        if (n >= RGB565_SIMD_MIN_PX && (((uintptr_t)d ^ (uintptr_t)s) & 15) == 0) {
+            while ((uintptr_t)d & 15) {
+                *d++ = *s++;
+                n--;
+            }
+            uint32_t blocks = (uint32_t)n >> 3;
+            copy_blocks(d, s, blocks);
+            d += blocks * 8;
+            s += blocks * 8;
+            n -= (int32_t)blocks * 8;
+        }
+        memcpy(d, s, (size_t)n * sizeof(uint16_t));
+        dst += dst_stride;
+        src += src_stride;
+    }
+}
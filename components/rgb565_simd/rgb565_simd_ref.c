@@ -0,0 +1,27 @@
+/*
+ * Scalar reference kernels: straight per-pixel loops, as in LVGL's
+ * lv_draw_sw_blend_to_rgb565.c.
+ */
+#include "rgb565_simd.h"
+
+void rgb565_fill_ref(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride, uint16_t color)
+{
+    for (int32_t y = 0; y < h; y++) {
+        for (int32_t x = 0; x < w; x++) {
+            dst[x] = color;
+        }
+        dst += dst_stride;
+    }
+}
+
+void rgb565_copy_ref(uint16_t *dst, int32_t dst_stride, const uint16_t *src, int32_t src_stride,
+                     int32_t w, int32_t h)
+{
+    for (int32_t y = 0; y < h; y++) {
+        for (int32_t x = 0; x < w; x++) {
+            dst[x] = src[x];
+        }
+        dst += dst_stride;
+        src += src_stride;
+    }
+}
@@ -0,0 +1,32 @@
+#include "st7701_cmd_stream.h"
+
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "st7701_stream";
+
+esp_err_t st7701_cmd_stream_run(esp_lcd_panel_io_handle_t io, const st7701_cmd_t *cmds, size_t count)
+{
+    if (!io || !cmds || !count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (cmds[i].data_bytes && !cmds[i].data) {
+            ESP_LOGE(TAG, "cmd 0x%02X: %u bytes without data", cmds[i].cmd, cmds[i].data_bytes);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        esp_err_t ret = esp_lcd_panel_io_tx_param(io, cmds[i].cmd, cmds[i].data, cmds[i].data_bytes);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to send cmd 0x%02X: %s", cmds[i].cmd, esp_err_to_name(ret));
+            return ret;
+        }
+        if (cmds[i].delay_ms) {
+            vTaskDelay(pdMS_TO_TICKS(cmds[i].delay_ms));
+        }
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief One controller command: parameter bytes, then an optional delay
+ */
+typedef struct {
+    uint8_t cmd;
+    const uint8_t *data;
+    uint8_t data_bytes;
+    uint16_t delay_ms;
+} st7701_cmd_t;
+
+/**
+ * @brief Command table entry whose parameter count is checked at compile time
+ *
+ * The build fails with a negative array size when the parameter list does
+ * not hold exactly @p len bytes.
+ */
+#define ST7701_CMD(c, len, delay, ...)                                                     \
+    {                                                                                      \
+        .cmd = (c),                                                                        \
+        .data = (const uint8_t[]){__VA_ARGS__},                                            \
+        .data_bytes = (len) + 0 * sizeof(char[(sizeof((const uint8_t[]){__VA_ARGS__}) ==   \
+                                               (len)) ? 1 : -1]),                          \
+        .delay_ms = (delay),                                                               \
+    }
+
+/** Command table entry without parameters */
+#define ST7701_CMD_NO_DATA(c, delay) {.cmd = (c), .data = NULL, .data_bytes = 0, .delay_ms = (delay)}
+
+/**
+ * @brief Send a command table
+ *
+ * One blocking esp_lcd_panel_io_tx_param() per entry, followed by its
+ * delay. Stops at the first error.
+ *
+ * @param io Panel IO
+ * @param cmds Command table
+ * @param count Number of commands
+ * @return esp_err_t First transmission error
+ */
+esp_err_t st7701_cmd_stream_run(esp_lcd_panel_io_handle_t io, const st7701_cmd_t *cmds, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,52 @@
+#pragma once
+
+/*
+ * ST7701 power-on command table for the Waveshare ESP32-S3 Touch LCD 7B.
+ * Shared with the host test of st7701_cmd_stream_run().
+ */
+
+#include "esp_lcd_panel_commands.h"
+#include "st7701_cmd_stream.h"
+
+static const st7701_cmd_t st7701_init_cmds[] = {
+    ST7701_CMD_NO_DATA(LCD_CMD_SWRESET, 120),
+    ST7701_CMD(0xFF, 5, 0, 0x77, 0x01, 0x00, 0x00, 0x13),
+    ST7701_CMD(0xEF, 1, 0, 0x08),
+    ST7701_CMD(0xFF, 5, 0, 0x77, 0x01, 0x00, 0x00, 0x10),
+    ST7701_CMD(0xC0, 2, 0, 0x3B, 0x00),
+    ST7701_CMD(0xC1, 2, 0, 0x10, 0x02),
+    ST7701_CMD(0xC2, 2, 0, 0x20, 0x06),
+    ST7701_CMD(0xCC, 1, 0, 0x10),
+    ST7701_CMD(0xB0, 16, 0, 0x00, 0x13, 0x5A, 0x0F, 0x12, 0x07, 0x09, 0x08, 0x08, 0x24, 0x07, 0x13, 0x12, 0x6B, 0x73, 0xFF),
+    ST7701_CMD(0xB1, 16, 0, 0x00, 0x13, 0x5A, 0x0F, 0x12, 0x07, 0x09, 0x08, 0x08, 0x24, 0x07, 0x13, 0x12, 0x6B, 0x73, 0xFF),
+    ST7701_CMD(0xFF, 5, 0, 0x77, 0x01, 0x00, 0x00, 0x11),
+    ST7701_CMD(0xB0, 1, 0, 0x8D),
+    ST7701_CMD(0xB1, 1, 0, 0x48),
+    ST7701_CMD(0xB2, 1, 0, 0x89),
+    ST7701_CMD(0xB3, 1, 0, 0x80),
+    ST7701_CMD(0xB5, 1, 0, 0x49),
+    ST7701_CMD(0xB7, 1, 0, 0x85),
+    ST7701_CMD(0xB8, 1, 0, 0x32),
+    ST7701_CMD(0xC1, 1, 0, 0x78),
+    ST7701_CMD(0xC2, 1, 0, 0x78),
+    ST7701_CMD(0xD0, 1, 100, 0x88),
+    ST7701_CMD(0xE0, 3, 0, 0x00, 0x00, 0x02),
+    ST7701_CMD(0xE1, 11, 0, 0x05, 0xC0, 0x07, 0xC0, 0x04, 0xC0, 0x06, 0xC0, 0x00, 0x44, 0x44),
+    ST7701_CMD(0xE2, 13, 0, 0x00, 0x00, 0x33, 0x33, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00),
+    ST7701_CMD(0xE3, 4, 0, 0x00, 0x00, 0x11, 0x11),
+    ST7701_CMD(0xE4, 2, 0, 0x44, 0x44),
+    ST7701_CMD(0xE5, 16, 0, 0x0D, 0xF1, 0x10, 0x98, 0x0F, 0xF3, 0x10, 0x98, 0x09, 0xED, 0x10, 0x98, 0x0B, 0xEF, 0x10, 0x98),
+    ST7701_CMD(0xE6, 4, 0, 0x00, 0x00, 0x11, 0x11),
+    ST7701_CMD(0xE7, 2, 0, 0x44, 0x44),
+    ST7701_CMD(0xE8, 16, 0, 0x0C, 0xF0, 0x10, 0x98, 0x0E, 0xF2, 0x10, 0x98, 0x08, 0xEC, 0x10, 0x98, 0x0A, 0xEE, 0x10, 0x98),
+    ST7701_CMD(0xEB, 7, 0, 0x00, 0x01, 0xE4, 0xE4, 0x44, 0x88, 0x00),
+    ST7701_CMD(0xED, 16, 0, 0xFF, 0x04, 0x56, 0x7F, 0xBA, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xAB, 0xF7, 0x65, 0x40, 0xFF),
+    ST7701_CMD(0xEF, 6, 0, 0x10, 0x0D, 0x04, 0x08, 0x3F, 0x1F),
+    ST7701_CMD(0x36, 1, 0, 0x00),
+    ST7701_CMD(0x3A, 1, 0, 0x55),
+    ST7701_CMD(0xFF, 5, 0, 0x77, 0x01, 0x00, 0x00, 0x00),
+    ST7701_CMD_NO_DATA(LCD_CMD_SLPOUT, 120),
+    ST7701_CMD_NO_DATA(LCD_CMD_DISPON, 20),
+};
+
+#define ST7701_INIT_CMD_COUNT (sizeof(st7701_init_cmds) / sizeof(st7701_init_cmds[0]))
@@ -14,6 +14,7 @@
 #include "esp_lcd_types.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "st7701_init_cmds.h"
 
 #define LCD_CMD_SPI_HOST   SPI3_HOST
 #define LCD_CMD_MOSI_GPIO  11
@@ -25,7 +26,7 @@
 #define LCD_PARAM_BITS      8
 #define LCD_CMD_SPI_CLOCK_HZ (10 * 1000 * 1000)
 
-#define LCD_PIXEL_CLOCK_HZ  (30 * 1000 * 1000)
+#define LCD_PIXEL_CLOCK_HZ  ST7701_RGB_PCLK_HZ_DEFAULT
 
 #define LCD_DE_GPIO         5
 #define LCD_PCLK_GPIO       7
@@ -35,23 +36,19 @@
 #define LCD_DATA_WIDTH     16
 #define LCD_BITS_PER_PIXEL 16
 
-#define LCD_H_RES         1024
-#define LCD_V_RES          600
+#define LCD_H_RES         ST7701_RGB_H_RES
+#define LCD_V_RES         ST7701_RGB_V_RES
 
-static const char *TAG = "st7701_rgb";
+#define LCD_MAX_FBS          2
 
-typedef struct {
-    uint8_t cmd;
-    const uint8_t *data;
-    uint8_t data_bytes;
-    uint16_t delay_ms;
-} st7701_init_cmd_t;
+static const char *TAG = "st7701_rgb";
 
 typedef struct {
     void *base_user_data;
     esp_lcd_panel_io_handle_t io;
     spi_host_device_t host_id;
     bool free_bus_on_del;
+    bool started;
     esp_err_t (*orig_del)(esp_lcd_panel_t *panel);
     esp_err_t (*orig_disp_on_off)(esp_lcd_panel_t *panel, bool on_off);
     esp_err_t (*orig_disp_sleep)(esp_lcd_panel_t *panel, bool enter_sleep);
@@ -80,12 +77,12 @@ static const esp_lcd_rgb_timing_t st7701_rgb_timing = {
     .pclk_hz = LCD_PIXEL_CLOCK_HZ,
     .h_res = LCD_H_RES,
     .v_res = LCD_V_RES,
-    .hsync_pulse_width = 10,
-    .hsync_back_porch = 160,
-    .hsync_front_porch = 160,
-    .vsync_pulse_width = 1,
-    .vsync_back_porch = 23,
-    .vsync_front_porch = 12,
+    .hsync_pulse_width = ST7701_RGB_HSYNC_PULSE_WIDTH,
+    .hsync_back_porch = ST7701_RGB_HSYNC_BACK_PORCH,
+    .hsync_front_porch = ST7701_RGB_HSYNC_FRONT_PORCH,
+    .vsync_pulse_width = ST7701_RGB_VSYNC_PULSE_WIDTH,
+    .vsync_back_porch = ST7701_RGB_VSYNC_BACK_PORCH,
+    .vsync_front_porch = ST7701_RGB_VSYNC_FRONT_PORCH,
     .flags = {
         .hsync_idle_low = true,
         .vsync_idle_low = true,
@@ -95,47 +92,6 @@ static const esp_lcd_rgb_timing_t st7701_rgb_timing = {
     },
 };
 
-static const st7701_init_cmd_t st7701_init_cmds[] = {
-    {LCD_CMD_SWRESET, NULL, 0, 120},
-    {0xFF, (uint8_t[]){0x77, 0x01, 0x00, 0x00, 0x13}, 5, 0},
-    {0xEF, (uint8_t[]){0x08}, 1, 0},
-    {0xFF, (uint8_t[]){0x77, 0x01, 0x00, 0x00, 0x10}, 5, 0},
-    {0xC0, (uint8_t[]){0x3B, 0x00}, 2, 0},
-    {0xC1, (uint8_t[]){0x10, 0x02}, 2, 0},
-    {0xC2, (uint8_t[]){0x20, 0x06}, 2, 0},
-    {0xCC, (uint8_t[]){0x10}, 1, 0},
-    {0xB0, (uint8_t[]){0x00, 0x13, 0x5A, 0x0F, 0x12, 0x07, 0x09, 0x08, 0x08, 0x24, 0x07, 0x13, 0x12, 0x6B, 0x73, 0xFF}, 16, 0},
-    {0xB1, (uint8_t[]){0x00, 0x13, 0x5A, 0x0F, 0x12, 0x07, 0x09, 0x08, 0x08, 0x24, 0x07, 0x13, 0x12, 0x6B, 0x73, 0xFF}, 16, 0},
-    {0xFF, (uint8_t[]){0x77, 0x01, 0x00, 0x00, 0x11}, 5, 0},
-    {0xB0, (uint8_t[]){0x8D}, 1, 0},
-    {0xB1, (uint8_t[]){0x48}, 1, 0},
-    {0xB2, (uint8_t[]){0x89}, 1, 0},
-    {0xB3, (uint8_t[]){0x80}, 1, 0},
-    {0xB5, (uint8_t[]){0x49}, 1, 0},
-    {0xB7, (uint8_t[]){0x85}, 1, 0},
-    {0xB8, (uint8_t[]){0x32}, 1, 0},
-    {0xC1, (uint8_t[]){0x78}, 1, 0},
-    {0xC2, (uint8_t[]){0x78}, 1, 0},
-    {0xD0, (uint8_t[]){0x88}, 1, 100},
-    {0xE0, (uint8_t[]){0x00, 0x00, 0x02}, 3, 0},
-    {0xE1, (uint8_t[]){0x05, 0xC0, 0x07, 0xC0, 0x04, 0xC0, 0x06, 0xC0, 0x00, 0x44, 0x44}, 11, 0},
-    {0xE2, (uint8_t[]){0x00, 0x00, 0x33, 0x33, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00}, 13, 0},
-    {0xE3, (uint8_t[]){0x00, 0x00, 0x11, 0x11}, 4, 0},
-    {0xE4, (uint8_t[]){0x44, 0x44}, 2, 0},
-    {0xE5, (uint8_t[]){0x0D, 0xF1, 0x10, 0x98, 0x0F, 0xF3, 0x10, 0x98, 0x09, 0xED, 0x10, 0x98, 0x0B, 0xEF, 0x10, 0x98}, 16, 0},
-    {0xE6, (uint8_t[]){0x00, 0x00, 0x11, 0x11}, 4, 0},
-    {0xE7, (uint8_t[]){0x44, 0x44}, 2, 0},
-    {0xE8, (uint8_t[]){0x0C, 0xF0, 0x10, 0x98, 0x0E, 0xF2, 0x10, 0x98, 0x08, 0xEC, 0x10, 0x98, 0x0A, 0xEE, 0x10, 0x98}, 16, 0},
-    {0xEB, (uint8_t[]){0x00, 0x01, 0xE4, 0xE4, 0x44, 0x88, 0x00}, 7, 0},
-    {0xED, (uint8_t[]){0xFF, 0x04, 0x56, 0x7F, 0xBA, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xAB, 0xF7, 0x65, 0x40, 0xFF}, 16, 0},
-    {0xEF, (uint8_t[]){0x10, 0x0D, 0x04, 0x08, 0x3F, 0x1F}, 6, 0},
-    {0x36, (uint8_t[]){0x00}, 1, 0},
-    {0x3A, (uint8_t[]){0x55}, 1, 0},
-    {0xFF, (uint8_t[]){0x77, 0x01, 0x00, 0x00, 0x00}, 5, 0},
-    {LCD_CMD_SLPOUT, NULL, 0, 120},
-    {LCD_CMD_DISPON, NULL, 0, 20},
-};
-
 static inline st7701_rgb_panel_ctx_t *get_ctx(esp_lcd_panel_t *panel)
 {
     return (st7701_rgb_panel_ctx_t *)panel->user_data;
@@ -154,20 +110,7 @@ static void adopt_user_data(esp_lcd_panel_t *panel, st7701_rgb_panel_ctx_t *ctx)
 static esp_err_t st7701_panel_send_init_sequence(esp_lcd_panel_io_handle_t io)
 {
     ESP_RETURN_ON_FALSE(io, ESP_ERR_INVALID_ARG, TAG, "invalid io handle");
-
-    for (size_t i = 0; i < sizeof(st7701_init_cmds) / sizeof(st7701_init_cmd_t); ++i) {
-        const st7701_init_cmd_t *cmd = &st7701_init_cmds[i];
-        const uint8_t *data = cmd->data;
-        esp_err_t ret = esp_lcd_panel_io_tx_param(io, cmd->cmd, data, cmd->data_bytes);
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to send cmd 0x%02X: %s", cmd->cmd, esp_err_to_name(ret));
-            return ret;
-        }
-        if (cmd->delay_ms) {
-            vTaskDelay(pdMS_TO_TICKS(cmd->delay_ms));
-        }
-    }
-    return ESP_OK;
+    return st7701_cmd_stream_run(io, st7701_init_cmds, ST7701_INIT_CMD_COUNT);
 }
 
 static esp_err_t st7701_panel_check_id(esp_lcd_panel_io_handle_t io)
@@ -270,7 +213,21 @@ static esp_err_t st7701_panel_del(esp_lcd_panel_t *panel)
 
 esp_err_t st7701_rgb_new_panel(esp_lcd_panel_handle_t *ret_panel)
 {
-    ESP_RETURN_ON_FALSE(ret_panel, ESP_ERR_INVALID_ARG, TAG, "ret_panel is null");
+    const st7701_rgb_config_t config = ST7701_RGB_DEFAULT_CONFIG();
+    return st7701_rgb_new_panel_with_config(&config, ret_panel);
+}
+
+esp_err_t st7701_rgb_new_panel_with_config(const st7701_rgb_config_t *config,
+                                           esp_lcd_panel_handle_t *ret_panel)
+{
+    ESP_RETURN_ON_FALSE(config && ret_panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(config->num_fbs >= 1 && config->num_fbs <= LCD_MAX_FBS,
+                        ESP_ERR_INVALID_ARG, TAG, "num_fbs must be 1 or 2");
+    ESP_RETURN_ON_FALSE(config->bounce_buffer_size_px % LCD_H_RES == 0 &&
+                        (config->bounce_buffer_size_px == 0 ||
+                         (LCD_H_RES * LCD_V_RES) % config->bounce_buffer_size_px == 0),
+                        ESP_ERR_INVALID_ARG, TAG,
+                        "bounce buffer must be whole lines dividing the frame");
 
     esp_err_t ret = ESP_OK;
     esp_lcd_panel_io_handle_t io_handle = NULL;
@@ -312,24 +269,31 @@ esp_err_t st7701_rgb_new_panel(esp_lcd_panel_handle_t *ret_panel)
         goto cleanup;
     }
 
-    ret = st7701_panel_send_init_sequence(io_handle);
-    if (ret != ESP_OK) {
-        goto cleanup;
+    if (!config->defer_init) {
+        ret = st7701_panel_send_init_sequence(io_handle);
+        if (ret != ESP_OK) {
+            goto cleanup;
+        }
+
+        ret = st7701_panel_check_id(io_handle);
+        if (ret != ESP_OK) {
+            goto cleanup;
+        }
     }
 
-    ret = st7701_panel_check_id(io_handle);
-    if (ret != ESP_OK) {
-        goto cleanup;
+    esp_lcd_rgb_timing_t timing = st7701_rgb_timing;
+    if (config->pclk_hz) {
+        timing.pclk_hz = config->pclk_hz;
     }
 
     esp_lcd_rgb_panel_config_t rgb_config = {
         .clk_src = LCD_CLK_SRC_DEFAULT,
-        .timings = st7701_rgb_timing,
+        .timings = timing,
         .data_width = LCD_DATA_WIDTH,
         .in_color_format = LCD_COLOR_FMT_RGB565,
         .out_color_format = LCD_COLOR_FMT_RGB565,
-        .num_fbs = 1,
-        .bounce_buffer_size_px = 0,
+        .num_fbs = config->num_fbs,
+        .bounce_buffer_size_px = config->bounce_buffer_size_px,
         .dma_burst_size = 64,
         .hsync_gpio_num = LCD_HSYNC_GPIO,
         .vsync_gpio_num = LCD_VSYNC_GPIO,
@@ -375,6 +339,7 @@ esp_err_t st7701_rgb_new_panel(esp_lcd_panel_handle_t *ret_panel)
     ctx->io = io_handle;
     ctx->host_id = LCD_CMD_SPI_HOST;
     ctx->free_bus_on_del = bus_acquired;
+    ctx->started = !config->defer_init;
     ctx->orig_del = panel_handle->del;
     ctx->orig_disp_on_off = panel_handle->disp_on_off;
     ctx->orig_disp_sleep = panel_handle->disp_sleep;
@@ -384,8 +349,9 @@ esp_err_t st7701_rgb_new_panel(esp_lcd_panel_handle_t *ret_panel)
     panel_handle->disp_sleep = st7701_panel_disp_sleep;
     adopt_user_data(panel_handle, ctx);
 
-    ESP_LOGI(TAG, "ST7701 RGB panel initialized (%dx%d @ %.1f MHz)",
-             LCD_H_RES, LCD_V_RES, LCD_PIXEL_CLOCK_HZ / 1000000.0f);
+    ESP_LOGI(TAG, "ST7701 RGB panel initialized (%dx%d @ %.1f MHz, %u fb, bounce %u px%s)",
+             LCD_H_RES, LCD_V_RES, timing.pclk_hz / 1000000.0f, config->num_fbs,
+             (unsigned)config->bounce_buffer_size_px, config->defer_init ? ", start deferred" : "");
 
     *ret_panel = panel_handle;
     return ESP_OK;
@@ -408,3 +374,19 @@ cleanup:
     return ret;
 }
 
+esp_err_t st7701_rgb_panel_start(esp_lcd_panel_handle_t panel)
+{
+    ESP_RETURN_ON_FALSE(panel && panel->del == st7701_panel_del, ESP_ERR_INVALID_ARG, TAG,
+                        "not an ST7701 panel");
+    st7701_rgb_panel_ctx_t *ctx = get_ctx(panel);
+    if (ctx->started) {
+        return ESP_OK;
+    }
+
+    esp_err_t ret = st7701_panel_send_init_sequence(ctx->io);
+    if (ret == ESP_OK) {
+        ret = st7701_panel_check_id(ctx->io);
+    }
+    ctx->started = ret == ESP_OK;
+    return ret;
+}
@@ -9,14 +9,83 @@
 extern "C" {
 #endif
 
+#define ST7701_RGB_H_RES          1024
+#define ST7701_RGB_V_RES           600
+#define ST7701_RGB_PCLK_HZ_DEFAULT (30 * 1000 * 1000)
+
+/* Blanking of the RGB timing (sync pulse + back porch + front porch) */
+#define ST7701_RGB_HSYNC_PULSE_WIDTH  10
+#define ST7701_RGB_HSYNC_BACK_PORCH  160
+#define ST7701_RGB_HSYNC_FRONT_PORCH 160
+#define ST7701_RGB_VSYNC_PULSE_WIDTH   1
+#define ST7701_RGB_VSYNC_BACK_PORCH   23
+#define ST7701_RGB_VSYNC_FRONT_PORCH  12
+
+/** Pixel clocks per scanned frame, blanking included */
+#define ST7701_RGB_FRAME_CLOCKS                                                              \
+    ((uint32_t)(ST7701_RGB_H_RES + ST7701_RGB_HSYNC_PULSE_WIDTH + ST7701_RGB_HSYNC_BACK_PORCH + \
+                ST7701_RGB_HSYNC_FRONT_PORCH) *                                              \
+     (ST7701_RGB_V_RES + ST7701_RGB_VSYNC_PULSE_WIDTH + ST7701_RGB_VSYNC_BACK_PORCH +        \
+      ST7701_RGB_VSYNC_FRONT_PORCH))
+
+/**
+ * @brief Runtime options for the RGB scan-out of the ST7701 panel
+ */
+typedef struct {
+    uint32_t pclk_hz;              /*!< RGB pixel clock in Hz */
+    uint8_t num_fbs;               /*!< Number of PSRAM framebuffers owned by the panel (1 or 2) */
+    size_t bounce_buffer_size_px;  /*!< Internal SRAM bounce buffer size in pixels, 0 to scan out from PSRAM.
+                                        Must be a multiple of the horizontal resolution dividing the frame size. */
+    bool defer_init;               /*!< Leave the ST7701 command sequence to st7701_rgb_panel_start(), so the
+                                        caller can overlap its 360 ms of mandated delays with other work */
+} st7701_rgb_config_t;
+
+/**
+ * @brief Default configuration: single framebuffer at the nominal pixel clock
+ */
+#define ST7701_RGB_DEFAULT_CONFIG() {          \
+    .pclk_hz = ST7701_RGB_PCLK_HZ_DEFAULT,     \
+    .num_fbs = 1,                              \
+    .bounce_buffer_size_px = 0,                \
+    .defer_init = false,                       \
+}
+
 /**
  * @brief Create and initialize ST7701 RGB panel for Waveshare ESP32-S3 Touch LCD 7B (1024x600)
  *
+ * Equivalent to st7701_rgb_new_panel_with_config() with ST7701_RGB_DEFAULT_CONFIG().
+ *
  * @param[out] ret_panel Returned panel handle
  * @return esp_err_t
  */
 esp_err_t st7701_rgb_new_panel(esp_lcd_panel_handle_t *ret_panel);
 
+/**
+ * @brief Create and initialize ST7701 RGB panel with explicit scan-out options
+ *
+ * With num_fbs = 2 the framebuffers can be fetched with
+ * esp_lcd_rgb_panel_get_frame_buffer() and handed to LVGL for direct rendering.
+ *
+ * @param[in] config Scan-out options
+ * @param[out] ret_panel Returned panel handle
+ * @return esp_err_t
+ */
+esp_err_t st7701_rgb_new_panel_with_config(const st7701_rgb_config_t *config,
+                                           esp_lcd_panel_handle_t *ret_panel);
+
+/**
+ * @brief Send the ST7701 command sequence of a panel created with defer_init
+ *
+ * The RGB scan-out already runs from the framebuffer; the controller starts
+ * sampling it once out of sleep. Blocks for the delays of the sequence
+ * (about 360 ms) and checks the controller ID. Returns ESP_OK at once when
+ * the sequence was already sent.
+ *
+ * @param panel Panel returned by st7701_rgb_new_panel_with_config()
+ * @return esp_err_t ESP_ERR_INVALID_ARG if the panel is not an ST7701 panel
+ */
+esp_err_t st7701_rgb_panel_start(esp_lcd_panel_handle_t panel);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,287 @@
+/**
+ * @file boot_sched.c
+ * @brief Ordonnanceur du démarrage par graphe de dépendances
+ *
+ * Le démarrage enchaîne des attentes matérielles imposées (séquence ST7701,
+ * reset du GT911) qui ne dépendent pas les unes des autres. Les étapes sont
+ * décrites avec leurs dépendances et exécutées par quelques tâches réparties
+ * sur les deux cœurs : une étape démarre dès que ses préalables sont
+ * terminés, pendant que les autres attendent le matériel ou construisent
+ * l'interface.
+ */
+
+#include "boot_sched.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "lvgl.h"
+
+static const char *TAG = "Boot_Sched";
+
+typedef struct {
+    const boot_stage_t *stages;
+    size_t count;
+    boot_sched_report_t *report;
+    SemaphoreHandle_t lock;     /**< Protège tout l'état ci-dessous */
+    SemaphoreHandle_t wake;     /**< Fin d'une étape : les tâches en attente réexaminent le graphe */
+    SemaphoreHandle_t exited;   /**< Un jeton par tâche d'exécution terminée */
+    uint32_t started_mask;
+    uint32_t done_mask;
+    size_t running;
+    esp_err_t first_error;
+    uint8_t done_order[BOOT_SCHED_MAX_STAGES];
+    size_t done_count;
+} boot_sched_t;
+
+typedef struct {
+    boot_sched_t *sched;
+    uint8_t index;
+} boot_sched_worker_t;
+
+static int64_t boot_sched_now(const boot_sched_t *sched)
+{
+    return esp_timer_get_time() - sched->report->start_us;
+}
+
+esp_err_t boot_sched_validate(const boot_stage_t *stages, size_t count)
+{
+    if (!stages || count == 0 || count > BOOT_SCHED_MAX_STAGES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        /* Seules les étapes précédentes sont admises : pas de cycle possible */
+        uint32_t earlier = (uint32_t)((1ull << i) - 1);
+        if (!stages[i].run || (stages[i].deps & ~earlier)) {
+            ESP_LOGE(TAG, "Étape %u (%s) invalide", (unsigned)i,
+                     stages[i].name ? stages[i].name : "?");
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Première étape prête, verrou tenu (-1 si aucune)
+ */
+static int boot_sched_next_ready(const boot_sched_t *sched)
+{
+    for (size_t i = 0; i < sched->count; ++i) {
+        uint32_t deps = sched->stages[i].deps;
+        if (!(sched->started_mask & BOOT_STAGE_DEP(i)) && (sched->done_mask & deps) == deps) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static esp_err_t boot_sched_exec(const boot_stage_t *stage)
+{
+    if (stage->lvgl_lock) {
+        lv_lock();
+    }
+    esp_err_t ret = stage->run(stage->arg);
+    if (stage->lvgl_lock) {
+        lv_unlock();
+    }
+    return ret;
+}
+
+static void boot_sched_wake_all(boot_sched_t *sched)
+{
+    for (size_t i = 0; i < BOOT_SCHED_MAX_WORKERS; ++i) {
+        xSemaphoreGive(sched->wake);
+    }
+}
+
+static void boot_sched_worker(void *arg)
+{
+    const boot_sched_worker_t *worker = arg;
+    boot_sched_t *sched = worker->sched;
+
+    xSemaphoreTake(sched->lock, portMAX_DELAY);
+    for (;;) {
+        int index = sched->first_error == ESP_OK ? boot_sched_next_ready(sched) : -1;
+        if (index < 0) {
+            /* Plus rien à lancer : fin dès que les étapes en cours sont terminées */
+            if (sched->running == 0) {
+                break;
+            }
+            xSemaphoreGive(sched->lock);
+            xSemaphoreTake(sched->wake, portMAX_DELAY);
+            xSemaphoreTake(sched->lock, portMAX_DELAY);
+            continue;
+        }
+
+        const boot_stage_t *stage = &sched->stages[index];
+        boot_stage_timing_t *timing = &sched->report->stages[index];
+        for (size_t i = 0; i < sched->count; ++i) {
+            if ((stage->deps & BOOT_STAGE_DEP(i)) &&
+                sched->report->stages[i].end_us > timing->ready_us) {
+                timing->ready_us = sched->report->stages[i].end_us;
+            }
+        }
+        timing->status = BOOT_STAGE_RUNNING;
+        timing->worker = worker->index;
+        timing->start_us = boot_sched_now(sched);
+        sched->started_mask |= BOOT_STAGE_DEP(index);
+        ++sched->running;
+        xSemaphoreGive(sched->lock);
+
+        esp_err_t ret = boot_sched_exec(stage);
+
+        xSemaphoreTake(sched->lock, portMAX_DELAY);
+        timing->end_us = boot_sched_now(sched);
+        timing->result = ret;
+        --sched->running;
+        if (ret == ESP_OK) {
+            timing->status = BOOT_STAGE_DONE;
+            sched->done_mask |= BOOT_STAGE_DEP(index);
+            sched->done_order[sched->done_count++] = (uint8_t)index;
+        } else {
+            timing->status = BOOT_STAGE_FAILED;
+            ESP_LOGE(TAG, "Étape %s en échec (0x%x)", stage->name, ret);
+            if (sched->first_error == ESP_OK) {
+                sched->first_error = ret;
+            }
+        }
+        boot_sched_wake_all(sched);
+    }
+    /* Les autres tâches constatent aussi la fin */
+    boot_sched_wake_all(sched);
+    xSemaphoreGive(sched->lock);
+    xSemaphoreGive(sched->exited);
+    vTaskDelete(NULL);
+}
+
+esp_err_t boot_sched_run(const boot_stage_t *stages, size_t count, uint8_t workers,
+                         boot_sched_report_t *report)
+{
+    esp_err_t ret = boot_sched_validate(stages, count);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (workers == 0 || workers > BOOT_SCHED_MAX_WORKERS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    static boot_sched_report_t scratch;
+    if (!report) {
+        report = &scratch;
+    }
+    *report = (boot_sched_report_t){
+        .count = count,
+        .start_us = esp_timer_get_time(),
+    };
+    boot_sched_t sched = {
+        .stages = stages,
+        .count = count,
+        .report = report,
+        .lock = xSemaphoreCreateMutex(),
+        .wake = xSemaphoreCreateCounting(BOOT_SCHED_MAX_WORKERS * (BOOT_SCHED_MAX_STAGES + 1), 0),
+        .exited = xSemaphoreCreateCounting(BOOT_SCHED_MAX_WORKERS, 0),
+        .first_error = ESP_OK,
+    };
+    boot_sched_worker_t contexts[BOOT_SCHED_MAX_WORKERS];
+    uint8_t created = 0;
+    if (!sched.lock || !sched.wake || !sched.exited) {
+        ret = ESP_ERR_NO_MEM;
+        goto cleanup;
+    }
+
+    for (uint8_t i = 0; i < workers; ++i) {
+        contexts[i] = (boot_sched_worker_t){.sched = &sched, .index = i};
+        if (xTaskCreatePinnedToCore(boot_sched_worker, "boot_sched", BOOT_SCHED_TASK_STACK,
+                                    &contexts[i], BOOT_SCHED_TASK_PRIORITY, NULL,
+                                    i % portNUM_PROCESSORS) != pdPASS) {
+            /* Les tâches déjà lancées suffisent à terminer le graphe */
+            ESP_LOGW(TAG, "Tâche d'exécution %u indisponible", i);
+            break;
+        }
+        ++created;
+    }
+    if (created == 0) {
+        ret = ESP_ERR_NO_MEM;
+        goto cleanup;
+    }
+    report->workers = created;
+    for (uint8_t i = 0; i < created; ++i) {
+        xSemaphoreTake(sched.exited, portMAX_DELAY);
+    }
+
+    ret = sched.first_error;
+    if (ret != ESP_OK) {
+        /* Libération dans l'ordre inverse des fins d'étapes */
+        for (size_t i = sched.done_count; i-- > 0;) {
+            const boot_stage_t *stage = &stages[sched.done_order[i]];
+            if (!stage->undo) {
+                continue;
+            }
+            if (stage->lvgl_lock) {
+                lv_lock();
+            }
+            stage->undo(stage->arg);
+            if (stage->lvgl_lock) {
+                lv_unlock();
+            }
+            report->stages[sched.done_order[i]].status = BOOT_STAGE_UNDONE;
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const boot_stage_timing_t *timing = &report->stages[i];
+        if (timing->status != BOOT_STAGE_PENDING) {
+            report->serial_us += timing->end_us - timing->start_us;
+        }
+    }
+    report->total_us = boot_sched_now(&sched);
+
+cleanup:
+    if (sched.lock) {
+        vSemaphoreDelete(sched.lock);
+    }
+    if (sched.wake) {
+        vSemaphoreDelete(sched.wake);
+    }
+    if (sched.exited) {
+        vSemaphoreDelete(sched.exited);
+    }
+    return ret;
+}
+
+static const char *boot_sched_status_name(boot_stage_status_t status)
+{
+    switch (status) {
+    case BOOT_STAGE_DONE:
+        return "ok";
+    case BOOT_STAGE_FAILED:
+        return "échec";
+    case BOOT_STAGE_UNDONE:
+        return "annulée";
+    case BOOT_STAGE_RUNNING:
+        return "en cours";
+    default:
+        return "non lancée";
+    }
+}
+
+void boot_sched_log_report(const boot_stage_t *stages, const boot_sched_report_t *report)
+{
+    if (!stages || !report) {
+        return;
+    }
+    for (size_t i = 0; i < report->count; ++i) {
+        const boot_stage_timing_t *timing = &report->stages[i];
+        if (timing->status == BOOT_STAGE_PENDING) {
+            ESP_LOGI(TAG, "%-10s non lancée", stages[i].name);
+            continue;
+        }
+        ESP_LOGI(TAG, "%-10s prête %7.1f  début %7.1f  durée %7.1f ms  tâche %u  %s",
+                 stages[i].name, timing->ready_us / 1000.0, timing->start_us / 1000.0,
+                 (timing->end_us - timing->start_us) / 1000.0, timing->worker,
+                 boot_sched_status_name(timing->status));
+    }
+    ESP_LOGI(TAG, "Démarrage en %.1f ms sur %u tâche(s), %.1f ms en séquentiel",
+             report->total_us / 1000.0, report->workers, report->serial_us / 1000.0);
+}
@@ -0,0 +1,122 @@
+/**
+ * @file boot_sched.h
+ * @brief Ordonnanceur du démarrage par graphe de dépendances
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef BOOT_SCHED_H
+#define BOOT_SCHED_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Étapes d'un démarrage au plus */
+#define BOOT_SCHED_MAX_STAGES 16
+
+/**
+ * Tâches d'exécution au plus, réparties sur les cœurs : une étape qui attend
+ * le matériel (vTaskDelay) occupe une tâche mais pas son cœur
+ */
+#define BOOT_SCHED_MAX_WORKERS 4
+
+/* Tâches d'exécution : la pile couvre la construction de l'interface */
+#define BOOT_SCHED_TASK_STACK    8192
+#define BOOT_SCHED_TASK_PRIORITY 5
+
+/** Dépendance envers l'étape d'indice i */
+#define BOOT_STAGE_DEP(i) (1u << (i))
+
+/**
+ * @brief Étape du démarrage
+ *
+ * Une étape ne dépend que d'étapes déclarées avant elle : l'ordre du tableau
+ * est un ordre topologique et sert de priorité entre étapes prêtes.
+ */
+typedef struct {
+    const char *name;                /**< Nom affiché dans le rapport */
+    esp_err_t (*run)(void *arg);     /**< Initialisation */
+    void (*undo)(void *arg);         /**< Libération si le démarrage échoue ensuite (optionnel) */
+    void *arg;                       /**< Argument de run et undo */
+    uint32_t deps;                   /**< Masque BOOT_STAGE_DEP() des étapes préalables */
+    bool lvgl_lock;                  /**< Exécutée verrou LVGL tenu */
+} boot_stage_t;
+
+/**
+ * @brief État final d'une étape
+ */
+typedef enum {
+    BOOT_STAGE_PENDING = 0,  /**< Jamais lancée (démarrage interrompu avant) */
+    BOOT_STAGE_RUNNING,
+    BOOT_STAGE_DONE,
+    BOOT_STAGE_FAILED,
+    BOOT_STAGE_UNDONE,       /**< Réussie puis annulée après l'échec d'une autre étape */
+} boot_stage_status_t;
+
+/**
+ * @brief Mesures d'une étape, en µs depuis le lancement de l'ordonnanceur
+ */
+typedef struct {
+    boot_stage_status_t status;
+    esp_err_t result;
+    int64_t ready_us;   /**< Dernière dépendance terminée */
+    int64_t start_us;   /**< Prise en charge par une tâche */
+    int64_t end_us;
+    uint8_t worker;     /**< Tâche d'exécution (cœur worker % portNUM_PROCESSORS) */
+} boot_stage_timing_t;
+
+/**
+ * @brief Rapport d'un démarrage
+ */
+typedef struct {
+    size_t count;
+    uint8_t workers;
+    int64_t start_us;   /**< esp_timer_get_time() au lancement */
+    int64_t total_us;   /**< Durée du démarrage, annulations comprises */
+    int64_t serial_us;  /**< Somme des durées des étapes : démarrage séquentiel équivalent */
+    boot_stage_timing_t stages[BOOT_SCHED_MAX_STAGES];
+} boot_sched_report_t;
+
+/**
+ * @brief Vérifie un graphe d'étapes
+ * @param stages Étapes
+ * @param count Nombre d'étapes (1 à BOOT_SCHED_MAX_STAGES)
+ * @return esp_err_t ESP_ERR_INVALID_ARG si une étape n'a pas de run ou dépend
+ *         d'elle-même ou d'une étape déclarée après elle
+ */
+esp_err_t boot_sched_validate(const boot_stage_t *stages, size_t count);
+
+/**
+ * @brief Exécute les étapes dès que leurs dépendances sont terminées
+ *
+ * Chaque tâche d'exécution prend l'étape prête de plus petit indice. À la
+ * première erreur plus aucune étape n'est lancée : celles en cours se
+ * terminent, puis les étapes réussies sont annulées dans l'ordre inverse de
+ * leur fin, depuis la tâche appelante. Bloque jusqu'à la fin du démarrage.
+ * @param stages Étapes (ordre topologique)
+ * @param count Nombre d'étapes
+ * @param workers Tâches d'exécution (1 = démarrage séquentiel)
+ * @param[out] report Mesures par étape (peut être NULL)
+ * @return esp_err_t Erreur de la première étape en échec, ESP_OK sinon
+ */
+esp_err_t boot_sched_run(const boot_stage_t *stages, size_t count, uint8_t workers,
+                         boot_sched_report_t *report);
+
+/**
+ * @brief Journalise le rapport : une ligne par étape puis la durée totale
+ * @param stages Étapes passées à boot_sched_run()
+ * @param report Rapport rempli par boot_sched_run()
+ */
+void boot_sched_log_report(const boot_stage_t *stages, const boot_sched_report_t *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BOOT_SCHED_H
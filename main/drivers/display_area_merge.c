@@ -0,0 +1,81 @@
+/**
+ * @file display_area_merge.c
+ * @brief Fusion des zones invalidées d'une trame selon un modèle de coût
+ * @author NovaReptileElevage Team
+ */
+
+#include <stdbool.h>
+#include "display_area_merge.h"
+
+static uint64_t area_px(const lv_area_t *a)
+{
+    return (uint64_t)(a->x2 - a->x1 + 1) * (uint64_t)(a->y2 - a->y1 + 1);
+}
+
+static lv_area_t area_union(const lv_area_t *a, const lv_area_t *b)
+{
+    lv_area_t u = {
+        .x1 = a->x1 < b->x1 ? a->x1 : b->x1,
+        .y1 = a->y1 < b->y1 ? a->y1 : b->y1,
+        .x2 = a->x2 > b->x2 ? a->x2 : b->x2,
+        .y2 = a->y2 > b->y2 ? a->y2 : b->y2,
+    };
+    return u;
+}
+
+static bool area_contains(const lv_area_t *outer, const lv_area_t *inner)
+{
+    return inner->x1 >= outer->x1 && inner->x2 <= outer->x2 &&
+           inner->y1 >= outer->y1 && inner->y2 <= outer->y2;
+}
+
+uint64_t display_area_merge_cost(const lv_area_t *area, uint32_t call_cost_px)
+{
+    return area_px(area) + call_cost_px;
+}
+
+size_t display_area_merge(lv_area_t *areas, size_t count, uint32_t call_cost_px)
+{
+    if (!areas) {
+        return 0;
+    }
+
+    while (count > 1) {
+        int64_t best_gain = 0;
+        size_t best_i = 0;
+        size_t best_j = 0;
+
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t cost_i = display_area_merge_cost(&areas[i], call_cost_px);
+            for (size_t j = i + 1; j < count; ++j) {
+                lv_area_t u = area_union(&areas[i], &areas[j]);
+                int64_t gain = (int64_t)(cost_i + display_area_merge_cost(&areas[j], call_cost_px)) -
+                               (int64_t)display_area_merge_cost(&u, call_cost_px);
+                if (gain > best_gain) {
+                    best_gain = gain;
+                    best_i = i;
+                    best_j = j;
+                }
+            }
+        }
+        if (best_gain <= 0) {
+            break;
+        }
+
+        areas[best_i] = area_union(&areas[best_i], &areas[best_j]);
+        areas[best_j] = areas[--count];
+
+        /* Absorption des zones couvertes par l'union */
+        for (size_t k = 0; k < count;) {
+            if (k != best_i && area_contains(&areas[best_i], &areas[k])) {
+                areas[k] = areas[--count];
+                if (best_i == count) {
+                    best_i = k;
+                }
+            } else {
+                ++k;
+            }
+        }
+    }
+    return count;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file display_area_merge.h
+ * @brief Fusion des zones invalidées d'une trame selon un modèle de coût
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef DISPLAY_AREA_MERGE_H
+#define DISPLAY_AREA_MERGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Coût d'une zone : ses pixels plus un coût fixe par flush
+ *
+ * Le coût fixe (parcours des widgets, appel de flush, draw_bitmap) est
+ * exprimé en équivalent pixels.
+ * @param area Zone
+ * @param call_cost_px Coût fixe d'un flush en pixels
+ * @return uint64_t Coût de la zone
+ */
+uint64_t display_area_merge_cost(const lv_area_t *area, uint32_t call_cost_px);
+
+/**
+ * @brief Fusionne les zones tant que cela réduit le coût total
+ *
+ * À chaque étape la paire dont l'union fait le plus baisser le coût est
+ * remplacée par son union, puis les zones entièrement couvertes par celle-ci
+ * sont absorbées. Les zones qui se chevauchent comptent deux fois leurs
+ * pixels communs et sont donc fusionnées en priorité. Le résultat couvre
+ * toujours tous les pixels d'entrée.
+ *
+ * @param[in,out] areas Zones à fusionner, compactées en sortie
+ * @param count Nombre de zones en entrée
+ * @param call_cost_px Coût fixe d'un flush en pixels (0 : fusion des seuls chevauchements rentables)
+ * @return size_t Nombre de zones en sortie
+ */
+size_t display_area_merge(lv_area_t *areas, size_t count, uint32_t call_cost_px);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DISPLAY_AREA_MERGE_H
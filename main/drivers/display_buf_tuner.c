@@ -0,0 +1,182 @@
+/**
+ * @file display_buf_tuner.c
+ * @brief Calibration des tampons de rendu du mode partiel
+ *
+ * Le meilleur compromis dépend de la carte : des tampons hauts en PSRAM
+ * limitent le nombre de bandes mais chaque pixel rendu y coûte plus cher,
+ * des tampons en SRAM interne rendent plus vite mais multiplient les bandes.
+ * Plutôt que de figer ce choix, chaque candidat est mesuré sur la cible et
+ * le plus rapide est conservé en NVS.
+ */
+
+#include "display_buf_tuner.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs.h"
+
+static const char *TAG = "Display_Tuner";
+
+typedef struct {
+    uint16_t lines;
+    bool psram;
+} display_buf_candidate_t;
+
+/* Du défaut PSRAM (1/4 d'écran) aux bandes SRAM interne (2 Kio par ligne et par tampon) */
+static const display_buf_candidate_t candidates[] = {
+    {150, true}, {100, true}, {60, true}, {30, true},
+    {40, false}, {20, false}, {10, false},
+};
+
+/* Enregistrement NVS : version, emplacement, hauteur et durée mesurée */
+typedef struct {
+    uint8_t version;
+    uint8_t psram;
+    uint16_t lines;
+    uint32_t frame_us;
+} display_buf_record_t;
+
+/**
+ * @brief Durée moyenne d'une trame plein écran de la scène de référence
+ */
+static uint32_t display_buf_tuner_measure(lv_display_t *disp, display_buf_tuner_scene_cb_t scene,
+                                          void *ctx)
+{
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < DISPLAY_BUF_TUNER_WARMUP_FRAMES + DISPLAY_BUF_TUNER_FRAMES; ++i) {
+        if (scene) {
+            scene(i, ctx);
+        }
+        lv_obj_invalidate(lv_screen_active());
+        int64_t start = esp_timer_get_time();
+        lv_refr_now(disp);
+        display_driver_wait_flush_idle();
+        if (i >= DISPLAY_BUF_TUNER_WARMUP_FRAMES) {
+            total += (uint64_t)(esp_timer_get_time() - start);
+        }
+    }
+    return (uint32_t)(total / DISPLAY_BUF_TUNER_FRAMES);
+}
+
+static esp_err_t display_buf_tuner_save(const display_buf_tuner_result_t *result)
+{
+    const display_buf_record_t record = {
+        .version = DISPLAY_BUF_TUNER_RECORD_VERSION,
+        .psram = result->psram,
+        .lines = result->lines,
+        .frame_us = result->frame_us,
+    };
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(DISPLAY_BUF_TUNER_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "nvs_open failed: %d", ret);
+        return ret;
+    }
+    ret = nvs_set_blob(handle, DISPLAY_BUF_TUNER_NVS_KEY, &record, sizeof(record));
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Enregistrement de la calibration impossible: %d", ret);
+    }
+    return ret;
+}
+
+esp_err_t display_buf_tuner_load(display_driver_config_t *config)
+{
+    if (!config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(DISPLAY_BUF_TUNER_NVS_NAMESPACE, NVS_READONLY, &handle);
+    if (ret != ESP_OK) {
+        /* Espace de noms absent : jamais calibré */
+        return ESP_ERR_NOT_FOUND;
+    }
+    display_buf_record_t record;
+    size_t length = sizeof(record);
+    ret = nvs_get_blob(handle, DISPLAY_BUF_TUNER_NVS_KEY, &record, &length);
+    nvs_close(handle);
+    if (ret != ESP_OK || length != sizeof(record) ||
+        record.version != DISPLAY_BUF_TUNER_RECORD_VERSION ||
+        record.lines == 0 || record.lines > DISPLAY_HEIGHT) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    config->draw_buf_lines = record.lines;
+    config->draw_buf_psram = record.psram != 0;
+    ESP_LOGI(TAG, "Calibration enregistrée : 2 x %u lignes en %s (%lu us/trame)",
+             record.lines, record.psram ? "PSRAM" : "SRAM", (unsigned long)record.frame_us);
+    return ESP_OK;
+}
+
+esp_err_t display_buf_tuner_run(display_buf_tuner_scene_cb_t scene, void *ctx,
+                                display_buf_tuner_result_t *best)
+{
+    if (!best) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    lv_display_t *disp = lv_display_get_default();
+    uint16_t initial_lines;
+    bool initial_psram;
+    if (!disp || display_driver_get_draw_buffers(&initial_lines, &initial_psram) != ESP_OK) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (display_driver_get_render_mode() != DISPLAY_RENDER_MODE_PARTIAL) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    lv_lock();
+    bool found = false;
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); ++i) {
+        const display_buf_candidate_t *c = &candidates[i];
+        if (display_driver_set_draw_buffers(c->lines, c->psram) != ESP_OK) {
+            ESP_LOGW(TAG, "2 x %3u lignes en %-5s : ignoré", c->lines, c->psram ? "PSRAM" : "SRAM");
+            continue;
+        }
+        uint32_t frame_us = display_buf_tuner_measure(disp, scene, ctx);
+        ESP_LOGI(TAG, "2 x %3u lignes en %-5s : %6lu us/trame", c->lines,
+                 c->psram ? "PSRAM" : "SRAM", (unsigned long)frame_us);
+        if (!found || frame_us < best->frame_us) {
+            best->lines = c->lines;
+            best->psram = c->psram;
+            best->frame_us = frame_us;
+            found = true;
+        }
+    }
+
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    if (found) {
+        ret = display_driver_set_draw_buffers(best->lines, best->psram);
+    }
+    if (ret != ESP_OK) {
+        /* Rien de mesurable ou gagnant non réallouable : retour aux tampons du boot */
+        display_driver_set_draw_buffers(initial_lines, initial_psram);
+    }
+    lv_unlock();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Calibration impossible: %d", ret);
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "Retenu : 2 x %u lignes en %s (%lu us/trame)", best->lines,
+             best->psram ? "PSRAM" : "SRAM", (unsigned long)best->frame_us);
+    return display_buf_tuner_save(best);
+}
+
+esp_err_t display_buf_tuner_erase(void)
+{
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(DISPLAY_BUF_TUNER_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = nvs_erase_key(handle, DISPLAY_BUF_TUNER_NVS_KEY);
+    if (ret == ESP_ERR_NVS_NOT_FOUND) {
+        ret = ESP_OK;
+    }
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    return ret;
+}
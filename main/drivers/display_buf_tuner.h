@@ -0,0 +1,88 @@
+/**
+ * @file display_buf_tuner.h
+ * @brief Calibration des tampons de rendu du mode partiel (hauteur et emplacement)
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef DISPLAY_BUF_TUNER_H
+#define DISPLAY_BUF_TUNER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "display_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Trames rendues par candidat avant la mesure (mise en page, caches) */
+#define DISPLAY_BUF_TUNER_WARMUP_FRAMES 1
+/** Trames mesurées par candidat */
+#define DISPLAY_BUF_TUNER_FRAMES 6
+
+/** Emplacement NVS du résultat de calibration */
+#define DISPLAY_BUF_TUNER_NVS_NAMESPACE "nova_display"
+#define DISPLAY_BUF_TUNER_NVS_KEY       "draw_buf"
+/** À incrémenter si la liste des candidats ou le format de l'enregistrement change */
+#define DISPLAY_BUF_TUNER_RECORD_VERSION 1
+
+/**
+ * @brief Résultat de calibration (candidat retenu)
+ */
+typedef struct {
+    uint16_t lines;    /**< Hauteur de chaque tampon en lignes */
+    bool psram;        /**< Tampons en PSRAM (sinon SRAM interne DMA) */
+    uint32_t frame_us; /**< Durée moyenne d'une trame de la scène de référence */
+} display_buf_tuner_result_t;
+
+/**
+ * @brief Prépare la trame n de la scène de référence
+ *
+ * Appelé avec le verrou LVGL pris avant chaque trame : typiquement un
+ * changement d'écran. L'écran actif est ensuite invalidé en entier.
+ * @param frame Numéro de trame pour le candidat courant (préchauffe comprise)
+ * @param ctx Contexte fourni à display_buf_tuner_run()
+ */
+typedef void (*display_buf_tuner_scene_cb_t)(uint32_t frame, void *ctx);
+
+/**
+ * @brief Applique le résultat enregistré à une configuration du driver
+ *
+ * Sans enregistrement valide la configuration n'est pas modifiée. À appeler
+ * avant display_driver_init_with_config() : le choix calibré est utilisé dès
+ * le boot suivant, sans nouvelle mesure.
+ * @param[in,out] config Configuration à compléter
+ * @return esp_err_t ESP_ERR_NOT_FOUND si aucune calibration n'est enregistrée
+ */
+esp_err_t display_buf_tuner_load(display_driver_config_t *config);
+
+/**
+ * @brief Mesure chaque candidat, applique et enregistre le plus rapide
+ *
+ * Pour chaque couple (hauteur, PSRAM/SRAM interne) les tampons sont
+ * réalloués avec display_driver_set_draw_buffers() ; les candidats dont
+ * l'allocation échoue sont ignorés. La scène est rendue plein écran avec
+ * lv_refr_now() jusqu'à la fin du dernier flush. À appeler depuis la tâche
+ * LVGL, en mode partiel ; le verrou LVGL est pris pendant la mesure.
+ * @param scene Préparation de chaque trame (NULL : écran actif seul)
+ * @param ctx Contexte transmis à scene
+ * @param[out] best Candidat retenu
+ * @return esp_err_t ESP_ERR_NOT_SUPPORTED hors mode partiel, ESP_ERR_NO_MEM si
+ *         aucun candidat n'a pu être alloué
+ */
+esp_err_t display_buf_tuner_run(display_buf_tuner_scene_cb_t scene, void *ctx,
+                                display_buf_tuner_result_t *best);
+
+/**
+ * @brief Efface la calibration enregistrée (nouvelle mesure au prochain boot)
+ * @return esp_err_t Code d'erreur NVS
+ */
+esp_err_t display_buf_tuner_erase(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DISPLAY_BUF_TUNER_H
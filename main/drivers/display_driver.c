@@ -4,12 +4,22 @@
  */
 
 #include "display_driver.h"
+#include "display_area_merge.h"
 #include "st7701_rgb.h"
 #include "esp_log.h"
 #include "esp_attr.h"
 #include "esp_timer.h"
+#include "esp_rom_sys.h"
 #include "esp_lcd_panel_ops.h"
+#include "esp_lcd_panel_rgb.h"
+#include "esp_async_memcpy.h"
+#include "esp_cache.h"
+#include "esp_idf_version.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
 #include "ch422g.h"
+#include "lvgl_private.h"
 
 static const char *TAG = "Display_Driver";
 
@@ -17,18 +27,485 @@ static esp_lcd_panel_handle_t panel_handle;
 static lv_display_t *display;
 static lv_color_t *buf1 = NULL;
 static lv_color_t *buf2 = NULL;
+static display_render_mode_t render_mode = DISPLAY_RENDER_MODE_PARTIAL;
+static uint32_t area_merge_call_cost_px;
+/* Framebuffers appartenant au panneau (modes direct et GDMA) : jamais libérés ici */
+static void *panel_fbs[2];
+/* Copie GDMA des bandes SRAM interne vers le framebuffer PSRAM */
+static async_memcpy_handle_t dma_copier;
+
+/*
+ * Flush asynchrone : LVGL ne possède qu'un flush en cours à la fois. En mode
+ * partiel la copie vers le framebuffer est confiée à une tâche du cœur 0 et
+ * la fin de copie (on_color_trans_done) libère LVGL ; en mode direct c'est
+ * le VSYNC qui suit la bascule. Les compteurs soumis/terminés (un seul
+ * écrivain chacun) numérotent les flushs : les complétions arrivent dans
+ * l'ordre des soumissions, la n-ième termine le flush n. Un flush abandonné
+ * au délai d'attente n'est pas compté comme terminé ; sa complétion
+ * tardive est reconnue à son numéro et ne libère pas le flush suivant.
+ * Les complétions (ISR) ne font que compter et donner flush_done_sem :
+ * lv_display_flush_ready(), en flash, est appelé par flush_wait_cb dans la
+ * tâche LVGL, une fois par flush terminé (flush_released).
+ */
+static bool async_flush;
+static SemaphoreHandle_t flush_done_sem;
+static SemaphoreHandle_t flush_req_sem;
+static SemaphoreHandle_t flush_task_exit_sem;
+static TaskHandle_t flush_task;
+static volatile bool flush_task_stop;
+static volatile bool swap_pending;
+static volatile uint32_t flush_submitted;
+static volatile uint32_t flush_completed;
+static volatile uint32_t flush_abandoned;
+static uint32_t flush_released;
+static lv_area_t pending_area;
+static uint8_t *pending_px_map;
+
+/*
+ * Synchronisation sur le balayage (mode partiel) : le VSYNC horodate le début
+ * de trame et la position du balayage s'en déduit à chaque copie. Horodatage
+ * sur 32 bits, écrit d'un bloc depuis l'ISR ; les écarts restent justes au
+ * repli du compteur.
+ */
+static bool scanline_sync;
+static uint16_t scanline_guard_lines;
+static volatile uint32_t vsync_stamp_us;
+static volatile bool vsync_seen;
+static uint32_t copy_ns_per_px;
+static uint32_t frame_wait_us;
+static display_scanline_stats_t scanline_stats;
+static bool pending_last;
+
+/* Bilan de bande passante PSRAM */
+static uint32_t panel_pclk_hz;
+static bool draw_bufs_in_psram;
+static uint16_t draw_buf_lines;
+static bool log_psram_budget;
+static uint64_t psram_render_bytes;
+static int64_t psram_window_start_us;
+
+/**
+ * @brief Compte la fin d'un flush et réveille flush_wait_cb (tâche ou ISR)
+ *
+ * Aucun appel à LVGL ici : la libération du flush est faite par
+ * display_flush_wait_cb() dans la tâche LVGL.
+ */
+static bool IRAM_ATTR display_flush_complete(void)
+{
+    BaseType_t high_task_awoken = pdFALSE;
+    uint32_t seq = flush_completed + 1;
+    flush_completed = seq;
+    /* Flush abandonné au délai : LVGL est déjà passé au suivant */
+    if ((int32_t)(seq - flush_abandoned) <= 0) {
+        return false;
+    }
+    xSemaphoreGiveFromISR(flush_done_sem, &high_task_awoken);
+    return high_task_awoken == pdTRUE;
+}
+
+/**
+ * @brief Fin de copie du tampon de rendu dans le framebuffer (mode partiel)
+ *
+ * Le tampon peut être réutilisé par LVGL dès cet instant.
+ */
+static bool IRAM_ATTR display_on_color_trans_done(esp_lcd_panel_handle_t panel,
+                                                  const esp_lcd_rgb_panel_event_data_t *edata,
+                                                  void *user_ctx)
+{
+    (void)panel;
+    (void)edata;
+    (void)user_ctx;
+    return display_flush_complete();
+}
+
+/**
+ * @brief Callback VSYNC du panneau RGB (contexte ISR)
+ *
+ * Mode direct : le balayage vient de basculer sur le framebuffer demandé,
+ * l'ancien front buffer peut être réécrit par LVGL. Mode partiel
+ * synchronisé : horodatage du début de trame.
+ */
+static bool IRAM_ATTR display_on_vsync(esp_lcd_panel_handle_t panel,
+                                       const esp_lcd_rgb_panel_event_data_t *edata,
+                                       void *user_ctx)
+{
+    (void)panel;
+    (void)edata;
+    (void)user_ctx;
+    if (scanline_sync) {
+        vsync_stamp_us = (uint32_t)esp_timer_get_time();
+        vsync_seen = true;
+        return false;
+    }
+    if (!swap_pending) {
+        return false;
+    }
+    swap_pending = false;
+    return display_flush_complete();
+}
+
+/**
+ * @brief Attente LVGL d'un flush en cours (remplace l'attente active)
+ *
+ * Libère auprès de LVGL le flush terminé, depuis la tâche qui attend.
+ */
+static void display_flush_wait_cb(lv_display_t *disp)
+{
+    uint32_t seq = flush_submitted;
+    while ((int32_t)(seq - flush_completed) > 0) {
+        if (xSemaphoreTake(flush_done_sem, pdMS_TO_TICKS(DISPLAY_FLUSH_TIMEOUT_MS)) != pdTRUE) {
+            /* Complétion en retard : LVGL continue, elle sera ignorée à son arrivée */
+            ESP_LOGW(TAG, "Flush %lu non terminé après %d ms (%lu terminés), abandonné",
+                     (unsigned long)seq, DISPLAY_FLUSH_TIMEOUT_MS,
+                     (unsigned long)flush_completed);
+            flush_abandoned = seq;
+            flush_released = seq;
+            return;
+        }
+    }
+    if (flush_released != seq) {
+        flush_released = seq;
+        lv_display_flush_ready(disp);
+    }
+}
+
+static void display_scanline_timing(display_scanline_timing_t *timing)
+{
+    *timing = (display_scanline_timing_t){
+        .pclk_hz = panel_pclk_hz,
+        .h_total = ST7701_RGB_H_RES + ST7701_RGB_HSYNC_PULSE_WIDTH +
+                   ST7701_RGB_HSYNC_BACK_PORCH + ST7701_RGB_HSYNC_FRONT_PORCH,
+        .v_total = ST7701_RGB_V_RES + ST7701_RGB_VSYNC_PULSE_WIDTH +
+                   ST7701_RGB_VSYNC_BACK_PORCH + ST7701_RGB_VSYNC_FRONT_PORCH,
+        .v_active_start = ST7701_RGB_VSYNC_PULSE_WIDTH + ST7701_RGB_VSYNC_BACK_PORCH,
+        .v_res = ST7701_RGB_V_RES,
+    };
+}
+
+/**
+ * @brief Attente sous la microseconde : tick FreeRTOS puis attente active
+ */
+static void display_sleep_us(uint32_t us)
+{
+    int64_t deadline = esp_timer_get_time() + us;
+    TickType_t ticks = us / (portTICK_PERIOD_MS * 1000);
+    if (ticks) {
+        vTaskDelay(ticks);
+    }
+    int64_t left = deadline - esp_timer_get_time();
+    if (left > 0) {
+        esp_rom_delay_us((uint32_t)left);
+    }
+}
+
+/**
+ * @brief Laisse passer le balayage avant la copie d'une zone
+ *
+ * La copie n'est retardée que si le balayage doit traverser la zone avant
+ * la fin estimée de la copie. L'attente est comptée dans la trame en cours.
+ */
+static void display_scanline_wait(const lv_area_t *area, bool last)
+{
+    uint32_t copy_us = (uint32_t)((uint64_t)lv_area_get_size(area) * copy_ns_per_px / 1000) + 1;
+    display_scanline_plan_t plan = {0};
+    if (vsync_seen) {
+        display_scanline_timing_t timing;
+        display_scanline_timing(&timing);
+        uint32_t since_vsync = (uint32_t)esp_timer_get_time() - vsync_stamp_us;
+        display_scanline_plan(&timing, since_vsync, area->y1, area->y2, copy_us,
+                              scanline_guard_lines, &plan);
+    }
+    if (plan.wait_us) {
+        display_sleep_us(plan.wait_us);
+        ++scanline_stats.delayed;
+    }
+    scanline_stats.unavoidable += plan.unavoidable;
+    ++scanline_stats.areas;
+    scanline_stats.total_wait_us += plan.wait_us;
+    frame_wait_us += plan.wait_us;
+    if (last) {
+        ++scanline_stats.frames;
+        if (frame_wait_us > scanline_stats.max_frame_wait_us) {
+            scanline_stats.max_frame_wait_us = frame_wait_us;
+        }
+        frame_wait_us = 0;
+    }
+}
+
+/**
+ * @brief Copie une zone rendue dans le framebuffer balayé (mode partiel)
+ *
+ * Avec la synchronisation sur le balayage, la durée mesurée de la copie
+ * affine l'estimation utilisée pour les zones suivantes.
+ */
+static esp_err_t display_copy_area(const lv_area_t *area, const uint8_t *px_map, bool last)
+{
+    if (!scanline_sync) {
+        return esp_lcd_panel_draw_bitmap(panel_handle, area->x1, area->y1,
+                                         area->x2 + 1, area->y2 + 1, px_map);
+    }
+    display_scanline_wait(area, last);
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = esp_lcd_panel_draw_bitmap(panel_handle, area->x1, area->y1,
+                                              area->x2 + 1, area->y2 + 1, px_map);
+    uint32_t px = lv_area_get_size(area);
+    int64_t elapsed = esp_timer_get_time() - start;
+    if (ret == ESP_OK && elapsed > 0 && px) {
+        uint32_t measured = (uint32_t)(elapsed * 1000 / px);
+        copy_ns_per_px = (copy_ns_per_px * 7 + measured + 7) / 8;
+    }
+    return ret;
+}
+
+/**
+ * @brief Tâche de copie des zones rendues vers le framebuffer (mode partiel)
+ *
+ * La copie CPU de esp_lcd_panel_draw_bitmap() s'exécute sur le cœur 0 pendant
+ * que LVGL rend la zone suivante dans l'autre tampon sur le cœur 1.
+ */
+static void display_flush_task(void *arg)
+{
+    (void)arg;
+    while (!flush_task_stop) {
+        if (xSemaphoreTake(flush_req_sem, portMAX_DELAY) != pdTRUE || flush_task_stop) {
+            continue;
+        }
+        if (display_copy_area(&pending_area, pending_px_map, pending_last) != ESP_OK) {
+            ESP_LOGE(TAG, "esp_lcd_panel_draw_bitmap failed");
+            /* Aucun on_color_trans_done ne suivra : terminer le flush ici */
+            display_flush_complete();
+        }
+    }
+    xSemaphoreGive(flush_task_exit_sem);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Fin de copie GDMA d'une bande (contexte ISR)
+ */
+static bool IRAM_ATTR display_on_dma_copy_done(async_memcpy_handle_t mcp,
+                                               async_memcpy_event_t *event,
+                                               void *cb_args)
+{
+    (void)mcp;
+    (void)event;
+    (void)cb_args;
+    return display_flush_complete();
+}
+
+/**
+ * @brief Arrondit les zones invalidées à la pleine largeur (mode GDMA)
+ *
+ * Une bande pleine largeur est contiguë dans le framebuffer : une seule
+ * transaction GDMA par flush, alignée sur les lignes de cache.
+ */
+static void display_round_area_cb(lv_event_t *e)
+{
+    lv_area_t *area = lv_event_get_param(e);
+    area->x1 = 0;
+    area->x2 = DISPLAY_WIDTH - 1;
+}
+
+/**
+ * @brief Fusionne les zones invalidées avant le rendu de la trame
+ *
+ * LVGL n'a joint que les zones dont l'union coûte moins de pixels ; ici le
+ * coût fixe de chaque zone (parcours des widgets, flush) est pris en compte.
+ * refr_invalid_areas() a déjà repéré la dernière zone non jointe avant
+ * LV_EVENT_RENDER_START : la dernière zone fusionnée y est replacée pour que
+ * le drapeau de dernier flush reste juste.
+ */
+static void display_merge_areas_cb(lv_event_t *e)
+{
+    (void)e;
+    lv_area_t areas[LV_INV_BUF_SIZE];
+    size_t count = 0;
+    uint32_t last_i = 0;
+
+    for (uint32_t i = 0; i < display->inv_p; ++i) {
+        if (!display->inv_area_joined[i]) {
+            areas[count++] = display->inv_areas[i];
+            last_i = i;
+        }
+    }
+    if (count < 2) {
+        return;
+    }
+    size_t merged = display_area_merge(areas, count, area_merge_call_cost_px);
+    if (merged == count) {
+        return;
+    }
+
+    for (uint32_t i = 0; i <= last_i; ++i) {
+        display->inv_area_joined[i] = 1;
+    }
+    for (size_t i = 0; i + 1 < merged; ++i) {
+        display->inv_areas[i] = areas[i];
+        display->inv_area_joined[i] = 0;
+    }
+    display->inv_areas[last_i] = areas[merged - 1];
+    display->inv_area_joined[last_i] = 0;
+}
+
+/**
+ * @brief Flush GDMA : copie asynchrone de la bande vers le framebuffer PSRAM
+ *
+ * Le CPU rend la bande suivante dans l'autre tampon SRAM pendant la copie ;
+ * la fin de transfert libère LVGL depuis l'ISR du GDMA.
+ */
+static void display_flush_dma(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    uint8_t *dst = (uint8_t *)panel_fbs[0] +
+                   (size_t)area->y1 * DISPLAY_WIDTH * sizeof(lv_color_t);
+    size_t len = lv_area_get_size(area) * sizeof(lv_color_t);
+
+    /*
+     * Zone non arrondie (ne devrait pas arriver) ou hors des alignements du
+     * GDMA, que le driver refuserait : copie CPU
+     */
+    if (area->x1 != 0 || area->x2 != DISPLAY_WIDTH - 1 ||
+        (uintptr_t)dst % DISPLAY_DMA_BURST_BYTES || len % DISPLAY_DMA_BURST_BYTES ||
+        (uintptr_t)px_map % DISPLAY_DMA_SRAM_ALIGN) {
+        ESP_LOGD(TAG, "Copie CPU de la zone (%d,%d)->(%d,%d)",
+                 area->x1, area->y1, area->x2, area->y2);
+        esp_lcd_panel_draw_bitmap(panel_handle, area->x1, area->y1,
+                                  area->x2 + 1, area->y2 + 1, px_map);
+        lv_display_flush_ready(disp);
+        return;
+    }
+
+    /*
+     * Le framebuffer est derrière le cache de données : écrire les lignes
+     * sales et les invalider avant le transfert, pour qu'aucune éviction
+     * n'écrase la copie DMA et qu'aucune lecture CPU ne voie l'ancien contenu.
+     * La source est en SRAM interne, non cachée.
+     */
+    if (esp_cache_msync(dst, len, ESP_CACHE_MSYNC_FLAG_DIR_C2M |
+                                  ESP_CACHE_MSYNC_FLAG_INVALIDATE) != ESP_OK) {
+        ESP_LOGW(TAG, "esp_cache_msync failed");
+    }
+
+    flush_submitted = flush_submitted + 1;
+    if (esp_async_memcpy(dma_copier, dst, px_map, len,
+                         display_on_dma_copy_done, disp) != ESP_OK) {
+        ESP_LOGE(TAG, "esp_async_memcpy failed");
+        esp_lcd_panel_draw_bitmap(panel_handle, area->x1, area->y1,
+                                  area->x2 + 1, area->y2 + 1, px_map);
+        display_flush_complete();
+        if (!async_flush) {
+            display_flush_wait_cb(disp);
+        }
+        return;
+    }
+    if (!async_flush) {
+        display_flush_wait_cb(disp);
+    }
+}
+
+/**
+ * @brief Flush en mode direct : bascule de framebuffer sans copie
+ *
+ * LVGL a déjà rendu les zones invalidées dans le back buffer et recopié
+ * celles de la trame précédente (synchronisation des deux framebuffers).
+ * Seule la dernière zone de la trame déclenche la bascule, effective au
+ * prochain VSYNC pour éviter tout tearing ; c'est ce VSYNC qui libère LVGL.
+ */
+static void display_flush_direct(lv_display_t *disp, uint8_t *px_map)
+{
+    if (!lv_display_flush_is_last(disp)) {
+        lv_display_flush_ready(disp);
+        return;
+    }
+
+    flush_submitted = flush_submitted + 1;
+    /* px_map pointe dans un framebuffer du panneau : simple bascule d'index */
+    if (esp_lcd_panel_draw_bitmap(panel_handle, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT,
+                                  px_map) != ESP_OK) {
+        ESP_LOGE(TAG, "esp_lcd_panel_draw_bitmap failed");
+        display_flush_complete();
+        if (!async_flush) {
+            display_flush_wait_cb(disp);
+        }
+        return;
+    }
+    /*
+     * Armé après la demande : un VSYNC survenu entre-temps a déjà appliqué la
+     * bascule et le suivant libère LVGL, avec au pire une trame de retard.
+     */
+    swap_pending = true;
+    if (!async_flush) {
+        display_flush_wait_cb(disp);
+    }
+}
+
+static void display_compute_psram_budget(int64_t now, psram_budget_t *out)
+{
+    const psram_budget_input_t in = {
+        .psram_bandwidth_bps = (uint64_t)DISPLAY_PSRAM_BANDWIDTH_MBPS * 1000000ull,
+        .pclk_hz = panel_pclk_hz,
+        .bits_per_pixel = sizeof(lv_color_t) * 8,
+        .render_bytes = psram_render_bytes,
+        .window_us = (uint32_t)(now - psram_window_start_us),
+    };
+    psram_budget_compute(&in, out);
+}
+
+/**
+ * @brief Comptabilise le trafic PSRAM d'une zone flushée
+ *
+ * Mode direct : LVGL écrit les pixels dans le framebuffer. Mode partiel :
+ * écriture dans le tampon de rendu et relecture s'il est en PSRAM, puis
+ * écriture dans le framebuffer par draw_bitmap.
+ */
+static void display_account_psram(const lv_area_t *area)
+{
+    uint64_t bytes = (uint64_t)lv_area_get_size(area) * sizeof(lv_color_t);
+    if (render_mode == DISPLAY_RENDER_MODE_PARTIAL) {
+        bytes *= draw_bufs_in_psram ? 3 : 1;
+    }
+    psram_render_bytes += bytes;
+
+    int64_t now = esp_timer_get_time();
+    if (now - psram_window_start_us < (int64_t)DISPLAY_PSRAM_BUDGET_WINDOW_MS * 1000) {
+        return;
+    }
+    if (log_psram_budget) {
+        psram_budget_t budget;
+        display_compute_psram_budget(now, &budget);
+        psram_budget_log(TAG, &budget);
+    }
+    psram_render_bytes = 0;
+    psram_window_start_us = now;
+}
 
 static void display_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
 {
+    display_account_psram(area);
+
+    if (render_mode == DISPLAY_RENDER_MODE_DIRECT) {
+        display_flush_direct(disp, px_map);
+        return;
+    }
+    if (render_mode == DISPLAY_RENDER_MODE_PARTIAL_DMA) {
+        display_flush_dma(disp, area, px_map);
+        return;
+    }
+
+    if (async_flush) {
+        flush_submitted = flush_submitted + 1;
+        pending_area = *area;
+        pending_px_map = px_map;
+        pending_last = lv_display_flush_is_last(disp);
+        xSemaphoreGive(flush_req_sem);
+        return;
+    }
+
     int32_t w = area->x2 - area->x1 + 1;
     int32_t h = area->y2 - area->y1 + 1;
     int64_t start = esp_timer_get_time();
     ESP_LOGD(TAG, "flush start (%d,%d)->(%d,%d) size %dx%d",
              area->x1, area->y1, area->x2, area->y2, w, h);
-    if (esp_lcd_panel_draw_bitmap(panel_handle, area->x1, area->y1,
-                                  area->x2 + 1, area->y2 + 1, px_map) == ESP_OK) {
-        /* nothing */
-    } else {
+    if (display_copy_area(area, px_map, lv_display_flush_is_last(disp)) != ESP_OK) {
         ESP_LOGE(TAG, "esp_lcd_panel_draw_bitmap failed");
     }
     lv_display_flush_ready(disp);
@@ -38,49 +515,373 @@ static void display_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t
              (long long)(end - start));
 }
 
+/**
+ * @brief Démarre la mesure du trafic PSRAM et journalise le bilan de boot
+ */
+static void display_start_psram_budget(void)
+{
+    psram_render_bytes = 0;
+    psram_window_start_us = esp_timer_get_time();
+    if (log_psram_budget) {
+        /* Au boot seul le balayage consomme : marge disponible pour le rendu */
+        psram_budget_t budget;
+        display_compute_psram_budget(psram_window_start_us, &budget);
+        psram_budget_log(TAG, &budget);
+    }
+}
+
+/**
+ * @brief Prépare le double framebuffer du panneau pour le mode direct
+ * @return esp_err_t Code d'erreur ESP
+ */
+static esp_err_t display_setup_direct_buffers(void)
+{
+    esp_err_t ret = esp_lcd_rgb_panel_get_frame_buffer(panel_handle, 2,
+                                                       &panel_fbs[0], &panel_fbs[1]);
+    if (ret != ESP_OK || !panel_fbs[0] || !panel_fbs[1]) {
+        ESP_LOGE(TAG, "Framebuffers du panneau indisponibles");
+        return ret != ESP_OK ? ret : ESP_ERR_NO_MEM;
+    }
+    draw_bufs_in_psram = true;
+    draw_buf_lines = DISPLAY_HEIGHT;
+    return ESP_OK;
+}
+
+/**
+ * @brief Prépare les bandes SRAM interne et le moteur GDMA (mode GDMA)
+ * @param stripe_lines Hauteur d'une bande en lignes
+ * @return esp_err_t Code d'erreur ESP
+ */
+static esp_err_t display_setup_dma_buffers(uint16_t stripe_lines)
+{
+    esp_err_t ret = esp_lcd_rgb_panel_get_frame_buffer(panel_handle, 1, &panel_fbs[0]);
+    if (ret != ESP_OK || !panel_fbs[0]) {
+        ESP_LOGE(TAG, "Framebuffer du panneau indisponible");
+        return ret != ESP_OK ? ret : ESP_ERR_NO_MEM;
+    }
+
+    size_t stripe_bytes = (size_t)stripe_lines * DISPLAY_WIDTH * sizeof(lv_color_t);
+    buf1 = heap_caps_malloc(stripe_bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    buf2 = heap_caps_malloc(stripe_bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    if (!buf1 || !buf2) {
+        ESP_LOGE(TAG, "Bandes SRAM interne (2 x %u octets) indisponibles",
+                 (unsigned)stripe_bytes);
+        return ESP_ERR_NO_MEM;
+    }
+    draw_bufs_in_psram = false;
+    draw_buf_lines = stripe_lines;
+
+    async_memcpy_config_t cfg = ASYNC_MEMCPY_DEFAULT_CONFIG();
+    cfg.backlog = DISPLAY_DMA_BACKLOG;
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 4, 0)
+    cfg.dma_burst_size = DISPLAY_DMA_BURST_BYTES;
+#else
+    cfg.sram_trans_align = DISPLAY_DMA_SRAM_ALIGN;
+    cfg.psram_trans_align = DISPLAY_DMA_BURST_BYTES;
+#endif
+    ret = esp_async_memcpy_install(&cfg, &dma_copier);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "esp_async_memcpy_install failed: %d", ret);
+        dma_copier = NULL;
+    }
+    return ret;
+}
+
+static void display_uninstall_dma(void)
+{
+    if (dma_copier) {
+        esp_async_memcpy_uninstall(dma_copier);
+        dma_copier = NULL;
+    }
+}
+
+static size_t display_draw_buf_bytes(uint16_t lines)
+{
+    return (size_t)lines * DISPLAY_WIDTH * sizeof(lv_color_t);
+}
+
+/**
+ * @brief Alloue les deux tampons de rendu du mode partiel
+ * @param lines Hauteur de chaque tampon en lignes
+ * @param psram true pour la PSRAM, false pour la SRAM interne
+ * @param[out] b1 Premier tampon
+ * @param[out] b2 Second tampon
+ * @return esp_err_t ESP_ERR_NO_MEM si l'un des deux manque (aucun n'est conservé)
+ */
+static esp_err_t display_alloc_draw_buffers(uint16_t lines, bool psram,
+                                            lv_color_t **b1, lv_color_t **b2)
+{
+    size_t bytes = display_draw_buf_bytes(lines);
+    uint32_t caps = (psram ? MALLOC_CAP_SPIRAM : MALLOC_CAP_INTERNAL) | MALLOC_CAP_DMA;
+    *b1 = heap_caps_malloc(bytes, caps);
+    *b2 = heap_caps_malloc(bytes, caps);
+    if (!*b1 || !*b2) {
+        if (*b1) { heap_caps_free(*b1); *b1 = NULL; }
+        if (*b2) { heap_caps_free(*b2); *b2 = NULL; }
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Crée l'affichage LVGL sur les tampons fournis
+ * @return esp_err_t Code d'erreur ESP
+ */
+static esp_err_t display_create_lv_display(void *b1, void *b2, size_t size_in_bytes,
+                                           lv_display_render_mode_t mode)
+{
+    display = lv_display_create(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    if (!display) {
+        ESP_LOGE(TAG, "lv_display_create failed");
+        return ESP_ERR_NO_MEM;
+    }
+    lv_display_set_default(display);
+    lv_display_set_flush_cb(display, display_flush_cb);
+    lv_display_set_buffers(display, b1, b2, size_in_bytes, mode);
+    if (area_merge_call_cost_px) {
+        lv_display_add_event_cb(display, display_merge_areas_cb, LV_EVENT_RENDER_START, NULL);
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Branche les complétions du panneau sur LVGL
+ *
+ * Doit être appelé une fois l'affichage LVGL créé : il sert de contexte aux
+ * callbacks. La tâche de copie n'est créée qu'en mode partiel asynchrone ;
+ * en mode GDMA c'est le moteur de copie qui signale la fin de transfert.
+ * @return esp_err_t Code d'erreur ESP
+ */
+static esp_err_t display_setup_flush_completion(void)
+{
+    flush_done_sem = xSemaphoreCreateBinary();
+    if (!flush_done_sem) {
+        ESP_LOGE(TAG, "Flush semaphore alloc failed");
+        return ESP_ERR_NO_MEM;
+    }
+
+    const esp_lcd_rgb_panel_event_callbacks_t cbs = {
+        .on_color_trans_done = async_flush && render_mode == DISPLAY_RENDER_MODE_PARTIAL ?
+                               display_on_color_trans_done : NULL,
+        .on_vsync = render_mode == DISPLAY_RENDER_MODE_DIRECT || scanline_sync ?
+                    display_on_vsync : NULL,
+    };
+    esp_err_t ret = esp_lcd_rgb_panel_register_event_callbacks(panel_handle, &cbs, display);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Panel callback registration failed: %d", ret);
+        return ret;
+    }
+
+    if (!async_flush) {
+        return ESP_OK;
+    }
+    lv_display_set_flush_wait_cb(display, display_flush_wait_cb);
+    if (render_mode != DISPLAY_RENDER_MODE_PARTIAL) {
+        return ESP_OK;
+    }
+
+    flush_req_sem = xSemaphoreCreateBinary();
+    flush_task_exit_sem = xSemaphoreCreateBinary();
+    if (!flush_req_sem || !flush_task_exit_sem) {
+        ESP_LOGE(TAG, "Flush task semaphore alloc failed");
+        return ESP_ERR_NO_MEM;
+    }
+    flush_task_stop = false;
+    if (xTaskCreatePinnedToCore(display_flush_task, "display_flush",
+                                DISPLAY_FLUSH_TASK_STACK, NULL,
+                                DISPLAY_FLUSH_TASK_PRIORITY, &flush_task,
+                                DISPLAY_FLUSH_TASK_CORE) != pdPASS) {
+        ESP_LOGE(TAG, "Flush task creation failed");
+        flush_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Libère la tâche de copie et les sémaphores de complétion
+ *
+ * Appelé après la suppression de l'affichage LVGL (plus aucun flush) et
+ * avant celle du panneau.
+ */
+static void display_stop_flush_task(void)
+{
+    if (flush_task) {
+        flush_task_stop = true;
+        xSemaphoreGive(flush_req_sem);
+        xSemaphoreTake(flush_task_exit_sem, portMAX_DELAY);
+        flush_task = NULL;
+    }
+}
+
+static void display_delete_flush_sems(void)
+{
+    if (flush_req_sem) {
+        vSemaphoreDelete(flush_req_sem);
+        flush_req_sem = NULL;
+    }
+    if (flush_task_exit_sem) {
+        vSemaphoreDelete(flush_task_exit_sem);
+        flush_task_exit_sem = NULL;
+    }
+    if (flush_done_sem) {
+        vSemaphoreDelete(flush_done_sem);
+        flush_done_sem = NULL;
+    }
+    swap_pending = false;
+    vsync_seen = false;
+    flush_submitted = 0;
+    flush_completed = 0;
+    flush_abandoned = 0;
+    flush_released = 0;
+}
+
 esp_err_t display_driver_init(void)
 {
-    esp_err_t ret = st7701_rgb_new_panel(&panel_handle);
+    const display_driver_config_t config = DISPLAY_DRIVER_DEFAULT_CONFIG();
+    return display_driver_init_with_config(&config);
+}
+
+esp_err_t display_driver_init_with_config(const display_driver_config_t *config)
+{
+    if (!config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (config->bounce_buffer_lines &&
+        DISPLAY_HEIGHT % config->bounce_buffer_lines != 0) {
+        ESP_LOGE(TAG, "Bounce buffer de %u lignes : doit diviser %d",
+                 config->bounce_buffer_lines, DISPLAY_HEIGHT);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (config->render_mode == DISPLAY_RENDER_MODE_PARTIAL_DMA &&
+        (config->bounce_buffer_lines || config->dma_stripe_lines == 0)) {
+        /* Avec bounce buffers le balayage lit le framebuffer via le cache */
+        ESP_LOGE(TAG, "Mode GDMA : bandes non nulles et bounce buffers désactivés requis");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (config->render_mode == DISPLAY_RENDER_MODE_PARTIAL &&
+        (config->draw_buf_lines == 0 || config->draw_buf_lines > DISPLAY_HEIGHT)) {
+        ESP_LOGE(TAG, "Tampons de rendu de %u lignes : 1 à %d attendues",
+                 config->draw_buf_lines, DISPLAY_HEIGHT);
+        return ESP_ERR_INVALID_ARG;
+    }
+    render_mode = config->render_mode;
+    async_flush = config->async_flush;
+    log_psram_budget = config->log_psram_budget;
+    area_merge_call_cost_px = config->area_merge_call_cost_px;
+    /* Seul le mode partiel copie dans le framebuffer en cours de balayage */
+    scanline_sync = config->scanline_sync && render_mode == DISPLAY_RENDER_MODE_PARTIAL;
+    /* Les bounce buffers lisent le framebuffer jusqu'à deux tranches en avance */
+    scanline_guard_lines = DISPLAY_SCANLINE_GUARD_LINES + 2 * config->bounce_buffer_lines;
+    copy_ns_per_px = DISPLAY_SCANLINE_COPY_NS_PER_PX;
+    frame_wait_us = 0;
+    scanline_stats = (display_scanline_stats_t){0};
+
+    st7701_rgb_config_t panel_config = ST7701_RGB_DEFAULT_CONFIG();
+    if (render_mode == DISPLAY_RENDER_MODE_DIRECT) {
+        panel_config.num_fbs = 2;
+    }
+    panel_config.bounce_buffer_size_px = (size_t)config->bounce_buffer_lines * DISPLAY_WIDTH;
+    panel_config.defer_init = config->defer_panel_start;
+    panel_pclk_hz = panel_config.pclk_hz;
+    esp_err_t ret = st7701_rgb_new_panel_with_config(&panel_config, &panel_handle);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to init panel: %d", ret);
         goto cleanup;
     }
 
-    ch422g_set_pin(EXIO2, true);
-    size_t buf_pixels = DISPLAY_BUF_SIZE;
-    buf1 = heap_caps_malloc(buf_pixels * sizeof(lv_color_t),
-                            MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA);
-    buf2 = heap_caps_malloc(buf_pixels * sizeof(lv_color_t),
-                            MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA);
-    if (!buf1 || !buf2) {
-        if (buf1) { heap_caps_free(buf1); buf1 = NULL; }
-        if (buf2) { heap_caps_free(buf2); buf2 = NULL; }
-        ESP_LOGW(TAG, "PSRAM alloc failed, falling back to internal RAM");
-        buf_pixels = (DISPLAY_WIDTH * DISPLAY_HEIGHT) / 6;
-        buf1 = heap_caps_malloc(buf_pixels * sizeof(lv_color_t),
-                                MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
-        buf2 = heap_caps_malloc(buf_pixels * sizeof(lv_color_t),
-                                MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
-        if (!buf1 || !buf2) {
-            if (buf1) { heap_caps_free(buf1); buf1 = NULL; }
-            if (buf2) { heap_caps_free(buf2); buf2 = NULL; }
-            ESP_LOGE(TAG, "Buffer alloc failed");
-            ret = ESP_ERR_NO_MEM;
+    if (!config->defer_panel_start) {
+        ch422g_set_pin(EXIO2, true);
+    }
+
+    if (render_mode == DISPLAY_RENDER_MODE_DIRECT) {
+        ret = display_setup_direct_buffers();
+        if (ret != ESP_OK) {
+            goto cleanup;
+        }
+        ret = display_create_lv_display(panel_fbs[0], panel_fbs[1],
+                                        DISPLAY_WIDTH * DISPLAY_HEIGHT * sizeof(lv_color_t),
+                                        LV_DISPLAY_RENDER_MODE_DIRECT);
+        if (ret != ESP_OK) {
+            goto cleanup;
+        }
+        ret = display_setup_flush_completion();
+        if (ret != ESP_OK) {
             goto cleanup;
         }
+        display_start_psram_budget();
+        ESP_LOGI(TAG, "Display driver initialized (direct, double framebuffer, %s flush)",
+                 async_flush ? "async" : "sync");
+        return ESP_OK;
     }
-    display = lv_display_create(DISPLAY_WIDTH, DISPLAY_HEIGHT);
-    if (!display) {
-        ESP_LOGE(TAG, "lv_display_create failed");
-        ret = ESP_ERR_NO_MEM;
+
+    if (render_mode == DISPLAY_RENDER_MODE_PARTIAL_DMA) {
+        ret = display_setup_dma_buffers(config->dma_stripe_lines);
+        if (ret != ESP_OK) {
+            goto cleanup;
+        }
+        ret = display_create_lv_display(buf1, buf2,
+                                        (size_t)config->dma_stripe_lines * DISPLAY_WIDTH *
+                                        sizeof(lv_color_t),
+                                        LV_DISPLAY_RENDER_MODE_PARTIAL);
+        if (ret != ESP_OK) {
+            goto cleanup;
+        }
+        lv_display_add_event_cb(display, display_round_area_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+        ret = display_setup_flush_completion();
+        if (ret != ESP_OK) {
+            goto cleanup;
+        }
+        display_start_psram_budget();
+        ESP_LOGI(TAG, "Display driver initialized (partial, GDMA %u-line stripes, %s flush)",
+                 config->dma_stripe_lines, async_flush ? "async" : "sync");
+        return ESP_OK;
+    }
+
+    /* Choix demandé (éventuellement calibré), puis défaut PSRAM, puis repli en SRAM interne */
+    const struct {
+        uint16_t lines;
+        bool psram;
+    } attempts[] = {
+        {config->draw_buf_lines, config->draw_buf_psram},
+        {DISPLAY_BUF_LINES, true},
+        {DISPLAY_BUF_FALLBACK_LINES, false},
+    };
+    uint16_t buf_lines = 0;
+    bool buf_psram = false;
+    ret = ESP_ERR_NO_MEM;
+    for (size_t i = 0; i < sizeof(attempts) / sizeof(attempts[0]) && ret != ESP_OK; ++i) {
+        if (i > 0 && attempts[i].lines == buf_lines && attempts[i].psram == buf_psram) {
+            continue;
+        }
+        if (i > 0) {
+            ESP_LOGW(TAG, "%s alloc failed (2 x %u lines), falling back to %s",
+                     buf_psram ? "PSRAM" : "Internal RAM", buf_lines,
+                     attempts[i].psram ? "PSRAM" : "internal RAM");
+        }
+        buf_lines = attempts[i].lines;
+        buf_psram = attempts[i].psram;
+        ret = display_alloc_draw_buffers(buf_lines, buf_psram, &buf1, &buf2);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Buffer alloc failed");
         goto cleanup;
     }
-    lv_display_set_default(display);
-    lv_display_set_flush_cb(display, display_flush_cb);
-    lv_display_set_buffers(display, buf1, buf2,
-                           buf_pixels * sizeof(lv_color_t),
-                           LV_DISPLAY_RENDER_MODE_PARTIAL);
-    ESP_LOGI(TAG, "Display driver initialized");
+    draw_buf_lines = buf_lines;
+    draw_bufs_in_psram = buf_psram;
+    ret = display_create_lv_display(buf1, buf2, display_draw_buf_bytes(buf_lines),
+                                    LV_DISPLAY_RENDER_MODE_PARTIAL);
+    if (ret != ESP_OK) {
+        goto cleanup;
+    }
+    ret = display_setup_flush_completion();
+    if (ret != ESP_OK) {
+        goto cleanup;
+    }
+    display_start_psram_budget();
+    ESP_LOGI(TAG, "Display driver initialized (partial, 2 x %u lines in %s, %s flush%s)",
+             draw_buf_lines, draw_bufs_in_psram ? "PSRAM" : "SRAM", async_flush ? "async" : "sync",
+             scanline_sync ? ", scanline sync" : "");
     return ESP_OK;
 
 cleanup:
@@ -88,6 +889,8 @@ cleanup:
         lv_display_delete(display);
         display = NULL;
     }
+    display_stop_flush_task();
+    display_uninstall_dma();
     if (buf1) {
         heap_caps_free(buf1);
         buf1 = NULL;
@@ -101,6 +904,9 @@ cleanup:
         esp_lcd_panel_del(panel_handle);
         panel_handle = NULL;
     }
+    panel_fbs[0] = NULL;
+    panel_fbs[1] = NULL;
+    display_delete_flush_sems();
     ch422g_set_pin(EXIO2, false);
     ch422g_deinit();
     return ret;
@@ -112,6 +918,8 @@ void display_driver_deinit(void)
         lv_display_delete(display);
         display = NULL;
     }
+    display_stop_flush_task();
+    display_uninstall_dma();
     ch422g_set_pin(EXIO2, false);
     if (buf1) {
         heap_caps_free(buf1);
@@ -126,9 +934,147 @@ void display_driver_deinit(void)
         esp_lcd_panel_del(panel_handle);
         panel_handle = NULL;
     }
+    /* Les framebuffers sont libérés avec le panneau */
+    panel_fbs[0] = NULL;
+    panel_fbs[1] = NULL;
+    display_delete_flush_sems();
     ESP_LOGI(TAG, "Display driver deinit");
 }
 
+esp_err_t display_driver_start_panel(void)
+{
+    if (!panel_handle) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_err_t ret = st7701_rgb_panel_start(panel_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Séquence ST7701 échouée: %d", ret);
+        return ret;
+    }
+    return ch422g_set_pin(EXIO2, true);
+}
+
+display_render_mode_t display_driver_get_render_mode(void)
+{
+    return render_mode;
+}
+
+esp_err_t display_driver_set_draw_buffers(uint16_t lines, bool psram)
+{
+    if (lines == 0 || lines > DISPLAY_HEIGHT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!display || render_mode != DISPLAY_RENDER_MODE_PARTIAL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (lines == draw_buf_lines && psram == draw_bufs_in_psram) {
+        return ESP_OK;
+    }
+
+    lv_color_t *new1 = NULL;
+    lv_color_t *new2 = NULL;
+    esp_err_t ret = display_alloc_draw_buffers(lines, psram, &new1, &new2);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Tampons de 2 x %u lignes en %s indisponibles", lines,
+                 psram ? "PSRAM" : "SRAM");
+        return ret;
+    }
+    /* La dernière zone de la trame peut encore être lue depuis l'ancien tampon */
+    display_driver_wait_flush_idle();
+    lv_display_set_buffers(display, new1, new2, display_draw_buf_bytes(lines),
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    heap_caps_free(buf1);
+    heap_caps_free(buf2);
+    buf1 = new1;
+    buf2 = new2;
+    draw_buf_lines = lines;
+    draw_bufs_in_psram = psram;
+    ESP_LOGI(TAG, "Tampons de rendu : 2 x %u lignes en %s", lines, psram ? "PSRAM" : "SRAM");
+    return ESP_OK;
+}
+
+esp_err_t display_driver_get_draw_buffers(uint16_t *lines, bool *psram)
+{
+    if (!display) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (lines) {
+        *lines = draw_buf_lines;
+    }
+    if (psram) {
+        *psram = draw_bufs_in_psram;
+    }
+    return ESP_OK;
+}
+
+void display_driver_wait_flush_idle(void)
+{
+    /* En flush synchrone les compteurs restent égaux : retour immédiat */
+    if (display && flush_done_sem) {
+        display_flush_wait_cb(display);
+    }
+}
+
+esp_err_t display_driver_set_pclk(uint32_t pclk_hz)
+{
+    if (pclk_hz < DISPLAY_PCLK_MIN_HZ || pclk_hz > ST7701_RGB_PCLK_HZ_DEFAULT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!panel_handle) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (pclk_hz == panel_pclk_hz) {
+        return ESP_OK;
+    }
+    esp_err_t ret = esp_lcd_rgb_panel_set_pclk(panel_handle, pclk_hz);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "esp_lcd_rgb_panel_set_pclk failed: %d", ret);
+        return ret;
+    }
+    panel_pclk_hz = pclk_hz;
+    return ESP_OK;
+}
+
+uint32_t display_driver_get_pclk(void)
+{
+    return panel_handle ? panel_pclk_hz : 0;
+}
+
+esp_err_t display_driver_get_psram_budget(psram_budget_t *out)
+{
+    if (!out) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!display) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    display_compute_psram_budget(esp_timer_get_time(), out);
+    return ESP_OK;
+}
+
+esp_err_t display_driver_get_scanline_stats(display_scanline_stats_t *out)
+{
+    if (!out) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!display || !scanline_sync) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    *out = scanline_stats;
+    out->mean_frame_wait_us = out->frames ? (uint32_t)(out->total_wait_us / out->frames) : 0;
+    out->copy_ns_per_px = copy_ns_per_px;
+    display_scanline_timing_t timing;
+    display_scanline_timing(&timing);
+    out->frame_us = display_scanline_frame_us(&timing);
+    return ESP_OK;
+}
+
+void display_driver_reset_scanline_stats(void)
+{
+    scanline_stats = (display_scanline_stats_t){0};
+    frame_wait_us = 0;
+}
+
 void display_set_brightness(uint8_t brightness)
 {
     ch422g_set_pin(EXIO2, brightness > 0);
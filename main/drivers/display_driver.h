@@ -12,6 +12,8 @@
 #include "esp_err.h"
 #include "lvgl.h"
 #include "esp_heap_caps.h"
+#include "psram_budget.h"
+#include "display_scanline.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,12 +34,275 @@ extern "C" {
 #define DISPLAY_BUF_SIZE (DISPLAY_WIDTH * DISPLAY_HEIGHT / 6)
 #endif
 
+/** Hauteur par défaut des tampons de rendu du mode partiel (lignes) */
+#define DISPLAY_BUF_LINES (DISPLAY_BUF_SIZE / DISPLAY_WIDTH)
+
+/** Hauteur des tampons en SRAM interne lorsque la PSRAM est indisponible */
+#define DISPLAY_BUF_FALLBACK_LINES (DISPLAY_HEIGHT / 6)
+
+/** Délai maximal d'attente d'une fin de copie ou d'un VSYNC avant de libérer LVGL */
+#define DISPLAY_FLUSH_TIMEOUT_MS 100
+
+/*
+ * Horloge pixel minimale acceptée à l'exécution : 12 MHz donnent une trame
+ * de balayage de 72 ms, sous DISPLAY_FLUSH_TIMEOUT_MS (attente VSYNC du mode
+ * direct). En dessous le panneau scintille de toute façon.
+ */
+#define DISPLAY_PCLK_MIN_HZ (12 * 1000 * 1000)
+
+/* Tâche de copie du flush asynchrone (cœur 0, LVGL tourne sur le cœur 1) */
+#define DISPLAY_FLUSH_TASK_STACK    3072
+#define DISPLAY_FLUSH_TASK_PRIORITY 6
+#define DISPLAY_FLUSH_TASK_CORE     0
+
+#if CONFIG_NOVA_DISPLAY_ASYNC_FLUSH
+#define DISPLAY_ASYNC_FLUSH_DEFAULT true
+#else
+#define DISPLAY_ASYNC_FLUSH_DEFAULT false
+#endif
+
+/* Hauteur des bandes SRAM interne du mode GDMA (2 bandes de 2 Kio par ligne) */
+#ifdef CONFIG_NOVA_DISPLAY_DMA_STRIPE_LINES
+#define DISPLAY_DMA_STRIPE_LINES CONFIG_NOVA_DISPLAY_DMA_STRIPE_LINES
+#else
+#define DISPLAY_DMA_STRIPE_LINES 20
+#endif
+
+/** Transactions GDMA en attente au plus (une en vol, une en préparation) */
+#define DISPLAY_DMA_BACKLOG 2
+
+/*
+ * Rafale GDMA vers la PSRAM (octets) : adresse et longueur de destination en
+ * sont des multiples, ce qui couvre aussi la ligne de cache. La source en
+ * SRAM interne doit être alignée sur le mot.
+ */
+#define DISPLAY_DMA_BURST_BYTES    64
+#define DISPLAY_DMA_SRAM_ALIGN     4
+
+/*
+ * Bounce buffers en SRAM interne pour le balayage RGB (en lignes, 0 = aucun) :
+ * le GDMA lit la SRAM pendant que le CPU recopie la tranche suivante depuis
+ * le framebuffer PSRAM, ce qui rend le balayage insensible à la contention.
+ */
+#ifdef CONFIG_NOVA_DISPLAY_BOUNCE_BUFFER_LINES
+#define DISPLAY_BOUNCE_BUFFER_LINES CONFIG_NOVA_DISPLAY_BOUNCE_BUFFER_LINES
+#else
+#define DISPLAY_BOUNCE_BUFFER_LINES 0
+#endif
+
+/** Coût fixe d'un flush en pixels pour la fusion des zones invalidées (0 = désactivée) */
+#ifdef CONFIG_NOVA_DISPLAY_AREA_MERGE_CALL_COST
+#define DISPLAY_AREA_MERGE_CALL_COST_PX CONFIG_NOVA_DISPLAY_AREA_MERGE_CALL_COST
+#else
+#define DISPLAY_AREA_MERGE_CALL_COST_PX 2000
+#endif
+
+#if CONFIG_NOVA_DISPLAY_PSRAM_BUDGET
+#define DISPLAY_LOG_PSRAM_BUDGET true
+#else
+#define DISPLAY_LOG_PSRAM_BUDGET false
+#endif
+
+/** Débit PSRAM exploitable retenu pour le bilan de bande passante */
+#ifdef CONFIG_NOVA_DISPLAY_PSRAM_BANDWIDTH_MBPS
+#define DISPLAY_PSRAM_BANDWIDTH_MBPS CONFIG_NOVA_DISPLAY_PSRAM_BANDWIDTH_MBPS
+#else
+#define DISPLAY_PSRAM_BANDWIDTH_MBPS 120
+#endif
+
+/** Période de journalisation du bilan PSRAM */
+#ifdef CONFIG_NOVA_DISPLAY_PSRAM_BUDGET_WINDOW_MS
+#define DISPLAY_PSRAM_BUDGET_WINDOW_MS CONFIG_NOVA_DISPLAY_PSRAM_BUDGET_WINDOW_MS
+#else
+#define DISPLAY_PSRAM_BUDGET_WINDOW_MS 10000
+#endif
+
+#if CONFIG_NOVA_DISPLAY_SCANLINE_SYNC
+#define DISPLAY_SCANLINE_SYNC_DEFAULT true
+#else
+#define DISPLAY_SCANLINE_SYNC_DEFAULT false
+#endif
+
+/*
+ * Marge autour d'une zone synchronisée sur le balayage (lignes) : latence de
+ * l'interruption VSYNC et incertitude sur sa position dans le blanking
+ */
+#define DISPLAY_SCANLINE_GUARD_LINES 4
+
+/** Coût initial de la copie CPU d'un pixel, affiné ensuite par mesure (ns) */
+#define DISPLAY_SCANLINE_COPY_NS_PER_PX 50
+
+/**
+ * @brief Mode de rendu LVGL vers le framebuffer du panneau
+ */
+typedef enum {
+    DISPLAY_RENDER_MODE_PARTIAL = 0, /**< Tampons de rendu + copie dans le framebuffer */
+    DISPLAY_RENDER_MODE_DIRECT,      /**< Rendu dans deux framebuffers PSRAM, bascule sur VSYNC */
+    DISPLAY_RENDER_MODE_PARTIAL_DMA, /**< Bandes pleine largeur en SRAM interne, copie GDMA */
+} display_render_mode_t;
+
+#if CONFIG_NOVA_DISPLAY_RENDER_DIRECT
+#define DISPLAY_RENDER_MODE_DEFAULT DISPLAY_RENDER_MODE_DIRECT
+#elif CONFIG_NOVA_DISPLAY_RENDER_PARTIAL_DMA
+#define DISPLAY_RENDER_MODE_DEFAULT DISPLAY_RENDER_MODE_PARTIAL_DMA
+#else
+#define DISPLAY_RENDER_MODE_DEFAULT DISPLAY_RENDER_MODE_PARTIAL
+#endif
+
+/**
+ * @brief Configuration du driver d'affichage
+ */
+typedef struct {
+    display_render_mode_t render_mode; /**< Mode de rendu LVGL */
+    bool async_flush;                  /**< Libérer LVGL depuis les callbacks de fin de transfert */
+    uint16_t draw_buf_lines;           /**< Hauteur des tampons de rendu du mode partiel */
+    bool draw_buf_psram;               /**< Tampons du mode partiel en PSRAM (sinon SRAM interne) */
+    uint16_t dma_stripe_lines;         /**< Hauteur des bandes du mode GDMA */
+    uint16_t bounce_buffer_lines;      /**< Hauteur des bounce buffers (0 = désactivés) */
+    uint32_t area_merge_call_cost_px;  /**< Coût fixe d'un flush pour la fusion des zones (0 = désactivée) */
+    bool log_psram_budget;             /**< Journaliser le bilan PSRAM au boot puis périodiquement */
+    bool defer_panel_start;            /**< Séquence ST7701 et rétroéclairage laissés à display_driver_start_panel() */
+    bool scanline_sync;                /**< Mode partiel : copies décalées hors du passage du balayage */
+} display_driver_config_t;
+
+/**
+ * @brief Mesures de la synchronisation des copies sur le balayage
+ *
+ * L'attente ajoutée par trame se compare à la bascule du mode direct, qui
+ * attend le VSYNC suivant : une demi-période en moyenne, une au pire.
+ */
+typedef struct {
+    uint32_t areas;              /**< Zones copiées depuis la remise à zéro */
+    uint32_t delayed;            /**< Zones retardées pour laisser passer le balayage */
+    uint32_t unavoidable;        /**< Zones trop hautes, copiées sans fenêtre sûre */
+    uint32_t frames;             /**< Trames terminées (dernière zone copiée) */
+    uint64_t total_wait_us;      /**< Attente cumulée */
+    uint32_t mean_frame_wait_us; /**< Attente moyenne ajoutée à une trame */
+    uint32_t max_frame_wait_us;  /**< Pire attente ajoutée à une trame */
+    uint32_t copy_ns_per_px;     /**< Coût de copie estimé */
+    uint32_t frame_us;           /**< Période de balayage courante */
+} display_scanline_stats_t;
+
+/**
+ * @brief Configuration par défaut (issue de menuconfig)
+ */
+#define DISPLAY_DRIVER_DEFAULT_CONFIG() {                        \
+    .render_mode = DISPLAY_RENDER_MODE_DEFAULT,                  \
+    .async_flush = DISPLAY_ASYNC_FLUSH_DEFAULT,                  \
+    .draw_buf_lines = DISPLAY_BUF_LINES,                         \
+    .draw_buf_psram = true,                                      \
+    .dma_stripe_lines = DISPLAY_DMA_STRIPE_LINES,                \
+    .bounce_buffer_lines = DISPLAY_BOUNCE_BUFFER_LINES,          \
+    .area_merge_call_cost_px = DISPLAY_AREA_MERGE_CALL_COST_PX,  \
+    .log_psram_budget = DISPLAY_LOG_PSRAM_BUDGET,                \
+    .defer_panel_start = false,                                  \
+    .scanline_sync = DISPLAY_SCANLINE_SYNC_DEFAULT,              \
+}
+
 /**
  * @brief Initialise le driver d'affichage ST7701
  * @return esp_err_t Code d'erreur ESP
  */
 esp_err_t display_driver_init(void);
 
+/**
+ * @brief Initialise le driver d'affichage avec une configuration explicite
+ * @param config Configuration du driver
+ * @return esp_err_t Code d'erreur ESP
+ */
+esp_err_t display_driver_init_with_config(const display_driver_config_t *config);
+
+/**
+ * @brief Démarre un panneau initialisé avec defer_panel_start
+ *
+ * Envoie la séquence de commandes ST7701 (environ 360 ms de délais imposés)
+ * puis allume le rétroéclairage. L'affichage LVGL existe déjà : l'interface
+ * peut être construite depuis une autre tâche pendant ce temps. Sans effet
+ * si le panneau est déjà démarré.
+ * @return esp_err_t ESP_ERR_INVALID_STATE si le driver n'est pas initialisé
+ */
+esp_err_t display_driver_start_panel(void);
+
+/**
+ * @brief Mode de rendu effectivement utilisé par le driver
+ * @return display_render_mode_t Mode courant
+ */
+display_render_mode_t display_driver_get_render_mode(void);
+
+/**
+ * @brief Remplace les tampons de rendu du mode partiel
+ *
+ * Les nouveaux tampons sont alloués avant la libération des anciens : en
+ * cas d'échec l'affichage continue sur les tampons courants. Le flush en
+ * cours est attendu avant la bascule. À appeler avec le verrou LVGL pris,
+ * hors rendu (tâche LVGL).
+ * @param lines Hauteur de chaque tampon en lignes (1 à DISPLAY_HEIGHT)
+ * @param psram true pour la PSRAM, false pour la SRAM interne DMA
+ * @return esp_err_t ESP_ERR_INVALID_STATE hors mode partiel, ESP_ERR_NO_MEM
+ *         si l'allocation échoue
+ */
+esp_err_t display_driver_set_draw_buffers(uint16_t lines, bool psram);
+
+/**
+ * @brief Tampons de rendu effectivement utilisés
+ * @param[out] lines Hauteur des tampons en lignes (peut être NULL)
+ * @param[out] psram true si les tampons sont en PSRAM (peut être NULL)
+ * @return esp_err_t ESP_ERR_INVALID_STATE si le driver n'est pas initialisé
+ */
+esp_err_t display_driver_get_draw_buffers(uint16_t *lines, bool *psram);
+
+/**
+ * @brief Attend la fin du flush en cours
+ *
+ * lv_refr_now() peut rendre la main alors que la dernière zone de la trame
+ * est encore en cours de copie (flush asynchrone) : cette attente borne la
+ * trame pour les mesures et avant de remplacer les tampons. Retour immédiat
+ * en flush synchrone.
+ */
+void display_driver_wait_flush_idle(void);
+
+/**
+ * @brief Change l'horloge pixel du balayage RGB
+ *
+ * Le pilote RGB de l'IDF n'applique la nouvelle fréquence qu'au VSYNC
+ * suivant : la trame en cours de balayage n'est jamais coupée. Le bilan
+ * PSRAM suit la nouvelle fréquence.
+ * @param pclk_hz Fréquence entre DISPLAY_PCLK_MIN_HZ et la fréquence nominale
+ * @return esp_err_t ESP_ERR_INVALID_STATE si le panneau n'est pas initialisé
+ */
+esp_err_t display_driver_set_pclk(uint32_t pclk_hz);
+
+/**
+ * @brief Horloge pixel demandée au panneau
+ * @return uint32_t Fréquence en Hz (0 si le panneau n'est pas initialisé)
+ */
+uint32_t display_driver_get_pclk(void);
+
+/**
+ * @brief Bilan de bande passante PSRAM sur la fenêtre de mesure en cours
+ *
+ * Le trafic de rendu est compté dans le callback de flush (écriture des
+ * pixels rendus, relecture et copie en mode partiel) ; la synchronisation
+ * interne de LVGL en mode direct n'est pas visible et n'est pas comptée.
+ *
+ * @param[out] out Bilan calculé
+ * @return esp_err_t ESP_ERR_INVALID_STATE si le driver n'est pas initialisé
+ */
+esp_err_t display_driver_get_psram_budget(psram_budget_t *out);
+
+/**
+ * @brief Mesures de la synchronisation sur le balayage
+ * @param[out] out Mesures depuis l'initialisation ou la dernière remise à zéro
+ * @return esp_err_t ESP_ERR_INVALID_STATE si le driver n'est pas initialisé
+ *         ou si la synchronisation est désactivée
+ */
+esp_err_t display_driver_get_scanline_stats(display_scanline_stats_t *out);
+
+/**
+ * @brief Remet à zéro les mesures de la synchronisation sur le balayage
+ */
+void display_driver_reset_scanline_stats(void);
+
 /**
  * @brief Désactive le driver d'affichage
  */
@@ -0,0 +1,174 @@
+/**
+ * @file display_governor.c
+ * @brief Régulateur de fréquence de rafraîchissement selon l'activité
+ *
+ * Le régime est décidé au début de chaque cycle de rafraîchissement
+ * (LV_EVENT_REFR_START, envoyé même sans rien à redessiner) d'après
+ * l'inactivité des entrées et les animations en cours : aucun timer
+ * propre, la tâche LVGL dort aussi longtemps que ses timers le permettent.
+ * Au repos la période du timer de rafraîchissement est allongée et, si
+ * configuré, l'horloge pixel abaissée pour libérer de la bande passante
+ * PSRAM. Un toucher signalé par display_governor_notify_activity() rétablit
+ * le régime nominal sans attendre la fin de la période lente ; une
+ * animation démarrée au repos est vue au rafraîchissement lent suivant.
+ */
+
+#include "display_governor.h"
+#include "display_driver.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lvgl.h"
+
+static const char *TAG = "Display_Governor";
+
+static bool gov_started;
+static lv_display_t *gov_display;
+static display_governor_config_t gov_config;
+static display_governor_state_t gov_state;
+static uint32_t active_refr_ms;
+static uint32_t active_pclk_hz;
+
+display_governor_level_t display_governor_decide(uint32_t inactive_ms, uint32_t running_anims,
+                                                 uint32_t idle_after_ms)
+{
+    if (running_anims || inactive_ms < idle_after_ms) {
+        return DISPLAY_GOVERNOR_ACTIVE;
+    }
+    return DISPLAY_GOVERNOR_IDLE;
+}
+
+/**
+ * @brief Demande une horloge pixel au panneau (effective au VSYNC suivant)
+ */
+static void display_governor_set_pclk(uint32_t pclk_hz)
+{
+    if (!gov_config.idle_pclk_hz || !pclk_hz) {
+        return;
+    }
+    if (display_driver_set_pclk(pclk_hz) != ESP_OK) {
+        ESP_LOGW(TAG, "Horloge pixel de %lu Hz refusée", (unsigned long)pclk_hz);
+    }
+    gov_state.pclk_hz = display_driver_get_pclk();
+}
+
+/**
+ * @brief Passe dans le régime demandé
+ *
+ * Vers le repos : la cadence LVGL baisse avant l'horloge pixel. Vers le
+ * régime actif : l'horloge pixel remonte d'abord, puis la cadence, et le
+ * rafraîchissement est déclenché tout de suite. L'horloge ne change qu'au
+ * VSYNC, une trame n'est donc jamais balayée à moitié à chaque fréquence.
+ */
+static void display_governor_apply(display_governor_level_t level)
+{
+    lv_timer_t *refr_timer = lv_display_get_refr_timer(gov_display);
+    int64_t now = esp_timer_get_time();
+    gov_state.residency_us[gov_state.level] += (uint64_t)(now - gov_state.last_transition_us);
+
+    if (level == DISPLAY_GOVERNOR_ACTIVE) {
+        display_governor_set_pclk(active_pclk_hz);
+        gov_state.refr_period_ms = active_refr_ms;
+        if (refr_timer) {
+            lv_timer_set_period(refr_timer, active_refr_ms);
+            lv_timer_ready(refr_timer);
+        }
+    } else {
+        gov_state.refr_period_ms = gov_config.idle_refr_ms;
+        if (refr_timer) {
+            lv_timer_set_period(refr_timer, gov_config.idle_refr_ms);
+        }
+        display_governor_set_pclk(gov_config.idle_pclk_hz);
+    }
+
+    gov_state.level = level;
+    gov_state.last_transition_us = now;
+    ++gov_state.transitions;
+    ESP_LOGD(TAG, "%s : %lu ms, pclk %lu Hz", level == DISPLAY_GOVERNOR_ACTIVE ? "actif" : "repos",
+             (unsigned long)gov_state.refr_period_ms, (unsigned long)gov_state.pclk_hz);
+}
+
+static void display_governor_refr_start_cb(lv_event_t *e)
+{
+    (void)e;
+    display_governor_level_t level =
+        display_governor_decide(lv_display_get_inactive_time(gov_display), lv_anim_count_running(),
+                                gov_config.idle_after_ms);
+    if (level != gov_state.level) {
+        display_governor_apply(level);
+    }
+}
+
+esp_err_t display_governor_start(const display_governor_config_t *config)
+{
+    const display_governor_config_t defaults = DISPLAY_GOVERNOR_DEFAULT_CONFIG();
+    if (!config) {
+        config = &defaults;
+    }
+    if (config->idle_refr_ms == 0 ||
+        (config->idle_pclk_hz && config->idle_pclk_hz < DISPLAY_PCLK_MIN_HZ)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    lv_lock();
+    lv_display_t *disp = lv_display_get_default();
+    lv_timer_t *refr_timer = disp ? lv_display_get_refr_timer(disp) : NULL;
+    if (!refr_timer || gov_started) {
+        lv_unlock();
+        return ESP_ERR_INVALID_STATE;
+    }
+    gov_display = disp;
+    gov_config = *config;
+    active_refr_ms = lv_timer_get_period(refr_timer);
+    active_pclk_hz = display_driver_get_pclk();
+    gov_state = (display_governor_state_t){
+        .level = DISPLAY_GOVERNOR_ACTIVE,
+        .refr_period_ms = active_refr_ms,
+        .pclk_hz = active_pclk_hz,
+        .last_transition_us = esp_timer_get_time(),
+    };
+    lv_display_add_event_cb(disp, display_governor_refr_start_cb, LV_EVENT_REFR_START, NULL);
+    gov_started = true;
+    lv_unlock();
+    ESP_LOGI(TAG, "Actif %lu ms, repos %lu ms après %lu ms, pclk repos %lu Hz",
+             (unsigned long)active_refr_ms, (unsigned long)gov_config.idle_refr_ms,
+             (unsigned long)gov_config.idle_after_ms, (unsigned long)gov_config.idle_pclk_hz);
+    return ESP_OK;
+}
+
+void display_governor_stop(void)
+{
+    lv_lock();
+    if (gov_started) {
+        lv_display_remove_event_cb_with_user_data(gov_display, display_governor_refr_start_cb, NULL);
+        gov_started = false;
+        if (gov_state.level != DISPLAY_GOVERNOR_ACTIVE) {
+            display_governor_apply(DISPLAY_GOVERNOR_ACTIVE);
+        }
+        gov_display = NULL;
+    }
+    lv_unlock();
+}
+
+void display_governor_notify_activity(void)
+{
+    if (gov_started && gov_state.level != DISPLAY_GOVERNOR_ACTIVE) {
+        display_governor_apply(DISPLAY_GOVERNOR_ACTIVE);
+    }
+}
+
+esp_err_t display_governor_get_state(display_governor_state_t *out)
+{
+    if (!out) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t ret = ESP_OK;
+    lv_lock();
+    if (!gov_started) {
+        ret = ESP_ERR_INVALID_STATE;
+    } else {
+        *out = gov_state;
+        out->residency_us[gov_state.level] +=
+            (uint64_t)(esp_timer_get_time() - gov_state.last_transition_us);
+    }
+    lv_unlock();
+    return ret;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file display_governor.h
+ * @brief Régulateur de fréquence de rafraîchissement selon l'activité
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef DISPLAY_GOVERNOR_H
+#define DISPLAY_GOVERNOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Inactivité (ms) avant de passer au rafraîchissement lent */
+#ifdef CONFIG_NOVA_DISPLAY_GOVERNOR_IDLE_AFTER_MS
+#define DISPLAY_GOVERNOR_IDLE_AFTER_MS CONFIG_NOVA_DISPLAY_GOVERNOR_IDLE_AFTER_MS
+#else
+#define DISPLAY_GOVERNOR_IDLE_AFTER_MS 3000
+#endif
+
+/** Période de rafraîchissement LVGL au repos (ms) */
+#ifdef CONFIG_NOVA_DISPLAY_GOVERNOR_IDLE_REFR_MS
+#define DISPLAY_GOVERNOR_IDLE_REFR_MS CONFIG_NOVA_DISPLAY_GOVERNOR_IDLE_REFR_MS
+#else
+#define DISPLAY_GOVERNOR_IDLE_REFR_MS 100
+#endif
+
+/** Horloge pixel au repos (0 = inchangée) */
+#if CONFIG_NOVA_DISPLAY_GOVERNOR_LOWER_PCLK
+#define DISPLAY_GOVERNOR_IDLE_PCLK_HZ (CONFIG_NOVA_DISPLAY_GOVERNOR_IDLE_PCLK_MHZ * 1000 * 1000)
+#else
+#define DISPLAY_GOVERNOR_IDLE_PCLK_HZ 0
+#endif
+
+/**
+ * @brief Régime de rafraîchissement
+ */
+typedef enum {
+    DISPLAY_GOVERNOR_ACTIVE = 0, /**< Toucher, défilement ou animation : cadence nominale */
+    DISPLAY_GOVERNOR_IDLE,       /**< Interface statique : cadence réduite */
+    DISPLAY_GOVERNOR_LEVEL_COUNT,
+} display_governor_level_t;
+
+/**
+ * @brief Configuration du régulateur
+ */
+typedef struct {
+    uint32_t idle_after_ms;  /**< Inactivité avant le passage au repos */
+    uint32_t idle_refr_ms;   /**< Période de rafraîchissement LVGL au repos */
+    uint32_t idle_pclk_hz;   /**< Horloge pixel au repos (0 = inchangée) */
+} display_governor_config_t;
+
+/**
+ * @brief Configuration par défaut (issue de menuconfig)
+ */
+#define DISPLAY_GOVERNOR_DEFAULT_CONFIG() {               \
+    .idle_after_ms = DISPLAY_GOVERNOR_IDLE_AFTER_MS,      \
+    .idle_refr_ms = DISPLAY_GOVERNOR_IDLE_REFR_MS,        \
+    .idle_pclk_hz = DISPLAY_GOVERNOR_IDLE_PCLK_HZ,        \
+}
+
+/**
+ * @brief État observable du régulateur
+ */
+typedef struct {
+    display_governor_level_t level;                       /**< Régime courant */
+    uint32_t refr_period_ms;                              /**< Période de rafraîchissement LVGL appliquée */
+    uint32_t pclk_hz;                                     /**< Horloge pixel demandée au panneau */
+    uint32_t transitions;                                 /**< Changements de régime depuis le démarrage */
+    int64_t last_transition_us;                           /**< Date du dernier changement (esp_timer) */
+    uint64_t residency_us[DISPLAY_GOVERNOR_LEVEL_COUNT];  /**< Temps passé dans chaque régime */
+} display_governor_state_t;
+
+/**
+ * @brief Régime voulu pour une activité donnée
+ *
+ * Toute activité (entrée récente, animation en cours) impose le régime
+ * actif immédiatement ; le repos n'est atteint qu'après idle_after_ms sans
+ * entrée ni animation.
+ * @param inactive_ms Temps depuis la dernière entrée (lv_display_get_inactive_time)
+ * @param running_anims Animations LVGL en cours (défilement inertiel compris)
+ * @param idle_after_ms Seuil d'inactivité
+ * @return display_governor_level_t Régime à appliquer
+ */
+display_governor_level_t display_governor_decide(uint32_t inactive_ms, uint32_t running_anims,
+                                                 uint32_t idle_after_ms);
+
+/**
+ * @brief Démarre le régulateur sur l'affichage LVGL par défaut
+ *
+ * La période courante du timer de rafraîchissement et l'horloge pixel
+ * courante deviennent les valeurs du régime actif. Le régime est réévalué
+ * à chaque cycle de rafraîchissement, sans timer supplémentaire. À appeler
+ * depuis la tâche LVGL ou avec le verrou LVGL pris.
+ * @param config Configuration (NULL : DISPLAY_GOVERNOR_DEFAULT_CONFIG())
+ * @return esp_err_t ESP_ERR_INVALID_STATE sans affichage ou si déjà démarré
+ */
+esp_err_t display_governor_start(const display_governor_config_t *config);
+
+/**
+ * @brief Arrête le régulateur et rétablit le régime actif
+ */
+void display_governor_stop(void);
+
+/**
+ * @brief Signale une entrée (réveil par le toucher) : régime actif immédiat
+ *
+ * Au repos, le rafraîchissement en attente est déclenché tout de suite au
+ * lieu d'attendre la fin de la période lente. Sans effet si le régulateur
+ * n'est pas démarré. Tâche LVGL, verrou pris.
+ */
+void display_governor_notify_activity(void);
+
+/**
+ * @brief Lit l'état du régulateur (depuis n'importe quelle tâche)
+ * @param[out] out État courant, résidence du régime courant incluse
+ * @return esp_err_t ESP_ERR_INVALID_STATE si le régulateur n'est pas démarré
+ */
+esp_err_t display_governor_get_state(display_governor_state_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DISPLAY_GOVERNOR_H
@@ -0,0 +1,78 @@
+/**
+ * @file display_scanline.c
+ * @brief Position du balayage RGB et planification des copies sans tearing
+ * @author NovaReptileElevage Team
+ *
+ * Les calculs se font en nanosecondes sur la trame complète (blanking
+ * compris), comptée depuis l'interruption VSYNC.
+ */
+
+#include "display_scanline.h"
+
+static uint64_t display_scanline_line_ns(const display_scanline_timing_t *timing)
+{
+    if (!timing || !timing->pclk_hz) {
+        return 0;
+    }
+    return (uint64_t)timing->h_total * 1000000000ull / timing->pclk_hz;
+}
+
+uint32_t display_scanline_frame_us(const display_scanline_timing_t *timing)
+{
+    return (uint32_t)(display_scanline_line_ns(timing) * (timing ? timing->v_total : 0) / 1000);
+}
+
+int32_t display_scanline_position(const display_scanline_timing_t *timing, uint32_t since_vsync_us)
+{
+    uint64_t line_ns = display_scanline_line_ns(timing);
+    uint64_t frame_ns = line_ns * (timing ? timing->v_total : 0);
+    if (!frame_ns) {
+        return 0;
+    }
+    uint64_t phase = (uint64_t)since_vsync_us * 1000 % frame_ns;
+    return (int32_t)(phase / line_ns) - timing->v_active_start;
+}
+
+void display_scanline_plan(const display_scanline_timing_t *timing, uint32_t since_vsync_us,
+                           int32_t y1, int32_t y2, uint32_t copy_us, uint16_t guard_lines,
+                           display_scanline_plan_t *out)
+{
+    if (!out) {
+        return;
+    }
+    *out = (display_scanline_plan_t){0};
+    uint64_t line_ns = display_scanline_line_ns(timing);
+    uint64_t frame_ns = line_ns * (timing ? timing->v_total : 0);
+    if (!frame_ns || y2 < y1) {
+        return;
+    }
+
+    /* Lignes de la trame occupées par la zone, marge comprise */
+    int32_t first = timing->v_active_start + y1 - guard_lines;
+    int32_t end = timing->v_active_start + y2 + 1 + guard_lines;
+    if (first < 0) {
+        first = 0;
+    }
+    if (end > timing->v_total) {
+        end = timing->v_total;
+    }
+    uint64_t zone_start = (uint64_t)first * line_ns;
+    uint64_t zone_end = (uint64_t)end * line_ns;
+    uint64_t copy_ns = (uint64_t)copy_us * 1000;
+    uint64_t phase = (uint64_t)since_vsync_us * 1000 % frame_ns;
+
+    /* Croisement pendant [phase, phase + copie], sur cette trame ou la suivante */
+    for (uint64_t k = 0; k < 2 && !out->crossing; ++k) {
+        out->crossing = phase < zone_end + k * frame_ns &&
+                        phase + copy_ns > zone_start + k * frame_ns;
+    }
+    if (!out->crossing) {
+        return;
+    }
+    if (zone_end - zone_start + copy_ns > frame_ns) {
+        out->unavoidable = true;
+        return;
+    }
+    uint64_t target = phase < zone_end ? zone_end : zone_end + frame_ns;
+    out->wait_us = (uint32_t)((target - phase + 999) / 1000);
+}
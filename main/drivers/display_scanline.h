@@ -0,0 +1,77 @@
+/**
+ * @file display_scanline.h
+ * @brief Position du balayage RGB et planification des copies sans tearing
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef DISPLAY_SCANLINE_H
+#define DISPLAY_SCANLINE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Géométrie temporelle du balayage
+ */
+typedef struct {
+    uint32_t pclk_hz;        /**< Horloge pixel */
+    uint16_t h_total;        /**< Horloges pixel par ligne, blanking compris */
+    uint16_t v_total;        /**< Lignes par trame, blanking compris */
+    uint16_t v_active_start; /**< Lignes entre l'interruption VSYNC et la première ligne affichée */
+    uint16_t v_res;          /**< Lignes affichées */
+} display_scanline_timing_t;
+
+/**
+ * @brief Décision pour la copie d'une zone dans le framebuffer balayé
+ */
+typedef struct {
+    uint32_t wait_us;  /**< Attente avant la copie */
+    bool crossing;     /**< Sans attente, le balayage aurait traversé la zone pendant la copie */
+    bool unavoidable;  /**< Zone trop haute pour une fenêtre sans croisement : copie immédiate */
+} display_scanline_plan_t;
+
+/**
+ * @brief Durée d'une trame de balayage
+ * @param timing Géométrie du balayage
+ * @return uint32_t Période en µs (0 si la géométrie est nulle)
+ */
+uint32_t display_scanline_frame_us(const display_scanline_timing_t *timing);
+
+/**
+ * @brief Ligne balayée à un instant donné
+ * @param timing Géométrie du balayage
+ * @param since_vsync_us Temps écoulé depuis le dernier VSYNC
+ * @return int32_t Ligne affichée en cours, négative pendant le back porch,
+ *         v_res ou plus pendant le front porch
+ */
+int32_t display_scanline_position(const display_scanline_timing_t *timing, uint32_t since_vsync_us);
+
+/**
+ * @brief Planifie la copie des lignes y1..y2
+ *
+ * La copie est retardée seulement si le balayage doit croiser la zone
+ * (élargie de guard_lines de part et d'autre) avant la fin estimée de la
+ * copie ; elle démarre alors dès que le balayage a dépassé la zone, ce qui
+ * lui laisse toute la trame restante. Les zones qui ne tiennent dans aucune
+ * fenêtre sont copiées sans attendre.
+ * @param timing Géométrie du balayage
+ * @param since_vsync_us Temps écoulé depuis le dernier VSYNC
+ * @param y1 Première ligne de la zone
+ * @param y2 Dernière ligne de la zone
+ * @param copy_us Durée estimée de la copie
+ * @param guard_lines Marge en lignes (latence d'interruption, avance de lecture)
+ * @param[out] out Décision
+ */
+void display_scanline_plan(const display_scanline_timing_t *timing, uint32_t since_vsync_us,
+                           int32_t y1, int32_t y2, uint32_t copy_us, uint16_t guard_lines,
+                           display_scanline_plan_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DISPLAY_SCANLINE_H
@@ -0,0 +1,86 @@
+/**
+ * @file gt911_frame.c
+ * @brief Lecture d'une trame GT911 en une rafale, sans allocation
+ * @author NovaReptileElevage Team
+ */
+
+#include "gt911_frame.h"
+
+// Emplacement de point : track id, X (2), Y (2), taille (2), réservé
+#define GT911_POINT_STRIDE 8
+
+static uint32_t gt911_scale_factor(uint16_t max, uint16_t size)
+{
+    if (!max) {
+        max = size;
+    }
+    // Arrondi supérieur : x × facteur >> 24 tombe sur floor(x × size / max)
+    // tant que x × max < 2^24, soit x < 4096 pour max ≤ 4095
+    return (uint32_t)((((uint64_t)size << GT911_SCALE_SHIFT) + max - 1) / max);
+}
+
+void gt911_scale_init(gt911_scale_t *scale, uint16_t max_x, uint16_t max_y, uint16_t width,
+                      uint16_t height)
+{
+    scale->x_factor = gt911_scale_factor(max_x, width);
+    scale->y_factor = gt911_scale_factor(max_y, height);
+    scale->width = width;
+    scale->height = height;
+}
+
+static uint16_t gt911_scale_apply(uint16_t raw, uint32_t factor, uint16_t size)
+{
+    uint32_t v = (uint32_t)(((uint64_t)raw * factor) >> GT911_SCALE_SHIFT);
+    return v >= size ? (uint16_t)(size - 1) : (uint16_t)v;
+}
+
+bool gt911_frame_decode(const uint8_t *raw, const gt911_scale_t *scale, touch_frame_t *frame)
+{
+    uint8_t status = raw[0];
+    if (!(status & 0x80)) {
+        return false;
+    }
+
+    uint8_t count = status & 0x0F;
+    if (count > TOUCH_FRAME_MAX_POINTS) {
+        count = TOUCH_FRAME_MAX_POINTS;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        const uint8_t *p = &raw[1 + i * GT911_POINT_STRIDE];
+        uint16_t x = (uint16_t)(p[1] | (p[2] << 8));
+        uint16_t y = (uint16_t)(p[3] | (p[4] << 8));
+        uint16_t size = (uint16_t)(p[5] | (p[6] << 8));
+
+        frame->points[i].track_id = p[0];
+        frame->points[i].x = gt911_scale_apply(x, scale->x_factor, scale->width);
+        frame->points[i].y = gt911_scale_apply(y, scale->y_factor, scale->height);
+        frame->points[i].size = size > UINT8_MAX ? UINT8_MAX : (uint8_t)size;
+    }
+    frame->count = count;
+    return true;
+}
+
+int gt911_frame_read(gt911_reader_t *reader, touch_frame_t *frame, bool *ready)
+{
+    uint8_t *tx = reader->tx;
+
+    *ready = false;
+    tx[0] = (uint8_t)(GT911_FRAME_REG >> 8);
+    tx[1] = (uint8_t)(GT911_FRAME_REG & 0xFF);
+    int ret = reader->bus.transmit_receive(reader->bus.ctx, tx, 2, reader->rx, GT911_FRAME_LEN);
+    if (ret != 0) {
+        return ret;
+    }
+    if (!gt911_frame_decode(reader->rx, &reader->scale, frame)) {
+        return 0;
+    }
+
+    // Statut à 0 : le contrôleur peut préparer la trame suivante
+    tx[2] = 0;
+    ret = reader->bus.transmit(reader->bus.ctx, tx, GT911_FRAME_TX_LEN);
+    if (ret != 0) {
+        return ret;
+    }
+    *ready = true;
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file gt911_frame.h
+ * @brief Lecture d'une trame GT911 en une rafale, sans allocation
+ * @author NovaReptileElevage Team
+ *
+ * Une trame (statut 0x814E et les 5 emplacements de points jusqu'à 0x8176)
+ * est lue en une seule transaction, puis le statut est effacé par une
+ * écriture de 3 octets : deux transactions par trame, une seule quand le
+ * contrôleur n'a rien de nouveau. Les tampons sont fournis par l'appelant
+ * (mémoire interne, compatible DMA) ; la mise à l'échelle des coordonnées
+ * est un produit en virgule fixe précalculé, exact au pixel près.
+ */
+
+#ifndef GT911_FRAME_H
+#define GT911_FRAME_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "touch_ring.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Premier registre de la rafale : statut */
+#define GT911_FRAME_REG 0x814E
+/** Statut plus 5 emplacements de 8 octets : 0x814E–0x8176 */
+#define GT911_FRAME_LEN (1 + 8 * TOUCH_FRAME_MAX_POINTS)
+/** Adresse de registre (2 octets) plus un octet de donnée */
+#define GT911_FRAME_TX_LEN 3
+
+/** Bits de fraction de l'échelle : exacte pour des coordonnées brutes < 4096 */
+#define GT911_SCALE_SHIFT 24
+
+/**
+ * @brief Transactions I2C, même sens que i2c_master_transmit[_receive]()
+ * @return 0 en cas de succès, code d'erreur du bus sinon
+ */
+typedef struct {
+    int (*transmit_receive)(void *ctx, const uint8_t *tx, size_t tx_len, uint8_t *rx, size_t rx_len);
+    int (*transmit)(void *ctx, const uint8_t *tx, size_t tx_len);
+    void *ctx;
+} gt911_bus_t;
+
+/**
+ * @brief Échelle brute → pixels (x × facteur) >> GT911_SCALE_SHIFT
+ */
+typedef struct {
+    uint32_t x_factor;
+    uint32_t y_factor;
+    uint16_t width;
+    uint16_t height;
+} gt911_scale_t;
+
+typedef struct {
+    gt911_bus_t bus;
+    gt911_scale_t scale;
+    uint8_t *rx;  /**< GT911_FRAME_LEN octets */
+    uint8_t *tx;  /**< GT911_FRAME_TX_LEN octets */
+} gt911_reader_t;
+
+/**
+ * @brief Précalcule l'échelle d'une surface brute max_x × max_y vers l'écran
+ *
+ * Résultat identique à x * width / max_x pour toute coordonnée brute
+ * inférieure à 4096 ; une dimension nulle prend celle de l'écran.
+ */
+void gt911_scale_init(gt911_scale_t *scale, uint16_t max_x, uint16_t max_y, uint16_t width,
+                      uint16_t height);
+
+/**
+ * @brief Décode une rafale 0x814E–0x8176
+ * @param raw GT911_FRAME_LEN octets lus depuis GT911_FRAME_REG
+ * @return false si le contrôleur n'avait pas de trame prête (bit 7 du statut)
+ */
+bool gt911_frame_decode(const uint8_t *raw, const gt911_scale_t *scale, touch_frame_t *frame);
+
+/**
+ * @brief Lit, décode et acquitte une trame
+ * @param ready false si le contrôleur n'avait rien de nouveau (rien n'est écrit)
+ * @return 0, ou l'erreur de la première transaction échouée
+ */
+int gt911_frame_read(gt911_reader_t *reader, touch_frame_t *frame, bool *ready);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GT911_FRAME_H
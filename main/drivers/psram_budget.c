@@ -0,0 +1,41 @@
+/**
+ * @file psram_budget.c
+ * @brief Calcul du bilan de bande passante PSRAM
+ * @author NovaReptileElevage Team
+ */
+
+#include "psram_budget.h"
+#include "esp_log.h"
+
+#define PSRAM_BUDGET_WARN_PERMILLE 900
+
+void psram_budget_compute(const psram_budget_input_t *in, psram_budget_t *out)
+{
+    if (!in || !out) {
+        return;
+    }
+
+    out->budget_bps = in->psram_bandwidth_bps;
+    out->scanout_bps = (uint64_t)in->pclk_hz * in->bits_per_pixel / 8;
+    out->render_bps = in->window_us ? in->render_bytes * 1000000ull / in->window_us : 0;
+
+    uint64_t used = out->scanout_bps + out->render_bps;
+    out->headroom_bps = (int64_t)out->budget_bps - (int64_t)used;
+    out->load_permille = out->budget_bps ? (uint32_t)(used * 1000 / out->budget_bps) : UINT32_MAX;
+}
+
+void psram_budget_log(const char *tag, const psram_budget_t *budget)
+{
+    if (!budget) {
+        return;
+    }
+
+    esp_log_level_t level = budget->load_permille >= PSRAM_BUDGET_WARN_PERMILLE ? ESP_LOG_WARN : ESP_LOG_INFO;
+    ESP_LOG_LEVEL(level, tag, "PSRAM: balayage %llu KB/s + rendu %llu KB/s sur %llu KB/s (charge %lu.%lu%%, marge %lld KB/s)",
+                  (unsigned long long)(budget->scanout_bps / 1000),
+                  (unsigned long long)(budget->render_bps / 1000),
+                  (unsigned long long)(budget->budget_bps / 1000),
+                  (unsigned long)(budget->load_permille / 10),
+                  (unsigned long)(budget->load_permille % 10),
+                  (long long)(budget->headroom_bps / 1000));
+}
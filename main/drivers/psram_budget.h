@@ -0,0 +1,56 @@
+/**
+ * @file psram_budget.h
+ * @brief Bilan de bande passante PSRAM (balayage RGB + trafic de rendu)
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef PSRAM_BUDGET_H
+#define PSRAM_BUDGET_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Paramètres du bilan
+ */
+typedef struct {
+    uint64_t psram_bandwidth_bps; /**< Débit PSRAM réellement exploitable (octets/s) */
+    uint32_t pclk_hz;             /**< Horloge pixel du balayage RGB */
+    uint8_t bits_per_pixel;       /**< Profondeur de couleur balayée */
+    uint64_t render_bytes;        /**< Octets PSRAM mesurés côté rendu sur la fenêtre */
+    uint32_t window_us;           /**< Durée de la fenêtre de mesure (0 = aucune mesure) */
+} psram_budget_input_t;
+
+/**
+ * @brief Résultat du bilan
+ */
+typedef struct {
+    uint64_t budget_bps;    /**< Débit disponible */
+    uint64_t scanout_bps;   /**< Débit du balayage (pclk x bpp, pire cas hors blanking) */
+    uint64_t render_bps;    /**< Débit de rendu mesuré */
+    int64_t headroom_bps;   /**< Marge restante (négative = saturation) */
+    uint32_t load_permille; /**< Charge totale en pour mille du débit disponible */
+} psram_budget_t;
+
+/**
+ * @brief Calcule le bilan de bande passante
+ * @param in Paramètres du bilan
+ * @param out Résultat
+ */
+void psram_budget_compute(const psram_budget_input_t *in, psram_budget_t *out);
+
+/**
+ * @brief Journalise un bilan (avertissement au-delà de 90 % de charge)
+ * @param tag Tag de log
+ * @param budget Bilan à journaliser
+ */
+void psram_budget_log(const char *tag, const psram_budget_t *budget);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PSRAM_BUDGET_H
@@ -10,13 +10,21 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_attr.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
 #include "ch422g.h"
 #include "i2c_bus.h"
 #include "lvgl.h"
+#include "gt911_frame.h"
+#include "touch_filter.h"
+#include "touch_gesture.h"
+#include "touch_latency.h"
+#include "touch_ring.h"
 #include <string.h>
-#include <stdlib.h>
 
 static const char *TAG = "Touch_Driver";
 
@@ -29,39 +37,147 @@ static const char *TAG = "Touch_Driver";
 #define I2C_FREQUENCY 400000 // 400kHz
 #define GT911_ADDR 0x5D      // Adresse I2C du GT911
 
-// Registres GT911
-#define GT911_REG_STATUS 0x814E
+// Registres GT911 (trame : voir gt911_frame.h)
 #define GT911_REG_ID 0x8140
-#define GT911_REG_POINT1 0x814F
 #define GT911_REG_CONFIG 0x8047
 #define GT911_REG_X_OUTPUT_MAX 0x8048
 #define GT911_REG_Y_OUTPUT_MAX 0x804A
 
-// Structure pour les données tactiles
-typedef struct {
-  uint16_t x;
-  uint16_t y;
-  uint8_t size;
-  uint8_t track_id;
-} gt911_point_t;
+// Contact maintenu : relecture même sans interruption (relâcher manqué)
+#define TOUCH_HELD_POLL_MS 20
+
+// Tâche d'échantillonnage (cœur 0, LVGL tourne sur le cœur 1)
+#define TOUCH_TASK_STACK 3072
+#define TOUCH_TASK_PRIORITY 7
+#define TOUCH_TASK_CORE 0
+
+// Gestes en attente de la tâche LVGL
+#define TOUCH_GESTURE_QUEUE_LEN 16
+
+// Filtre du contact principal et horizon maximal de prédiction
+#if CONFIG_NOVA_TOUCH_FILTER_ONE_EURO
+#define TOUCH_FILTER_KIND TOUCH_FILTER_ONE_EURO
+#elif CONFIG_NOVA_TOUCH_FILTER_KALMAN
+#define TOUCH_FILTER_KIND TOUCH_FILTER_KALMAN
+#else
+#define TOUCH_FILTER_KIND TOUCH_FILTER_NONE
+#endif
+#ifdef CONFIG_NOVA_TOUCH_PREDICT_MAX_MS
+#define TOUCH_PREDICT_MAX_US (CONFIG_NOVA_TOUCH_PREDICT_MAX_MS * 1000)
+#else
+#define TOUCH_PREDICT_MAX_US 0
+#endif
+// Horizon recalculé sur la latence médiane tous les N échantillons
+#define TOUCH_PREDICT_RETUNE_SAMPLES 16
+
+_Static_assert(TOUCH_MAX_POINTS == TOUCH_FRAME_MAX_POINTS, "GT911 frame size mismatch");
 
 static bool touch_initialized = false;
-static volatile bool touch_pressed = false;
 static i2c_master_dev_handle_t gt911_dev = NULL;
 static uint16_t gt911_max_x = TOUCH_WIDTH;
 static uint16_t gt911_max_y = TOUCH_HEIGHT;
+// Lecture des trames : tampons internes compatibles DMA, alloués une fois
+static gt911_reader_t gt911_reader;
 static lv_indev_t *touch_indev = NULL;
+static TaskHandle_t notify_task = NULL;
+
+/*
+ * Échantillonnage : la tâche tactile lit et décode les trames du GT911 sur
+ * interruption et les publie dans touch_ring ; touch_read ne fait que les
+ * retirer, sans aucune entrée-sortie dans la tâche LVGL.
+ */
+static touch_ring_t touch_ring;
+static TaskHandle_t touch_task = NULL;
+static SemaphoreHandle_t touch_task_exit_sem = NULL;
+static volatile bool touch_task_stop = false;
+static volatile uint32_t touch_bus_errors = 0;
+static volatile uint32_t touch_polls = 0;
+
+/*
+ * Gestes : reconnus dans la tâche tactile à chaque trame, transmis à la
+ * tâche LVGL par une file FreeRTOS et livrés par touch_driver_process().
+ */
+static touch_gesture_engine_t gesture_engine;
+static QueueHandle_t gesture_queue = NULL;
+static touch_gesture_cb_t gesture_cb = NULL;
+static void *gesture_cb_data = NULL;
+static volatile uint32_t gesture_count = 0;
+static volatile uint32_t gesture_dropped = 0;
+
+// Contact en cours au dernier état transmis à LVGL, et instant de la lecture
+static bool touch_held = false;
+static int64_t touch_read_us = 0;
+// Deuxième doigt posé : le pointeur LVGL abandonne le contact en cours
+static bool touch_pointer_cancel = false;
+// Lissage et prédiction du contact principal (tâche LVGL)
+static touch_filter_t touch_filter;
+
+// Latence interruption → trame : instant de l'interruption à chaque étape
+static volatile int64_t irq_pending_us = 0;
+static portMUX_TYPE irq_lock = portMUX_INITIALIZER_UNLOCKED;
+static int64_t irq_read_us = 0;
+static int64_t irq_render_us = 0;
+static touch_latency_t touch_latency;
+static portMUX_TYPE latency_lock = portMUX_INITIALIZER_UNLOCKED;
 
 /**
  * @brief ISR appelée sur front descendant de la ligne INT du GT911.
  *
- * Cette routine se contente de mémoriser qu'un évènement tactile est
- * disponible. Le traitement complet est réalisé dans le contexte de
- * `touch_read` afin de limiter la charge de l'ISR.
+ * Cette routine se contente d'horodater l'évènement et de réveiller la
+ * tâche tactile, qui lit et décode la trame.
  */
 static void IRAM_ATTR touch_isr_handler(void *arg) {
   (void)arg;
-  touch_pressed = true;
+  BaseType_t woken = pdFALSE;
+  taskENTER_CRITICAL_ISR(&irq_lock);
+  if (!irq_pending_us) {
+    irq_pending_us = esp_timer_get_time();
+  }
+  taskEXIT_CRITICAL_ISR(&irq_lock);
+  if (touch_task) {
+    vTaskNotifyGiveFromISR(touch_task, &woken);
+  }
+  portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief Suit la trame qui répond à une interruption lue par touch_read.
+ *
+ * LV_EVENT_RENDER_START : la trame contient la réponse. LV_EVENT_REFR_READY :
+ * rendu terminé et dernière bande confiée au flush, l'échantillon est pris ;
+ * un rafraîchissement sans rendu après la lecture abandonne la mesure (le
+ * toucher n'a rien changé à l'écran).
+ */
+static void touch_latency_event_cb(lv_event_t *e) {
+  if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+    if (irq_read_us && !irq_render_us) {
+      irq_render_us = irq_read_us;
+    }
+    irq_read_us = 0;
+    return;
+  }
+  if (irq_render_us) {
+    uint32_t us = (uint32_t)(esp_timer_get_time() - irq_render_us);
+    static touch_latency_t copy;
+    taskENTER_CRITICAL(&latency_lock);
+    touch_latency_add(&touch_latency, us);
+    bool retune = TOUCH_PREDICT_MAX_US && touch_latency.count % TOUCH_PREDICT_RETUNE_SAMPLES == 0;
+    if (retune) {
+      copy = touch_latency;
+    }
+    taskEXIT_CRITICAL(&latency_lock);
+    ESP_LOGD(TAG, "Latence tactile → trame: %lu us", (unsigned long)us);
+    if (retune) {
+      // Prédiction à la latence médiane récente
+      touch_latency_stats_t stats;
+      touch_latency_get(&copy, &stats);
+      uint32_t horizon = LV_MIN(stats.p50_us, TOUCH_PREDICT_MAX_US);
+      touch_filter_set_horizon(&touch_filter, horizon);
+      ESP_LOGD(TAG, "Horizon de prédiction: %lu us", (unsigned long)horizon);
+    }
+  }
+  irq_render_us = 0;
+  irq_read_us = 0;
 }
 
 /**
@@ -77,25 +193,40 @@ static esp_err_t gt911_read_reg(uint16_t reg_addr, uint8_t *data, size_t len) {
                                      1000);
 }
 
+static int gt911_bus_transmit_receive(void *ctx, const uint8_t *tx, size_t tx_len,
+                                      uint8_t *rx, size_t rx_len) {
+  (void)ctx;
+  return i2c_master_transmit_receive(gt911_dev, tx, tx_len, rx, rx_len, 1000);
+}
+
+static int gt911_bus_transmit(void *ctx, const uint8_t *tx, size_t tx_len) {
+  (void)ctx;
+  return i2c_master_transmit(gt911_dev, tx, tx_len, 1000);
+}
+
 /**
- * @brief Écrit des données vers le GT911 via I2C
- * @param reg_addr Adresse du registre
- * @param data Données à écrire
- * @param len Nombre d'octets à écrire
- * @return esp_err_t Code d'erreur
+ * @brief Alloue les tampons de trame (une fois, mémoire interne DMA)
+ *
+ * Le maître I2C de l'ESP32-S3 passe par sa FIFO, mais des tampons internes
+ * évitent tout accès PSRAM et toute allocation par trame.
  */
-static esp_err_t gt911_write_reg(uint16_t reg_addr, const uint8_t *data,
-                                 size_t len) {
-  uint8_t *buf = malloc(2 + len);
-  if (buf == NULL) {
+static esp_err_t gt911_reader_alloc(void) {
+  gt911_reader.rx = heap_caps_malloc(GT911_FRAME_LEN, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+  gt911_reader.tx = heap_caps_malloc(GT911_FRAME_TX_LEN, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+  if (!gt911_reader.rx || !gt911_reader.tx) {
     return ESP_ERR_NO_MEM;
   }
-  buf[0] = (reg_addr >> 8) & 0xFF;
-  buf[1] = reg_addr & 0xFF;
-  memcpy(&buf[2], data, len);
-  esp_err_t ret = i2c_master_transmit(gt911_dev, buf, 2 + len, 1000);
-  free(buf);
-  return ret;
+  gt911_reader.bus.transmit_receive = gt911_bus_transmit_receive;
+  gt911_reader.bus.transmit = gt911_bus_transmit;
+  gt911_reader.bus.ctx = NULL;
+  return ESP_OK;
+}
+
+static void gt911_reader_free(void) {
+  heap_caps_free(gt911_reader.rx);
+  heap_caps_free(gt911_reader.tx);
+  gt911_reader.rx = NULL;
+  gt911_reader.tx = NULL;
 }
 
 /**
@@ -156,105 +287,185 @@ static esp_err_t gt911_init(void) {
   }
   ESP_LOGI(TAG, "Surface tactile GT911 détectée: %u x %u", gt911_max_x,
            gt911_max_y);
+  // Échelle en virgule fixe : plus de division par point
+  gt911_scale_init(&gt911_reader.scale, gt911_max_x, gt911_max_y, TOUCH_WIDTH,
+                   TOUCH_HEIGHT);
 
   ESP_LOGI(TAG, "GT911 initialisé avec succès");
   return ESP_OK;
 }
 
 /**
- * @brief Callback LVGL pour la lecture des données tactiles
- * @param indev Device d'entrée LVGL
- * @param data Structure de données tactiles
+ * @brief Lit et décode une trame du GT911 (une rafale, puis acquittement)
+ * @param frame Trame décodée, count = 0 pour un relâcher
+ * @return ESP_OK si une trame est prête, ESP_ERR_NOT_FINISHED si le
+ *         contrôleur n'a rien de nouveau, erreur I2C sinon
  */
-static void touch_read(lv_indev_t *indev, lv_indev_data_t *data) {
-  static gt911_point_t points[TOUCH_MAX_POINTS];
-  static uint8_t total_points = 0;
-  static uint8_t point_index = 0;
-  static uint16_t last_x = 0, last_y = 0;
+static esp_err_t gt911_read_frame(touch_frame_t *frame) {
+  bool ready;
+  esp_err_t ret = gt911_frame_read(&gt911_reader, frame, &ready);
+  if (ret != ESP_OK) {
+    return ret;
+  }
+  return ready ? ESP_OK : ESP_ERR_NOT_FINISHED;
+}
 
-  if (point_index >= total_points) {
-    if (!touch_pressed) {
-      data->state = LV_INDEV_STATE_REL;
-      data->continue_reading = false;
-      return;
+/**
+ * @brief Met en file les gestes reconnus
+ * @return true si au moins un geste a été publié
+ */
+static bool touch_publish_gestures(const touch_gesture_t *events, uint8_t count) {
+  bool sent = false;
+  for (uint8_t i = 0; i < count; i++) {
+    if (xQueueSend(gesture_queue, &events[i], 0) == pdTRUE) {
+      gesture_count++;
+      sent = true;
+    } else {
+      // File pleine : la tâche LVGL est en retard, le geste est perdu
+      gesture_dropped++;
     }
+  }
+  return sent;
+}
 
-    // Lecture du statut tactile
-    uint8_t status;
-    esp_err_t ret = gt911_read_reg(GT911_REG_STATUS, &status, 1);
+/**
+ * @brief Tâche d'échantillonnage du GT911
+ *
+ * Réveillée par l'interruption, ou toutes les TOUCH_HELD_POLL_MS tant qu'un
+ * contact est en cours ou qu'une trame attend de la place dans la file.
+ * Chaque trame est aussi passée au moteur de gestes, dont le coût ne
+ * dépend que du nombre de contacts. Chaque trame ou geste publié réveille
+ * la tâche LVGL.
+ */
+static void touch_task_fn(void *arg) {
+  (void)arg;
+  bool held = false;
+  touch_gesture_t events[TOUCH_GESTURE_MAX_EVENTS];
+
+  while (!touch_task_stop) {
+    bool gestures = false;
+    TickType_t wait = held || touch_ring.pending_count ? pdMS_TO_TICKS(TOUCH_HELD_POLL_MS)
+                                                      : portMAX_DELAY;
+    bool irq = ulTaskNotifyTake(pdTRUE, wait) > 0;
+    if (touch_task_stop) {
+      break;
+    }
 
-    if (ret != ESP_OK) {
-      data->state = LV_INDEV_STATE_REL;
-      data->continue_reading = false;
-      touch_pressed = false;
-      return;
+    if (irq || held) {
+      touch_frame_t frame;
+      taskENTER_CRITICAL(&irq_lock);
+      int64_t irq_us = irq_pending_us;
+      irq_pending_us = 0;
+      taskEXIT_CRITICAL(&irq_lock);
+      if (!irq) {
+        touch_polls++;
+      }
+      esp_err_t ret = gt911_read_frame(&frame);
+      if (ret != ESP_OK && ret != ESP_ERR_NOT_FINISHED) {
+        touch_bus_errors++;
+        ESP_LOGD(TAG, "Lecture GT911 échouée: %s", esp_err_to_name(ret));
+        if (held) {
+          // Contrôleur injoignable : pas de contact maintenu indéfiniment
+          frame.count = 0;
+          ret = ESP_OK;
+        }
+      }
+      if (ret == ESP_OK) {
+        frame.t_us = irq_us ? irq_us : esp_timer_get_time();
+        held = frame.count > 0;
+        touch_ring_push(&touch_ring, &frame);
+        gestures = touch_publish_gestures(
+            events, touch_gesture_update(&gesture_engine, &frame, events));
+      } else if (held) {
+        // Contact immobile, le contrôleur ne publie rien : appui long
+        gestures = touch_publish_gestures(
+            events, touch_gesture_tick(&gesture_engine, esp_timer_get_time(), events));
+      }
+    } else {
+      touch_ring_flush(&touch_ring);
+    }
+    // Tâche LVGL réveillée tant que la file n'est pas vidée
+    if (notify_task && (gestures || touch_ring_depth(&touch_ring) > 0)) {
+      xTaskNotifyGive(notify_task);
     }
+  }
 
-    uint8_t point_count = status & 0x0F;
-    total_points = 0;
+  xSemaphoreGive(touch_task_exit_sem);
+  vTaskDelete(NULL);
+}
 
-    if (point_count > 0 && (status & 0x80)) {
-      if (point_count > TOUCH_MAX_POINTS) {
-        point_count = TOUCH_MAX_POINTS;
-      }
+/**
+ * @brief Arrête la tâche d'échantillonnage (ISR déjà détachée)
+ */
+static void touch_stop_task(void) {
+  if (touch_task) {
+    touch_task_stop = true;
+    xTaskNotifyGive(touch_task);
+    xSemaphoreTake(touch_task_exit_sem, portMAX_DELAY);
+    touch_task = NULL;
+  }
+  if (touch_task_exit_sem) {
+    vSemaphoreDelete(touch_task_exit_sem);
+    touch_task_exit_sem = NULL;
+  }
+}
 
-      // Lecture des données de tous les points actifs
-      uint8_t point_data[8 * TOUCH_MAX_POINTS];
-      ret = gt911_read_reg(GT911_REG_POINT1, point_data, point_count * 8);
+/**
+ * @brief Callback LVGL pour la lecture des données tactiles
+ *
+ * Retire les trames publiées par la tâche tactile, sans entrée-sortie, une
+ * par lecture (continue_reading tant que la file n'est pas vide). Le
+ * pointeur LVGL suit le premier contact posé, par identifiant de suivi,
+ * lissé et prédit à l'horizon de la latence mesurée ; les autres ne
+ * servent qu'aux gestes. Sans nouvelle trame, le dernier état est répété.
+ * @param indev Device d'entrée LVGL
+ * @param data Structure de données tactiles
+ */
+static void touch_read(lv_indev_t *indev, lv_indev_data_t *data) {
+  static touch_frame_t frame;
+  static uint8_t primary_id = 0;
+  static bool multi = false;
+  static uint16_t last_x = 0, last_y = 0;
+  (void)indev;
 
-      if (ret == ESP_OK) {
-        for (uint8_t i = 0; i < point_count; i++) {
-          uint8_t *p = &point_data[i * 8];
-          uint16_t x = ((uint16_t)p[1] << 8) | p[0];
-          uint16_t y = ((uint16_t)p[3] << 8) | p[2];
-
-          // Adaptation aux dimensions de l'écran
-          uint16_t max_x = gt911_max_x ? gt911_max_x : TOUCH_WIDTH;
-          uint16_t max_y = gt911_max_y ? gt911_max_y : TOUCH_HEIGHT;
-          x = (x * TOUCH_WIDTH) / max_x;
-          y = (y * TOUCH_HEIGHT) / max_y;
-          if (x >= TOUCH_WIDTH) {
-            x = TOUCH_WIDTH - 1;
-          }
-          if (y >= TOUCH_HEIGHT) {
-            y = TOUCH_HEIGHT - 1;
-          }
-
-          points[i].x = x;
-          points[i].y = y;
+  touch_read_us = esp_timer_get_time();
+  if (touch_ring_pop(&touch_ring, &frame)) {
+    if (!irq_read_us) {
+      irq_read_us = frame.t_us;
+    }
+    ESP_LOGD(TAG, "Touch: points=%d", frame.count);
+
+    if (frame.count == 0) {
+      multi = false;
+    } else {
+      if (!touch_held) {
+        primary_id = frame.points[0].track_id;
+        touch_filter_reset(&touch_filter);
+      }
+      // Contact principal absent de la trame : dernière position conservée
+      for (uint8_t i = 0; i < frame.count; i++) {
+        if (frame.points[i].track_id == primary_id) {
+          touch_filter_out_t out;
+          touch_filter_update(&touch_filter, frame.t_us, frame.points[i].x,
+                              frame.points[i].y, &out);
+          last_x = (uint16_t)LV_CLAMP(0, out.x, TOUCH_WIDTH - 1);
+          last_y = (uint16_t)LV_CLAMP(0, out.y, TOUCH_HEIGHT - 1);
+          break;
         }
-        total_points = point_count;
-        point_index = 0;
-        last_x = points[0].x;
-        last_y = points[0].y;
-
-        ESP_LOGD(TAG, "Touch: points=%d", total_points);
       }
-
-      // Effacement du statut pour préparer la prochaine lecture
-      uint8_t clear = 0;
-      gt911_write_reg(GT911_REG_STATUS, &clear, 1);
+      if (frame.count > 1 && !multi) {
+        // Geste à plusieurs doigts : pas de clic ni de défilement LVGL
+        multi = true;
+        touch_pointer_cancel = true;
+      }
     }
-
-    touch_pressed = false;
+    touch_held = frame.count > 0;
   }
 
-  if (point_index < total_points) {
-    data->state = LV_INDEV_STATE_PR;
-    data->point.x = points[point_index].x;
-    data->point.y = points[point_index].y;
-    last_x = data->point.x;
-    last_y = data->point.y;
-    point_index++;
-    data->continue_reading = point_index < total_points;
-  } else {
-    data->state = LV_INDEV_STATE_REL;
-    data->point.x = last_x;
-    data->point.y = last_y;
-    data->continue_reading = false;
-    total_points = 0;
-    point_index = 0;
-  }
+  data->state = touch_held ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+  data->point.x = last_x;
+  data->point.y = last_y;
+  data->continue_reading = touch_ring_depth(&touch_ring) > 0;
 }
 
 /**
@@ -323,6 +534,14 @@ esp_err_t touch_driver_init(void) {
     goto fail;
   }
 
+  ret = gt911_reader_alloc();
+  if (ret != ESP_OK) {
+    ESP_LOGE(TAG, "Erreur allocation tampons de trame GT911");
+    i2c_master_bus_rm_device(gt911_dev);
+    gt911_dev = NULL;
+    goto fail;
+  }
+
   // Initialisation du GT911
   ret = gt911_init();
   if (ret != ESP_OK) {
@@ -332,9 +551,12 @@ esp_err_t touch_driver_init(void) {
     goto fail;
   }
 
-  // Configuration du driver d'entrée LVGL
+  // Configuration du driver d'entrée LVGL, verrou tenu : l'interface peut
+  // être construite en parallèle par une autre étape du boot
+  lv_lock();
   touch_indev = lv_indev_create();
   if (!touch_indev) {
+    lv_unlock();
     ESP_LOGE(TAG, "Erreur création device tactile LVGL");
     i2c_master_bus_rm_device(gt911_dev);
     gt911_dev = NULL;
@@ -344,19 +566,53 @@ esp_err_t touch_driver_init(void) {
 
   lv_indev_set_type(touch_indev, LV_INDEV_TYPE_POINTER);
   lv_indev_set_read_cb(touch_indev, touch_read);
-
+#if CONFIG_NOVA_LVGL_EVENT_LOOP
+  // Lu par touch_driver_process() sur interruption, plus par un timer LVGL
+  lv_indev_set_mode(touch_indev, LV_INDEV_MODE_EVENT);
+#endif
+
+  touch_latency_reset(&touch_latency);
+  touch_filter_config_t filter_config;
+  touch_filter_default_config(TOUCH_FILTER_KIND, TOUCH_PREDICT_MAX_US, &filter_config);
+  touch_filter_init(&touch_filter, &filter_config);
   lv_display_t *display = lv_display_get_default();
   if (display) {
     lv_indev_set_display(touch_indev, display);
+    lv_display_add_event_cb(display, touch_latency_event_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(display, touch_latency_event_cb, LV_EVENT_REFR_READY, NULL);
   } else {
     ESP_LOGW(TAG,
              "Aucun écran LVGL par défaut, l'association du périphérique tactile est différée");
   }
+  lv_unlock();
+
+  // Tâche d'échantillonnage, prête avant la première interruption
+  touch_ring_init(&touch_ring);
+  touch_gesture_init(&gesture_engine);
+  touch_bus_errors = 0;
+  touch_polls = 0;
+  gesture_count = 0;
+  gesture_dropped = 0;
+  gesture_queue = xQueueCreate(TOUCH_GESTURE_QUEUE_LEN, sizeof(touch_gesture_t));
+  touch_task_exit_sem = xSemaphoreCreateBinary();
+  touch_task_stop = false;
+  if (!gesture_queue || !touch_task_exit_sem ||
+      xTaskCreatePinnedToCore(touch_task_fn, "touch", TOUCH_TASK_STACK, NULL,
+                              TOUCH_TASK_PRIORITY, &touch_task,
+                              TOUCH_TASK_CORE) != pdPASS) {
+    ESP_LOGE(TAG, "Erreur création tâche tactile");
+    touch_task = NULL;
+    i2c_master_bus_rm_device(gt911_dev);
+    gt911_dev = NULL;
+    ret = ESP_ERR_NO_MEM;
+    goto fail;
+  }
 
   // Attache de l'ISR après initialisation réussie
   ret = gpio_isr_handler_add(PIN_INT, touch_isr_handler, NULL);
   if (ret != ESP_OK) {
     ESP_LOGE(TAG, "Erreur ajout handler ISR");
+    touch_stop_task();
     i2c_master_bus_rm_device(gt911_dev);
     gt911_dev = NULL;
     goto fail;
@@ -375,10 +631,22 @@ fail:
    *  - suppression du handler et du service ISR
    *  - reconfiguration de PIN_INT en entrée pull-up
    */
+  touch_stop_task();
+  gt911_reader_free();
   if (touch_indev) {
+    lv_lock();
+    lv_display_t *indev_display = lv_indev_get_display(touch_indev);
+    if (indev_display) {
+      lv_display_remove_event_cb_with_user_data(indev_display, touch_latency_event_cb, NULL);
+    }
     lv_indev_delete(touch_indev);
+    lv_unlock();
     touch_indev = NULL;
   }
+  if (gesture_queue) {
+    vQueueDelete(gesture_queue);
+    gesture_queue = NULL;
+  }
   if (isr_handler_added)
     gpio_isr_handler_remove(PIN_INT);
   if (isr_service_installed)
@@ -400,13 +668,25 @@ fail:
 void touch_driver_deinit(void) {
   if (touch_initialized) {
     gpio_isr_handler_remove(PIN_INT);
+    touch_stop_task();
+    gt911_reader_free();
+    notify_task = NULL;
     gpio_uninstall_isr_service();
     if (gt911_dev) {
       i2c_master_bus_rm_device(gt911_dev);
       gt911_dev = NULL;
     }
     if (touch_indev) {
+      lv_lock();
+      lv_display_t *display = lv_indev_get_display(touch_indev);
+      if (display) {
+        lv_display_remove_event_cb_with_user_data(display, touch_latency_event_cb, NULL);
+      }
       lv_indev_delete(touch_indev);
+      // File supprimée verrou tenu : touch_driver_process() ne la lit plus
+      vQueueDelete(gesture_queue);
+      gesture_queue = NULL;
+      lv_unlock();
       touch_indev = NULL;
     }
     touch_initialized = false;
@@ -499,6 +779,84 @@ void touch_set_enable(bool enable) {
   }
 }
 
+void touch_driver_set_notify_task(TaskHandle_t task) {
+  notify_task = task;
+}
+
+void touch_driver_set_gesture_cb(touch_gesture_cb_t cb, void *user_data) {
+  gesture_cb = cb;
+  gesture_cb_data = user_data;
+}
+
+void touch_driver_process(void) {
+  if (!touch_indev || !gesture_queue) {
+    return;
+  }
+#if CONFIG_NOVA_LVGL_EVENT_LOOP
+  // Contact maintenu sans nouvelle trame : appui long, défilement
+  if (touch_ring_depth(&touch_ring) > 0 ||
+      (touch_held && esp_timer_get_time() - touch_read_us >= TOUCH_HELD_POLL_MS * 1000)) {
+    lv_indev_read(touch_indev);
+  }
+#endif
+  if (touch_pointer_cancel) {
+    touch_pointer_cancel = false;
+    lv_indev_wait_release(touch_indev);
+  }
+
+  touch_gesture_t gesture;
+  while (xQueueReceive(gesture_queue, &gesture, 0) == pdTRUE) {
+    // Mises à jour relatives au début du geste : seule la dernière compte
+    touch_gesture_t next;
+    if (gesture.phase == TOUCH_GESTURE_UPDATE &&
+        xQueuePeek(gesture_queue, &next, 0) == pdTRUE &&
+        next.type == gesture.type && next.phase == TOUCH_GESTURE_UPDATE) {
+      continue;
+    }
+    if (gesture_cb) {
+      gesture_cb(&gesture, gesture_cb_data);
+    }
+  }
+}
+
+uint32_t touch_driver_next_poll_ms(void) {
+  if (!touch_held) {
+    return UINT32_MAX;
+  }
+  int64_t elapsed_ms = (esp_timer_get_time() - touch_read_us) / 1000;
+  return elapsed_ms >= TOUCH_HELD_POLL_MS ? 0 : (uint32_t)(TOUCH_HELD_POLL_MS - elapsed_ms);
+}
+
+esp_err_t touch_driver_get_latency(touch_latency_stats_t *out) {
+  if (!out) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  touch_latency_t copy;
+  taskENTER_CRITICAL(&latency_lock);
+  copy = touch_latency;
+  taskEXIT_CRITICAL(&latency_lock);
+  touch_latency_get(&copy, out);
+  return ESP_OK;
+}
+
+esp_err_t touch_driver_get_queue_stats(touch_queue_stats_t *out) {
+  if (!out) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  touch_ring_get_stats(&touch_ring, &out->ring);
+  out->polls = touch_polls;
+  out->bus_errors = touch_bus_errors;
+  out->gestures = gesture_count;
+  out->gestures_dropped = gesture_dropped;
+  return ESP_OK;
+}
+
+void touch_driver_reset_latency(void) {
+  taskENTER_CRITICAL(&latency_lock);
+  touch_latency_reset(&touch_latency);
+  taskEXIT_CRITICAL(&latency_lock);
+}
+
 esp_err_t touch_calibrate(void) {
   if (!touch_initialized) {
     return ESP_ERR_INVALID_STATE;
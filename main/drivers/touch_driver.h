@@ -8,7 +8,12 @@
 #define TOUCH_DRIVER_H
 
 #include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "lvgl.h"
+#include "touch_gesture.h"
+#include "touch_latency.h"
+#include "touch_ring.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -37,6 +42,64 @@ void touch_driver_deinit(void);
  */
 void touch_set_enable(bool enable);
 
+/**
+ * @brief File des trames entre la tâche tactile et LVGL
+ */
+typedef struct {
+    touch_ring_stats_t ring;  /**< Trames publiées, remplacées, profondeur */
+    uint32_t polls;           /**< Relectures sans interruption, contact maintenu */
+    uint32_t bus_errors;      /**< Lectures I2C échouées */
+    uint32_t gestures;        /**< Gestes reconnus et mis en file */
+    uint32_t gestures_dropped; /**< Gestes perdus, file pleine */
+} touch_queue_stats_t;
+
+/**
+ * @brief Reçoit un geste reconnu, dans la tâche LVGL, verrou tenu
+ */
+typedef void (*touch_gesture_cb_t)(const touch_gesture_t *gesture, void *user_data);
+
+/**
+ * @brief Tâche notifiée (xTaskNotifyGive) à chaque trame publiée par la tâche tactile
+ * @param task Tâche LVGL, NULL pour aucune
+ */
+void touch_driver_set_notify_task(TaskHandle_t task);
+
+/**
+ * @brief Fonction appelée pour chaque geste reconnu (pincement, glissé à deux doigts…)
+ *
+ * Les mises à jour successives d'un geste continu sont fusionnées si la
+ * tâche LVGL a pris du retard.
+ * @param cb Fonction, NULL pour ignorer les gestes
+ */
+void touch_driver_set_gesture_cb(touch_gesture_cb_t cb, void *user_data);
+
+/**
+ * @brief Transmet à LVGL les trames en file (mode événement) et livre les gestes
+ *
+ * Sans entrée-sortie : la tâche tactile (cœur 0) lit le GT911. Relit aussi
+ * l'état toutes les 20 ms tant qu'un contact est maintenu. À appeler depuis
+ * la tâche LVGL, verrou tenu, avant lv_timer_handler() ; en mode de lecture
+ * par timer LVGL, livre seulement les gestes.
+ */
+void touch_driver_process(void);
+
+/**
+ * @brief Délai avant la prochaine lecture sans interruption
+ * @return uint32_t ms, UINT32_MAX sans contact en cours
+ */
+uint32_t touch_driver_next_poll_ms(void);
+
+/**
+ * @brief Latence entre l'interruption du GT911 et la fin du rendu de la trame qui y répond
+ */
+esp_err_t touch_driver_get_latency(touch_latency_stats_t *out);
+void touch_driver_reset_latency(void);
+
+/**
+ * @brief Compteurs de la file des trames tactiles
+ */
+esp_err_t touch_driver_get_queue_stats(touch_queue_stats_t *out);
+
 /**
  * @brief Calibre l'écran tactile
  * @return esp_err_t Code d'erreur
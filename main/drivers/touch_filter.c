@@ -0,0 +1,164 @@
+/**
+ * @file touch_filter.c
+ * @brief Filtrage et prédiction du contact principal
+ * @author NovaReptileElevage Team
+ */
+
+#include "touch_filter.h"
+#include <string.h>
+
+#define Q8_ONE  256
+#define Q16_ONE 65536
+#define US_PER_S 1000000
+
+// 2π en Q16
+#define TWO_PI_Q16 411775
+
+// Écart entre deux trames si l'horodatage ne progresse pas
+#define TOUCH_FILTER_MIN_GAP_US 1000
+// Vitesse estimée bornée (px/s) : un saut de coordonnées n'est pas un geste
+#define TOUCH_FILTER_MAX_SPEED 20000
+
+static int32_t q8_round(int64_t v)
+{
+    return (int32_t)((v >= 0 ? v + Q8_ONE / 2 : v - Q8_ONE / 2) / Q8_ONE);
+}
+
+static int64_t abs64(int64_t v)
+{
+    return v < 0 ? -v : v;
+}
+
+static int32_t clamp_speed_q8(int64_t v_q8)
+{
+    const int64_t max = (int64_t)TOUCH_FILTER_MAX_SPEED * Q8_ONE;
+    return (int32_t)(v_q8 > max ? max : v_q8 < -max ? -max : v_q8);
+}
+
+/**
+ * @brief Gain d'un passe-bas du premier ordre : w / (1 + w), w = 2π·fc·Te
+ */
+static int64_t one_euro_alpha_q16(uint32_t cutoff_mhz, uint32_t dt_us)
+{
+    int64_t w_q16 = (int64_t)cutoff_mhz * dt_us / 1000 * TWO_PI_Q16 / US_PER_S;
+    return w_q16 * Q16_ONE / (w_q16 + Q16_ONE);
+}
+
+static void one_euro_axis(const touch_filter_config_t *cfg, touch_filter_axis_t *a,
+                          int32_t z_q8, uint32_t dt_us)
+{
+    // Dérivée par rapport à la position lissée, lissée à coupure fixe
+    int64_t raw_dx = (int64_t)(z_q8 - a->x_q8) * US_PER_S / dt_us;
+    a->dx_q8 = clamp_speed_q8(a->dx_q8 + (raw_dx - a->dx_q8) *
+                              one_euro_alpha_q16(cfg->d_cutoff_mhz, dt_us) / Q16_ONE);
+
+    // Coupure relevée avec la vitesse : peu de gigue au repos, peu de retard en mouvement
+    int64_t cutoff = cfg->min_cutoff_mhz + (int64_t)cfg->beta_mhz * abs64(a->dx_q8) / Q8_ONE;
+    if (cutoff > UINT32_MAX) {
+        cutoff = UINT32_MAX;
+    }
+    int64_t alpha = one_euro_alpha_q16((uint32_t)cutoff, dt_us);
+    a->x_q8 += (int32_t)((int64_t)(z_q8 - a->x_q8) * alpha / Q16_ONE);
+
+    // En régime établi, la position lissée suit avec un retard de (1 - α) / α
+    // trame et la dérivée vaut v / α : vitesse et retard en sont déduits
+    a->v_q8 = (int32_t)(a->dx_q8 * alpha / Q16_ONE);
+    a->lag_us = alpha ? (uint32_t)((Q16_ONE - alpha) * dt_us / alpha) : 0;
+}
+
+static void kalman_axis(const touch_filter_config_t *cfg, touch_filter_axis_t *a,
+                        int32_t z_q8, uint32_t dt_us)
+{
+    // Prédiction à vitesse constante, puis correction par l'innovation
+    int64_t predicted = a->x_q8 + (int64_t)a->v_q8 * dt_us / US_PER_S;
+    int64_t innovation = z_q8 - predicted;
+    a->x_q8 = (int32_t)(predicted + innovation * cfg->gain_x_q16 / Q16_ONE);
+    a->v_q8 = clamp_speed_q8(a->v_q8 + innovation * cfg->gain_v_q16 / Q16_ONE * US_PER_S / dt_us);
+}
+
+void touch_filter_default_config(touch_filter_kind_t kind, uint32_t horizon_us,
+                                 touch_filter_config_t *config)
+{
+    memset(config, 0, sizeof(*config));
+    config->kind = (uint8_t)kind;
+    config->min_cutoff_mhz = 1000;
+    config->beta_mhz = 20;
+    config->d_cutoff_mhz = 5000;
+    // Régime établi pour ~100 trames/s, bruit de 1 px, accélération de 2000 px/s²
+    config->gain_x_q16 = 30801;  // 0,47
+    config->gain_v_q16 = 9568;   // 0,146
+    config->horizon_us = kind == TOUCH_FILTER_NONE ? 0 : horizon_us;
+    config->min_speed = 60;
+    config->max_lead_px = 48;
+}
+
+void touch_filter_init(touch_filter_t *filter, const touch_filter_config_t *config)
+{
+    memset(filter, 0, sizeof(*filter));
+    filter->config = *config;
+}
+
+void touch_filter_reset(touch_filter_t *filter)
+{
+    filter->primed = false;
+}
+
+void touch_filter_set_horizon(touch_filter_t *filter, uint32_t horizon_us)
+{
+    filter->config.horizon_us = filter->config.kind == TOUCH_FILTER_NONE ? 0 : horizon_us;
+}
+
+void touch_filter_update(touch_filter_t *filter, int64_t t_us, int32_t x, int32_t y,
+                         touch_filter_out_t *out)
+{
+    const touch_filter_config_t *cfg = &filter->config;
+    const int32_t z[2] = {x * Q8_ONE, y * Q8_ONE};
+
+    if (!filter->primed || cfg->kind == TOUCH_FILTER_NONE) {
+        for (int i = 0; i < 2; i++) {
+            filter->axis[i] = (touch_filter_axis_t){.x_q8 = z[i]};
+        }
+        filter->primed = true;
+    } else {
+        int64_t gap = t_us - filter->t_us;
+        if (gap > TOUCH_FILTER_MAX_GAP_US) {
+            // Doigt resté immobile sans trame : vitesse périmée
+            for (int i = 0; i < 2; i++) {
+                filter->axis[i].v_q8 = 0;
+                filter->axis[i].dx_q8 = 0;
+            }
+            gap = TOUCH_FILTER_MAX_GAP_US;
+        } else if (gap < TOUCH_FILTER_MIN_GAP_US) {
+            gap = TOUCH_FILTER_MIN_GAP_US;
+        }
+        for (int i = 0; i < 2; i++) {
+            if (cfg->kind == TOUCH_FILTER_KALMAN) {
+                kalman_axis(cfg, &filter->axis[i], z[i], (uint32_t)gap);
+            } else {
+                one_euro_axis(cfg, &filter->axis[i], z[i], (uint32_t)gap);
+            }
+        }
+    }
+    filter->t_us = t_us;
+
+    // Avance bornée, nulle à basse vitesse : la gigue d'un doigt posé n'est pas amplifiée
+    int64_t vx = filter->axis[0].v_q8;
+    int64_t vy = filter->axis[1].v_q8;
+    int64_t speed = abs64(vx) > abs64(vy) ? abs64(vx) : abs64(vy);
+    int64_t lead[2] = {0, 0};
+    if (cfg->horizon_us && speed >= (int64_t)cfg->min_speed * Q8_ONE) {
+        int64_t max_lead = (int64_t)cfg->max_lead_px * Q8_ONE;
+        for (int i = 0; i < 2; i++) {
+            uint32_t ahead_us = cfg->horizon_us + filter->axis[i].lag_us;
+            lead[i] = (int64_t)filter->axis[i].v_q8 * ahead_us / US_PER_S;
+            lead[i] = lead[i] > max_lead ? max_lead : lead[i] < -max_lead ? -max_lead : lead[i];
+        }
+    }
+
+    out->smooth_x = q8_round(filter->axis[0].x_q8);
+    out->smooth_y = q8_round(filter->axis[1].x_q8);
+    out->x = q8_round(filter->axis[0].x_q8 + lead[0]);
+    out->y = q8_round(filter->axis[1].x_q8 + lead[1]);
+    out->vx = q8_round(vx);
+    out->vy = q8_round(vy);
+}
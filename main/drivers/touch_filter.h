@@ -0,0 +1,103 @@
+/**
+ * @file touch_filter.h
+ * @brief Filtrage et prédiction du contact principal
+ * @author NovaReptileElevage Team
+ *
+ * Trois étapes par axe, en virgule fixe : lissage (filtre 1€ ou filtre
+ * de Kalman à vitesse constante en régime établi), estimation de la
+ * vitesse, puis prédiction de la position à l'horizon donné (la latence
+ * entre la trame tactile et l'image qui y répond). Positions en 1/256 px,
+ * vitesses en 1/256 px/s, gains en Q16 : aucun flottant, coût fixe par
+ * trame.
+ */
+
+#ifndef TOUCH_FILTER_H
+#define TOUCH_FILTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Écart entre trames au-delà duquel la vitesse est oubliée (doigt arrêté) */
+#define TOUCH_FILTER_MAX_GAP_US 50000
+
+typedef enum {
+    TOUCH_FILTER_NONE,      /**< Coordonnées brutes, sans prédiction */
+    TOUCH_FILTER_ONE_EURO,  /**< Coupure adaptée à la vitesse */
+    TOUCH_FILTER_KALMAN,    /**< Vitesse constante, gains de régime établi */
+} touch_filter_kind_t;
+
+typedef struct {
+    uint8_t kind;              /**< touch_filter_kind_t */
+    /* Filtre 1€ */
+    uint32_t min_cutoff_mhz;   /**< Coupure au repos */
+    uint32_t beta_mhz;         /**< Hausse de la coupure par px/s */
+    uint32_t d_cutoff_mhz;     /**< Coupure du lissage de la vitesse */
+    /* Kalman */
+    uint32_t gain_x_q16;       /**< Gain de position (alpha) */
+    uint32_t gain_v_q16;       /**< Gain de vitesse (beta) */
+    /* Prédiction */
+    uint32_t horizon_us;       /**< Avance de la position prédite, 0 sans prédiction */
+    uint32_t min_speed;        /**< Vitesse (px/s) en dessous de laquelle rien n'est prédit */
+    int32_t max_lead_px;       /**< Avance maximale par axe */
+} touch_filter_config_t;
+
+typedef struct {
+    int32_t x_q8;    /**< Position lissée */
+    int32_t v_q8;    /**< Vitesse estimée */
+    int32_t dx_q8;   /**< 1€ : dérivée lissée qui règle la coupure */
+    uint32_t lag_us; /**< 1€ : retard du lissage, ajouté à l'horizon */
+} touch_filter_axis_t;
+
+typedef struct {
+    touch_filter_config_t config;
+    bool primed;              /**< Une trame du contact a été reçue */
+    int64_t t_us;             /**< Instant de la dernière trame */
+    touch_filter_axis_t axis[2];
+} touch_filter_t;
+
+/**
+ * @brief Sortie de chaque étape pour une trame
+ */
+typedef struct {
+    int32_t x;            /**< Position prédite, transmise à LVGL */
+    int32_t y;
+    int32_t smooth_x;     /**< Position lissée, sans prédiction */
+    int32_t smooth_y;
+    int32_t vx;           /**< Vitesse estimée, px/s */
+    int32_t vy;
+} touch_filter_out_t;
+
+/**
+ * @brief Réglages par défaut d'un filtre, prédiction à l'horizon donné
+ */
+void touch_filter_default_config(touch_filter_kind_t kind, uint32_t horizon_us,
+                                 touch_filter_config_t *config);
+
+void touch_filter_init(touch_filter_t *filter, const touch_filter_config_t *config);
+
+/**
+ * @brief Oublie le contact : la prochaine trame est reprise telle quelle
+ */
+void touch_filter_reset(touch_filter_t *filter);
+
+/**
+ * @brief Change l'horizon de prédiction (latence mesurée)
+ */
+void touch_filter_set_horizon(touch_filter_t *filter, uint32_t horizon_us);
+
+/**
+ * @brief Filtre une position du contact suivi
+ * @param t_us Instant de la trame (interruption)
+ */
+void touch_filter_update(touch_filter_t *filter, int64_t t_us, int32_t x, int32_t y,
+                         touch_filter_out_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TOUCH_FILTER_H
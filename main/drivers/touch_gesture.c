@@ -0,0 +1,293 @@
+/**
+ * @file touch_gesture.c
+ * @brief Suivi des contacts GT911 et reconnaissance de gestes
+ * @author NovaReptileElevage Team
+ */
+
+#include "touch_gesture.h"
+#include <string.h>
+
+enum {
+    GESTURE_MODE_IDLE,      // Aucun contact
+    GESTURE_MODE_SINGLE,    // Un seul contact depuis l'appui
+    GESTURE_MODE_PENDING,   // Deux doigts, aucun seuil franchi
+    GESTURE_MODE_PINCH,
+    GESTURE_MODE_PAN,
+    GESTURE_MODE_DONE,      // Geste terminé, attente du relâcher complet
+};
+
+static int32_t iabs32(int32_t v)
+{
+    return v < 0 ? -v : v;
+}
+
+/**
+ * @brief Racine carrée entière, 16 itérations quelle que soit la valeur
+ */
+static uint32_t isqrt32(uint32_t v)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+
+    for (int i = 0; i < 16; i++) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+void touch_gesture_init(touch_gesture_engine_t *eng)
+{
+    memset(eng, 0, sizeof(*eng));
+}
+
+static touch_gesture_t *gesture_emit(touch_gesture_t *out, uint8_t *n, uint8_t type, uint8_t phase,
+                                     const touch_gesture_engine_t *eng, int64_t t_us)
+{
+    touch_gesture_t *g = &out[(*n)++];
+    memset(g, 0, sizeof(*g));
+    g->type = type;
+    g->phase = phase;
+    g->contacts = eng->active;
+    g->t_ms = (uint32_t)(t_us / 1000);
+    return g;
+}
+
+/**
+ * @brief Centre, écart et déplacement des deux doigts du geste
+ */
+static void gesture_pair_measure(const touch_gesture_engine_t *eng, int16_t *cx, int16_t *cy, int32_t *d)
+{
+    const touch_contact_t *a = &eng->contacts[eng->pair[0]];
+    const touch_contact_t *b = &eng->contacts[eng->pair[1]];
+    int32_t dx = b->x - a->x;
+    int32_t dy = b->y - a->y;
+
+    *cx = (int16_t)((a->x + b->x) / 2);
+    *cy = (int16_t)((a->y + b->y) / 2);
+    *d = (int32_t)isqrt32((uint32_t)(dx * dx + dy * dy));
+}
+
+static void gesture_fill_pair(const touch_gesture_engine_t *eng, touch_gesture_t *g, int16_t cx, int16_t cy,
+                              int32_t d)
+{
+    int32_t scale = d * 256 / (eng->d0 > 0 ? eng->d0 : 1);
+    g->x = cx;
+    g->y = cy;
+    g->dx = (int16_t)(cx - eng->cx0);
+    g->dy = (int16_t)(cy - eng->cy0);
+    g->scale_q8 = (uint16_t)(scale > UINT16_MAX ? UINT16_MAX : scale);
+}
+
+/**
+ * @brief Deux doigts : démarrage, suivi et fin du pincement ou du glissé
+ */
+static void gesture_update_pair(touch_gesture_engine_t *eng, int64_t t_us, touch_gesture_t *out, uint8_t *n)
+{
+    bool lifted = !eng->contacts[eng->pair[0]].active || !eng->contacts[eng->pair[1]].active;
+
+    if (lifted) {
+        if (eng->mode == GESTURE_MODE_PINCH || eng->mode == GESTURE_MODE_PAN) {
+            touch_gesture_t *g = gesture_emit(out, n, eng->last.type, TOUCH_GESTURE_END, eng, t_us);
+            g->x = eng->last.x;
+            g->y = eng->last.y;
+            g->dx = eng->last.dx;
+            g->dy = eng->last.dy;
+            g->scale_q8 = eng->last.scale_q8;
+        }
+        eng->mode = GESTURE_MODE_DONE;
+        return;
+    }
+
+    int16_t cx;
+    int16_t cy;
+    int32_t d;
+    gesture_pair_measure(eng, &cx, &cy, &d);
+
+    uint8_t phase = TOUCH_GESTURE_UPDATE;
+    if (eng->mode == GESTURE_MODE_PENDING) {
+        if (iabs32(d - eng->d0) >= TOUCH_GESTURE_PINCH_SLOP_PX) {
+            eng->mode = GESTURE_MODE_PINCH;
+        } else if (iabs32(cx - eng->cx0) + iabs32(cy - eng->cy0) >= TOUCH_GESTURE_PAN_SLOP_PX) {
+            eng->mode = GESTURE_MODE_PAN;
+        } else {
+            return;
+        }
+        phase = TOUCH_GESTURE_BEGIN;
+    }
+
+    uint8_t type = eng->mode == GESTURE_MODE_PINCH ? TOUCH_GESTURE_PINCH : TOUCH_GESTURE_PAN;
+    touch_gesture_t g = {0};
+    gesture_fill_pair(eng, &g, cx, cy, d);
+    if (phase == TOUCH_GESTURE_UPDATE && g.x == eng->last.x && g.y == eng->last.y &&
+        g.scale_q8 == eng->last.scale_q8) {
+        // Doigts immobiles : rien de nouveau à transmettre
+        return;
+    }
+    touch_gesture_t *e = gesture_emit(out, n, type, phase, eng, t_us);
+    gesture_fill_pair(eng, e, cx, cy, d);
+    eng->last = *e;
+}
+
+/**
+ * @brief Contact unique : appui long pendant l'appui, swipe au relâcher
+ */
+static void gesture_update_single(touch_gesture_engine_t *eng, const touch_contact_t *c, int64_t t_us,
+                                  touch_gesture_t *out, uint8_t *n)
+{
+    int32_t dx = c->x - c->x0;
+    int32_t dy = c->y - c->y0;
+
+    if (iabs32(dx) > TOUCH_GESTURE_SLOP_PX || iabs32(dy) > TOUCH_GESTURE_SLOP_PX) {
+        eng->moved = true;
+    }
+
+    if (c->active) {
+        if (!eng->moved && t_us - c->t0_us >= TOUCH_GESTURE_LONG_PRESS_MS * 1000LL) {
+            touch_gesture_t *g = gesture_emit(out, n, TOUCH_GESTURE_LONG_PRESS, TOUCH_GESTURE_END, eng, t_us);
+            g->x = c->x;
+            g->y = c->y;
+            // Un seul appui long par contact
+            eng->moved = true;
+        }
+        return;
+    }
+
+    int32_t ms = (int32_t)((t_us - c->t0_us) / 1000);
+    int32_t dist = iabs32(dx) > iabs32(dy) ? iabs32(dx) : iabs32(dy);
+    if (dist < TOUCH_GESTURE_SWIPE_MIN_PX || ms > TOUCH_GESTURE_SWIPE_MAX_MS) {
+        return;
+    }
+    touch_gesture_t *g = gesture_emit(out, n, TOUCH_GESTURE_SWIPE, TOUCH_GESTURE_END, eng, t_us);
+    if (iabs32(dx) > iabs32(dy)) {
+        g->dir = dx < 0 ? TOUCH_GESTURE_DIR_LEFT : TOUCH_GESTURE_DIR_RIGHT;
+    } else {
+        g->dir = dy < 0 ? TOUCH_GESTURE_DIR_UP : TOUCH_GESTURE_DIR_DOWN;
+    }
+    g->x = c->x0;
+    g->y = c->y0;
+    g->dx = (int16_t)dx;
+    g->dy = (int16_t)dy;
+    int32_t speed = dist * 1000 / (ms > 0 ? ms : 1);
+    g->speed = (uint16_t)(speed > UINT16_MAX ? UINT16_MAX : speed);
+}
+
+uint8_t touch_gesture_update(touch_gesture_engine_t *eng, const touch_frame_t *frame, touch_gesture_t *out)
+{
+    bool seen[TOUCH_FRAME_MAX_POINTS] = {false};
+    int8_t single = -1;
+    uint8_t n = 0;
+
+    bool matched[TOUCH_FRAME_MAX_POINTS] = {false};
+    uint8_t count = frame->count < TOUCH_FRAME_MAX_POINTS ? frame->count : TOUCH_FRAME_MAX_POINTS;
+
+    // Contacts reconnus par identifiant, quel que soit leur rang dans la trame
+    for (uint8_t p = 0; p < count; p++) {
+        const touch_point_t *pt = &frame->points[p];
+        for (uint8_t s = 0; s < TOUCH_FRAME_MAX_POINTS; s++) {
+            touch_contact_t *c = &eng->contacts[s];
+            if (c->active && !seen[s] && c->id == pt->track_id) {
+                c->x = (int16_t)pt->x;
+                c->y = (int16_t)pt->y;
+                seen[s] = true;
+                matched[p] = true;
+                break;
+            }
+        }
+    }
+    // Nouveaux contacts dans un emplacement libre
+    for (uint8_t p = 0; p < count; p++) {
+        const touch_point_t *pt = &frame->points[p];
+        for (uint8_t s = 0; !matched[p] && s < TOUCH_FRAME_MAX_POINTS; s++) {
+            touch_contact_t *c = &eng->contacts[s];
+            if (!c->active) {
+                c->active = true;
+                c->id = pt->track_id;
+                c->x = c->x0 = (int16_t)pt->x;
+                c->y = c->y0 = (int16_t)pt->y;
+                c->t0_us = frame->t_us;
+                seen[s] = true;
+                matched[p] = true;
+            }
+        }
+    }
+
+    // Contacts absents de la trame : levés
+    uint8_t was_active = eng->active;
+    eng->active = 0;
+    for (uint8_t s = 0; s < TOUCH_FRAME_MAX_POINTS; s++) {
+        if (eng->contacts[s].active && !seen[s]) {
+            eng->contacts[s].active = false;
+            if (eng->mode == GESTURE_MODE_SINGLE) {
+                single = (int8_t)s;
+            }
+        }
+        if (eng->contacts[s].active) {
+            eng->active++;
+            if (eng->mode == GESTURE_MODE_SINGLE) {
+                single = (int8_t)s;
+            }
+        }
+    }
+
+    if (!was_active && eng->active) {
+        eng->mode = GESTURE_MODE_SINGLE;
+        eng->moved = false;
+    }
+    if (eng->mode == GESTURE_MODE_SINGLE && eng->active >= 2) {
+        // Second doigt : plus de geste à un doigt jusqu'au relâcher complet
+        uint8_t k = 0;
+        for (uint8_t s = 0; s < TOUCH_FRAME_MAX_POINTS && k < 2; s++) {
+            if (eng->contacts[s].active) {
+                eng->pair[k++] = s;
+            }
+        }
+        eng->mode = GESTURE_MODE_PENDING;
+        memset(&eng->last, 0, sizeof(eng->last));
+        gesture_pair_measure(eng, &eng->cx0, &eng->cy0, &eng->d0);
+        eng->last.x = eng->cx0;
+        eng->last.y = eng->cy0;
+        eng->last.scale_q8 = 256;
+    }
+
+    switch (eng->mode) {
+        case GESTURE_MODE_SINGLE:
+            if (single >= 0) {
+                gesture_update_single(eng, &eng->contacts[single], frame->t_us, out, &n);
+            }
+            break;
+        case GESTURE_MODE_PENDING:
+        case GESTURE_MODE_PINCH:
+        case GESTURE_MODE_PAN:
+            gesture_update_pair(eng, frame->t_us, out, &n);
+            break;
+        default:
+            break;
+    }
+
+    if (!eng->active) {
+        eng->mode = GESTURE_MODE_IDLE;
+    }
+    return n;
+}
+
+uint8_t touch_gesture_tick(touch_gesture_engine_t *eng, int64_t now_us, touch_gesture_t *out)
+{
+    uint8_t n = 0;
+
+    if (eng->mode != GESTURE_MODE_SINGLE || eng->moved) {
+        return 0;
+    }
+    for (uint8_t s = 0; s < TOUCH_FRAME_MAX_POINTS; s++) {
+        if (eng->contacts[s].active) {
+            gesture_update_single(eng, &eng->contacts[s], now_us, out, &n);
+            break;
+        }
+    }
+    return n;
+}
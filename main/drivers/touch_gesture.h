@@ -0,0 +1,120 @@
+/**
+ * @file touch_gesture.h
+ * @brief Suivi des contacts GT911 et reconnaissance de gestes
+ * @author NovaReptileElevage Team
+ *
+ * Les contacts sont suivis par identifiant de suivi du GT911, quel que soit
+ * leur ordre dans la trame. Le moteur tourne dans la tâche tactile, trame
+ * par trame, à coût borné (5 contacts au plus, aucune allocation) ; il
+ * produit des événements compacts : pincement et glissé à deux doigts
+ * (début, mise à jour, fin), appui long et swipe (événement unique).
+ * Les valeurs d'un geste continu sont relatives à son début : un
+ * consommateur en retard peut ne garder que la dernière mise à jour.
+ */
+
+#ifndef TOUCH_GESTURE_H
+#define TOUCH_GESTURE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "touch_ring.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Appui immobile au-delà duquel l'appui long est reconnu */
+#define TOUCH_GESTURE_LONG_PRESS_MS 500
+/** Déplacement toléré d'un appui immobile */
+#define TOUCH_GESTURE_SLOP_PX 12
+/** Swipe : distance minimale et durée maximale du contact */
+#define TOUCH_GESTURE_SWIPE_MIN_PX 80
+#define TOUCH_GESTURE_SWIPE_MAX_MS 400
+/** Deux doigts : variation d'écart (pincement) ou de centre (glissé) qui démarre le geste */
+#define TOUCH_GESTURE_PINCH_SLOP_PX 20
+#define TOUCH_GESTURE_PAN_SLOP_PX 16
+
+/** Événements produits au plus par trame (fin d'un geste et appui long, par ex.) */
+#define TOUCH_GESTURE_MAX_EVENTS 2
+
+typedef enum {
+    TOUCH_GESTURE_PINCH = 1,
+    TOUCH_GESTURE_PAN,
+    TOUCH_GESTURE_LONG_PRESS,
+    TOUCH_GESTURE_SWIPE,
+} touch_gesture_type_t;
+
+typedef enum {
+    TOUCH_GESTURE_BEGIN,
+    TOUCH_GESTURE_UPDATE,
+    TOUCH_GESTURE_END,   /**< Aussi la phase des gestes à événement unique */
+} touch_gesture_phase_t;
+
+typedef enum {
+    TOUCH_GESTURE_DIR_NONE,
+    TOUCH_GESTURE_DIR_LEFT,
+    TOUCH_GESTURE_DIR_RIGHT,
+    TOUCH_GESTURE_DIR_UP,
+    TOUCH_GESTURE_DIR_DOWN,
+} touch_gesture_dir_t;
+
+/**
+ * @brief Événement de geste (20 octets)
+ */
+typedef struct {
+    uint8_t type;       /**< touch_gesture_type_t */
+    uint8_t phase;      /**< touch_gesture_phase_t */
+    uint8_t dir;        /**< Swipe : touch_gesture_dir_t */
+    uint8_t contacts;   /**< Contacts posés */
+    int16_t x;          /**< Centre des deux doigts, ou point du contact */
+    int16_t y;
+    int16_t dx;         /**< Déplacement depuis le début du geste */
+    int16_t dy;
+    uint16_t scale_q8;  /**< Pincement : écart / écart initial, 256 = 1 */
+    uint16_t speed;     /**< Swipe : px/s sur l'axe dominant */
+    uint32_t t_ms;      /**< Horodatage de la trame */
+} touch_gesture_t;
+
+typedef struct {
+    bool active;
+    uint8_t id;       /**< Identifiant de suivi du GT911 */
+    int16_t x;
+    int16_t y;
+    int16_t x0;       /**< Point d'appui */
+    int16_t y0;
+    int64_t t0_us;    /**< Instant d'appui */
+} touch_contact_t;
+
+typedef struct {
+    touch_contact_t contacts[TOUCH_FRAME_MAX_POINTS];
+    uint8_t active;     /**< Contacts posés */
+    uint8_t mode;       /**< État interne de la reconnaissance */
+    bool moved;         /**< Contact unique sorti de la tolérance */
+    uint8_t pair[2];    /**< Emplacements des deux doigts du geste */
+    int32_t d0;         /**< Écart initial des deux doigts */
+    int16_t cx0;        /**< Centre initial */
+    int16_t cy0;
+    touch_gesture_t last;  /**< Dernier événement continu émis */
+} touch_gesture_engine_t;
+
+void touch_gesture_init(touch_gesture_engine_t *eng);
+
+/**
+ * @brief Suit les contacts d'une trame et reconnaît les gestes
+ * @param out TOUCH_GESTURE_MAX_EVENTS emplacements
+ * @return Événements écrits dans out
+ */
+uint8_t touch_gesture_update(touch_gesture_engine_t *eng, const touch_frame_t *frame,
+                             touch_gesture_t *out);
+
+/**
+ * @brief Appui long d'un contact immobile, sans nouvelle trame du contrôleur
+ * @return Événements écrits dans out
+ */
+uint8_t touch_gesture_tick(touch_gesture_engine_t *eng, int64_t now_us, touch_gesture_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TOUCH_GESTURE_H
@@ -0,0 +1,52 @@
+/**
+ * @file touch_latency.c
+ * @brief Latence entre une interruption tactile et la trame qui y répond
+ * @author NovaReptileElevage Team
+ */
+
+#include "touch_latency.h"
+#include <string.h>
+
+void touch_latency_reset(touch_latency_t *lat)
+{
+    memset(lat, 0, sizeof(*lat));
+}
+
+void touch_latency_add(touch_latency_t *lat, uint32_t us)
+{
+    lat->samples[lat->count % TOUCH_LATENCY_WINDOW] = us;
+    lat->count++;
+    lat->sum_us += us;
+    if (us > lat->max_us) {
+        lat->max_us = us;
+    }
+}
+
+void touch_latency_get(const touch_latency_t *lat, touch_latency_stats_t *out)
+{
+    uint32_t sorted[TOUCH_LATENCY_WINDOW];
+
+    memset(out, 0, sizeof(*out));
+    if (!lat->count) {
+        return;
+    }
+    uint32_t n = lat->count < TOUCH_LATENCY_WINDOW ? lat->count : TOUCH_LATENCY_WINDOW;
+    memcpy(sorted, lat->samples, n * sizeof(sorted[0]));
+    // Tri par insertion : 64 valeurs au plus, hors contexte temps réel
+    for (uint32_t i = 1; i < n; i++) {
+        uint32_t v = sorted[i];
+        uint32_t j = i;
+        while (j > 0 && sorted[j - 1] > v) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = v;
+    }
+
+    out->count = lat->count;
+    out->last_us = lat->samples[(lat->count - 1) % TOUCH_LATENCY_WINDOW];
+    out->mean_us = (uint32_t)(lat->sum_us / lat->count);
+    out->p50_us = sorted[(n * 50 + 99) / 100 - 1];
+    out->p99_us = sorted[(n * 99 + 99) / 100 - 1];
+    out->max_us = lat->max_us;
+}
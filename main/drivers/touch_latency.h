@@ -0,0 +1,53 @@
+/**
+ * @file touch_latency.h
+ * @brief Latence entre une interruption tactile et la trame qui y répond
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef TOUCH_LATENCY_H
+#define TOUCH_LATENCY_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Échantillons récents conservés pour les percentiles */
+#define TOUCH_LATENCY_WINDOW 64
+
+/**
+ * @brief Mesures accumulées
+ */
+typedef struct {
+    uint32_t samples[TOUCH_LATENCY_WINDOW]; /**< Derniers échantillons, en anneau */
+    uint32_t count;                         /**< Échantillons depuis la remise à zéro */
+    uint32_t max_us;
+    uint64_t sum_us;
+} touch_latency_t;
+
+/**
+ * @brief Résumé des mesures
+ */
+typedef struct {
+    uint32_t count;    /**< Échantillons depuis la remise à zéro */
+    uint32_t last_us;  /**< Dernier échantillon */
+    uint32_t mean_us;  /**< Moyenne depuis la remise à zéro */
+    uint32_t p50_us;   /**< Médiane des TOUCH_LATENCY_WINDOW derniers */
+    uint32_t p99_us;   /**< p99 des TOUCH_LATENCY_WINDOW derniers */
+    uint32_t max_us;   /**< Maximum depuis la remise à zéro */
+} touch_latency_stats_t;
+
+void touch_latency_reset(touch_latency_t *lat);
+void touch_latency_add(touch_latency_t *lat, uint32_t us);
+
+/**
+ * @brief Résume les mesures (percentiles par rang le plus proche)
+ */
+void touch_latency_get(const touch_latency_t *lat, touch_latency_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TOUCH_LATENCY_H
@@ -0,0 +1,129 @@
+/**
+ * @file touch_ring.c
+ * @brief File sans verrou des trames tactiles (un producteur, un consommateur)
+ * @author NovaReptileElevage Team
+ */
+
+#include "touch_ring.h"
+#include <string.h>
+
+_Static_assert((TOUCH_RING_SIZE & (TOUCH_RING_SIZE - 1)) == 0, "TOUCH_RING_SIZE must be a power of two");
+
+void touch_ring_init(touch_ring_t *ring)
+{
+    memset(ring->slots, 0, sizeof(ring->slots));
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->dropped, 0);
+    atomic_init(&ring->max_depth, 0);
+    ring->pending_count = 0;
+}
+
+/**
+ * @brief Copie une trame dans la file si elle a de la place
+ */
+static bool touch_ring_publish(touch_ring_t *ring, const touch_frame_t *frame)
+{
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if (head - tail >= TOUCH_RING_SIZE) {
+        return false;
+    }
+    ring->slots[head & (TOUCH_RING_SIZE - 1)] = *frame;
+    // Trame écrite avant d'être visible du consommateur
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    unsigned depth = head + 1 - tail;
+    if (depth > atomic_load_explicit(&ring->max_depth, memory_order_relaxed)) {
+        atomic_store_explicit(&ring->max_depth, depth, memory_order_relaxed);
+    }
+    return true;
+}
+
+/**
+ * @brief Ensemble des contacts d'une trame, vide pour un relâcher
+ */
+static uint32_t touch_frame_tracks(const touch_frame_t *frame)
+{
+    uint32_t tracks = 0;
+    for (uint8_t i = 0; i < frame->count && i < TOUCH_FRAME_MAX_POINTS; i++) {
+        tracks |= 1u << (frame->points[i].track_id & 31);
+    }
+    return tracks;
+}
+
+static bool touch_frame_same_state(const touch_frame_t *a, const touch_frame_t *b)
+{
+    return a->count == b->count && touch_frame_tracks(a) == touch_frame_tracks(b);
+}
+
+bool touch_ring_flush(touch_ring_t *ring)
+{
+    uint8_t sent = 0;
+    while (sent < ring->pending_count && touch_ring_publish(ring, &ring->pending[sent])) {
+        sent++;
+    }
+    if (sent) {
+        ring->pending_count -= sent;
+        memmove(&ring->pending[0], &ring->pending[sent], ring->pending_count * sizeof(touch_frame_t));
+    }
+    return ring->pending_count == 0;
+}
+
+bool touch_ring_push(touch_ring_t *ring, const touch_frame_t *frame)
+{
+    // Les trames en attente passent d'abord : l'ordre est conservé
+    if (touch_ring_flush(ring) && touch_ring_publish(ring, frame)) {
+        return true;
+    }
+    if (ring->pending_count == 0) {
+        ring->pending[ring->pending_count++] = *frame;
+        return false;
+    }
+
+    touch_frame_t *last = &ring->pending[ring->pending_count - 1];
+    if (touch_frame_same_state(last, frame)) {
+        // Même appui : seules les positions les plus récentes comptent ;
+        // deux relâchers n'en font qu'un
+        if (frame->count) {
+            *last = *frame;
+        }
+    } else if (ring->pending_count < TOUCH_RING_PENDING) {
+        ring->pending[ring->pending_count++] = *frame;
+        return false;
+    } else if (!frame->count && last->count) {
+        // Un relâcher termine l'appui en attente, qui n'a plus lieu d'être livré
+        *last = *frame;
+    }
+    // Sinon, un relâcher en attente est gardé : l'appui qui suit est relu
+    // par la tâche tactile tant que le contact est maintenu
+    atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+    return false;
+}
+
+bool touch_ring_pop(touch_ring_t *ring, touch_frame_t *frame)
+{
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    if (head == tail) {
+        return false;
+    }
+    *frame = ring->slots[tail & (TOUCH_RING_SIZE - 1)];
+    // Emplacement relu avant d'être rendu au producteur
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+uint32_t touch_ring_depth(const touch_ring_t *ring)
+{
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    return (uint32_t)(head - tail);
+}
+
+void touch_ring_get_stats(const touch_ring_t *ring, touch_ring_stats_t *out)
+{
+    out->pushed = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    out->dropped = atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+    out->depth = touch_ring_depth(ring);
+    out->max_depth = atomic_load_explicit(&ring->max_depth, memory_order_relaxed);
+}
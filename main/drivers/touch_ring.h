@@ -0,0 +1,107 @@
+/**
+ * @file touch_ring.h
+ * @brief File sans verrou des trames tactiles (un producteur, un consommateur)
+ * @author NovaReptileElevage Team
+ *
+ * La tâche tactile produit, la tâche LVGL consomme. Chaque index n'a qu'un
+ * écrivain : head avance côté producteur, tail côté consommateur, avec une
+ * sémantique acquire/release. File pleine, les trames attendent côté
+ * producteur dans deux emplacements. Seules deux trames de même état
+ * (mêmes contacts, appui en cours) fusionnent, la plus récente gardant
+ * ses positions : un relâcher en attente n'est jamais remplacé et un
+ * changement d'état occupe le second emplacement. Si les deux sont pris,
+ * le second ne cède qu'à un relâcher : la dernière trame livrée n'est
+ * jamais un appui déjà terminé.
+ */
+
+#ifndef TOUCH_RING_H
+#define TOUCH_RING_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Trames en file (puissance de deux) */
+#define TOUCH_RING_SIZE 16
+
+/** Trames en attente de place, côté producteur */
+#define TOUCH_RING_PENDING 2
+
+/** Points par trame (GT911 : 5 contacts) */
+#define TOUCH_FRAME_MAX_POINTS 5
+
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint8_t size;
+    uint8_t track_id;
+} touch_point_t;
+
+/**
+ * @brief Trame décodée du contrôleur, count = 0 pour un relâcher
+ */
+typedef struct {
+    int64_t t_us;   /**< Interruption (ou relecture) qui a produit la trame */
+    uint8_t count;  /**< Contacts de la trame */
+    touch_point_t points[TOUCH_FRAME_MAX_POINTS];
+} touch_frame_t;
+
+typedef struct {
+    touch_frame_t slots[TOUCH_RING_SIZE];
+    atomic_uint head;       /**< Trames publiées (producteur) */
+    atomic_uint tail;       /**< Trames consommées (consommateur) */
+    atomic_uint dropped;    /**< Trames fusionnées ou écartées avant publication (producteur) */
+    atomic_uint max_depth;  /**< Profondeur maximale observée (producteur) */
+    touch_frame_t pending[TOUCH_RING_PENDING]; /**< Trames en attente de place, dans l'ordre (producteur) */
+    uint8_t pending_count;
+} touch_ring_t;
+
+typedef struct {
+    uint32_t pushed;     /**< Trames publiées */
+    uint32_t dropped;    /**< Trames fusionnées ou écartées, file pleine */
+    uint32_t depth;      /**< Trames en file */
+    uint32_t max_depth;  /**< Profondeur maximale observée */
+} touch_ring_stats_t;
+
+void touch_ring_init(touch_ring_t *ring);
+
+/**
+ * @brief Publie une trame (producteur)
+ *
+ * File pleine, la trame attend la prochaine publication ou touch_ring_flush().
+ * Elle fusionne avec la dernière trame en attente si les contacts sont les
+ * mêmes, et elle est écartée si celle-ci est un relâcher de même état ou si
+ * les deux emplacements sont pris par un changement d'état qu'elle ne
+ * termine pas.
+ * @return true si la trame est en file, false si elle attend ou est écartée
+ */
+bool touch_ring_push(touch_ring_t *ring, const touch_frame_t *frame);
+
+/**
+ * @brief Publie les trames en attente s'il y a de la place (producteur)
+ * @return true s'il ne reste rien en attente
+ */
+bool touch_ring_flush(touch_ring_t *ring);
+
+/**
+ * @brief Retire la trame la plus ancienne (consommateur)
+ * @return false si la file est vide
+ */
+bool touch_ring_pop(touch_ring_t *ring, touch_frame_t *frame);
+
+/**
+ * @brief Trames en file, lisible depuis les deux côtés
+ */
+uint32_t touch_ring_depth(const touch_ring_t *ring);
+
+void touch_ring_get_stats(const touch_ring_t *ring, touch_ring_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TOUCH_RING_H
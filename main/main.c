@@ -19,15 +19,37 @@
 #include "esp_psram.h"
 
 #include "lvgl.h"
+#include "boot_sched.h"
 #include "ui_main.h"
+#include "ui_content.h"
 #include "ui_styles.h"
+#include "ui_render_bench.h"
 #include "display_driver.h"
+#include "display_buf_tuner.h"
+#include "display_governor.h"
 #include "touch_driver.h"
 #include "ch422g.h"
 #include "i2c_bus.h"
 
 static const char *TAG = "NovaReptile_Main";
 
+/* Tâches d'exécution du démarrage (1 = séquentiel, pour comparaison) */
+#ifdef CONFIG_NOVA_BOOT_WORKERS
+#define NOVA_BOOT_WORKERS CONFIG_NOVA_BOOT_WORKERS
+#else
+#define NOVA_BOOT_WORKERS 3
+#endif
+
+/* Sommeil maximal de la boucle LVGL (invalidations venues d'autres tâches) */
+#ifdef CONFIG_NOVA_LVGL_LOOP_MAX_SLEEP_MS
+#define NOVA_LVGL_LOOP_MAX_SLEEP_MS CONFIG_NOVA_LVGL_LOOP_MAX_SLEEP_MS
+#else
+#define NOVA_LVGL_LOOP_MAX_SLEEP_MS 100
+#endif
+
+/* Période du journal de latence tactile */
+#define NOVA_TOUCH_LATENCY_LOG_US (30 * 1000 * 1000)
+
 /**
  * @brief Callback du timer haute résolution pour LVGL
  *
@@ -42,6 +64,48 @@ static void lv_tick_cb(void *arg)
 /** Handle du timer haute résolution LVGL */
 static esp_timer_handle_t lvgl_tick_timer;
 
+/** Tampons de rendu issus d'une calibration enregistrée */
+static bool display_buf_calibrated;
+
+/** Mesures du démarrage, rappelées à la première trame */
+static boot_sched_report_t boot_report;
+
+#if CONFIG_NOVA_DISPLAY_BUF_AUTOTUNE
+/**
+ * @brief Scène de référence de la calibration : écrans les plus chargés
+ */
+static void display_tuner_scene(uint32_t frame, void *ctx)
+{
+    static const nova_screen_t scenes[] = {
+        SCREEN_DASHBOARD, SCREEN_REPTILES, SCREEN_TERRARIUMS,
+    };
+    (void)ctx;
+    ui_main_set_screen(scenes[frame % (sizeof(scenes) / sizeof(scenes[0]))]);
+}
+#endif
+
+/**
+ * @brief Gestes reconnus par le driver tactile (tâche LVGL, verrou tenu)
+ */
+static void touch_gesture_handler(const touch_gesture_t *gesture, void *user_data)
+{
+    (void)user_data;
+    bool done = gesture->phase == TOUCH_GESTURE_END;
+
+    switch (gesture->type) {
+        case TOUCH_GESTURE_PINCH:
+            ui_content_zoom_chart(gesture->scale_q8, gesture->x, done);
+            break;
+        case TOUCH_GESTURE_PAN:
+            ui_content_pan_chart(gesture->dx, done);
+            break;
+        default:
+            ESP_LOGD(TAG, "Geste %d (%d, %d) direction %d", gesture->type, gesture->x,
+                     gesture->y, gesture->dir);
+            break;
+    }
+}
+
 /**
  * @brief Tâche principale LVGL - Gestion des timers et événements
  * @param pvParameter Paramètres de la tâche (non utilisé)
@@ -49,105 +113,277 @@ static esp_timer_handle_t lvgl_tick_timer;
 static void lvgl_task(void *pvParameter)
 {
     ESP_LOGI(TAG, "Démarrage de la tâche LVGL");
+
+    // Première trame : temps d'affichage suivi d'une version à l'autre
+    lv_lock();
+    lv_refr_now(NULL);
+    lv_unlock();
+    display_driver_wait_flush_idle();
+    ESP_LOGI(TAG, "Première trame à %.1f ms du reset (démarrage %.1f ms)",
+             esp_timer_get_time() / 1000.0, boot_report.total_us / 1000.0);
+
+#if CONFIG_NOVA_DISPLAY_BUF_AUTOTUNE
+    if (!display_buf_calibrated) {
+        display_buf_tuner_result_t best;
+        nova_screen_t previous = ui_main_get_current_screen();
+        ESP_LOGI(TAG, "Calibration des tampons de rendu");
+        if (display_buf_tuner_run(display_tuner_scene, NULL, &best) == ESP_OK) {
+            display_buf_calibrated = true;
+        }
+        ui_main_set_screen(previous);
+    }
+#endif
+
+#if CONFIG_NOVA_UI_RENDER_BENCHMARK
+    ui_render_bench_result_t bench[SCREEN_COUNT];
+    if (ui_render_bench_run(bench) == ESP_OK) {
+        ui_render_bench_log(bench);
+    }
+#endif
     
+#if CONFIG_NOVA_DISPLAY_GOVERNOR
+    // Après calibration et benchmark, qui mesurent à la cadence nominale
+    if (display_governor_start(NULL) != ESP_OK) {
+        ESP_LOGW(TAG, "Régulateur de rafraîchissement indisponible");
+    }
+#endif
+
+    touch_driver_set_gesture_cb(touch_gesture_handler, NULL);
+
+#if CONFIG_NOVA_LVGL_EVENT_LOOP
+    // Réveil par l'interruption du GT911 ou à l'échéance du prochain timer LVGL
+    touch_driver_set_notify_task(xTaskGetCurrentTaskHandle());
+    int64_t latency_log_us = esp_timer_get_time() + NOVA_TOUCH_LATENCY_LOG_US;
+    uint32_t woken = 0;
+    while (1) {
+        lv_lock();
+#if CONFIG_NOVA_DISPLAY_GOVERNOR
+        if (woken) {
+            // Toucher : cadence nominale sans attendre le rafraîchissement lent
+            display_governor_notify_activity();
+        }
+#endif
+        touch_driver_process();
+        uint32_t sleep_ms = lv_timer_handler();
+        uint32_t poll_ms = touch_driver_next_poll_ms();
+        lv_unlock();
+        sleep_ms = LV_MIN(sleep_ms, poll_ms);
+        sleep_ms = LV_MIN(sleep_ms, NOVA_LVGL_LOOP_MAX_SLEEP_MS);
+
+        if (esp_timer_get_time() >= latency_log_us) {
+            touch_latency_stats_t latency;
+            touch_queue_stats_t queue;
+            if (touch_driver_get_latency(&latency) == ESP_OK && latency.count) {
+                ESP_LOGI(TAG, "Latence tactile → trame (%lu): p50 %lu us, p99 %lu us, max %lu us",
+                         (unsigned long)latency.count, (unsigned long)latency.p50_us,
+                         (unsigned long)latency.p99_us, (unsigned long)latency.max_us);
+            }
+            if (touch_driver_get_queue_stats(&queue) == ESP_OK && queue.ring.pushed) {
+                ESP_LOGI(TAG, "File tactile: %lu trames, %lu remplacées, profondeur max %lu, "
+                         "%lu erreurs I2C, %lu gestes (%lu perdus)",
+                         (unsigned long)queue.ring.pushed, (unsigned long)queue.ring.dropped,
+                         (unsigned long)queue.ring.max_depth, (unsigned long)queue.bus_errors,
+                         (unsigned long)queue.gestures, (unsigned long)queue.gestures_dropped);
+            }
+            latency_log_us += NOVA_TOUCH_LATENCY_LOG_US;
+        }
+
+        // Arrondi au tick supérieur, un tick au moins : les tâches de
+        // priorité inférieure (idle, watchdog) doivent pouvoir s'exécuter
+        TickType_t ticks = (sleep_ms * configTICK_RATE_HZ + 999) / 1000;
+        woken = ulTaskNotifyTake(pdTRUE, ticks ? ticks : 1);
+    }
+#else
     while (1) {
         // Mise à jour des timers LVGL (recommandé toutes les 1-10ms)
+        lv_lock();
+        touch_driver_process();
         lv_timer_handler();
+        lv_unlock();
         vTaskDelay(pdMS_TO_TICKS(10));
     }
+#endif
 }
 
-/**
- * @brief Initialisation du système NovaReptileElevage
- *
- * Les différentes sous-systèmes sont initialisés séquentiellement. En cas
- * d'échec, les ressources sont libérées en ordre inverse de leur allocation :
- * interface (ui_styles), driver tactile, driver d'affichage puis cœur LVGL.
- * @return esp_err_t Code d'erreur ESP
- */
-static esp_err_t nova_reptile_init(void)
+/* Étapes du démarrage, dans l'ordre de priorité entre étapes prêtes */
+enum {
+    BOOT_NVS,
+    BOOT_PSRAM,
+    BOOT_I2C,
+    BOOT_LVGL,
+    BOOT_CH422G,
+    BOOT_DISPLAY,
+    BOOT_PANEL,
+    BOOT_UI,
+    BOOT_TOUCH,
+    BOOT_STAGE_COUNT,
+};
+
+static esp_err_t boot_nvs(void *arg)
 {
-    esp_err_t ret = ESP_OK;
-    
-    // Initialisation de la mémoire flash NVS
-    ret = nvs_flash_init();
+    (void)arg;
+    esp_err_t ret = nvs_flash_init();
     if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
-        ESP_ERROR_CHECK(nvs_flash_erase());
-        ret = nvs_flash_init();
+        ret = nvs_flash_erase();
+        if (ret == ESP_OK) {
+            ret = nvs_flash_init();
+        }
     }
-    ESP_ERROR_CHECK(ret);
+    return ret;
+}
 
-    // Initialisation et vérification de la PSRAM
-    ret = esp_psram_init();
+static esp_err_t boot_psram(void *arg)
+{
+    (void)arg;
+    esp_err_t ret = esp_psram_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Erreur initialisation PSRAM: %s", esp_err_to_name(ret));
         return ret;
     }
-
-    size_t psram_size = esp_psram_get_size();
-    if (psram_size == 0) {
+    if (esp_psram_get_size() == 0) {
         ESP_LOGE(TAG, "Aucune PSRAM détectée - initialisation annulée");
         return ESP_ERR_NO_MEM;
     }
+    return ESP_OK;
+}
+
+static esp_err_t boot_i2c(void *arg)
+{
+    (void)arg;
+    return i2c_bus_init();
+}
+
+static void boot_i2c_undo(void *arg)
+{
+    (void)arg;
+    i2c_bus_deinit();
+}
 
-    // Initialisation de LVGL
+static esp_err_t boot_lvgl(void *arg)
+{
+    (void)arg;
     ESP_LOGI(TAG, "Initialisation LVGL v%d.%d.%d",
              lv_version_major(), lv_version_minor(), lv_version_patch());
     lv_init();
+    return ESP_OK;
+}
 
-    // Initialisation du bus I2C partagé
-    ret = i2c_bus_init();
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Erreur initialisation I2C: %s", esp_err_to_name(ret));
-        lv_deinit();
-        return ret;
-    }
+static void boot_lvgl_undo(void *arg)
+{
+    (void)arg;
+    lv_deinit();
+}
 
-    // Initialisation du pilote CH422G
-    ret = ch422g_init();
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Erreur initialisation CH422G: %s", esp_err_to_name(ret));
-        lv_deinit();
-        return ret;
-    }
+static esp_err_t boot_ch422g(void *arg)
+{
+    (void)arg;
+    return ch422g_init();
+}
 
-    // Initialisation du driver d'affichage ST7701
-    ret = display_driver_init();
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Erreur initialisation display: %s", esp_err_to_name(ret));
-        // Libération en ordre inverse: ch422g -> LVGL
-        ch422g_deinit();
-        i2c_bus_deinit();
-        lv_deinit();
-        return ret;
-    }
+static void boot_ch422g_undo(void *arg)
+{
+    (void)arg;
+    ch422g_deinit();
+}
 
-    // Initialisation du driver tactile GT911
-    ret = touch_driver_init();
+/**
+ * @brief Panneau RGB et affichage LVGL (tampons calibrés s'ils existent)
+ *
+ * La séquence de commandes ST7701 est différée à l'étape suivante : l'écran
+ * LVGL existe dès la fin de cette étape et l'interface peut être construite
+ * pendant les délais imposés par le contrôleur.
+ */
+static esp_err_t boot_display(void *arg)
+{
+    (void)arg;
+    display_driver_config_t display_config = DISPLAY_DRIVER_DEFAULT_CONFIG();
+    display_buf_calibrated = display_buf_tuner_load(&display_config) == ESP_OK;
+    display_config.defer_panel_start = true;
+    return display_driver_init_with_config(&display_config);
+}
+
+static void boot_display_undo(void *arg)
+{
+    (void)arg;
+    display_driver_deinit();
+}
+
+static esp_err_t boot_panel(void *arg)
+{
+    (void)arg;
+    return display_driver_start_panel();
+}
+
+static esp_err_t boot_ui(void *arg)
+{
+    (void)arg;
+    esp_err_t ret = ui_main_init();
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Erreur initialisation touch: %s", esp_err_to_name(ret));
-        // Libération en ordre inverse: display -> LVGL
-        display_driver_deinit();
-        ch422g_deinit();
-        i2c_bus_deinit();
-        lv_deinit();
-        return ret;
+        // ui_main_init() libère ses objets, pas les styles
+        ui_styles_deinit();
     }
+    return ret;
+}
+
+static void boot_ui_undo(void *arg)
+{
+    (void)arg;
+    ui_main_deinit();
+}
+
+static esp_err_t boot_touch(void *arg)
+{
+    (void)arg;
+    return touch_driver_init();
+}
+
+static void boot_touch_undo(void *arg)
+{
+    (void)arg;
+    touch_driver_deinit();
+}
 
-    // Initialisation de l'interface utilisateur
-    ret = ui_main_init();
+/**
+ * Graphe du démarrage : le reset du GT911 (110 ms) et la construction de
+ * l'interface se déroulent pendant la séquence ST7701 (360 ms de délais).
+ */
+static const boot_stage_t boot_stages[BOOT_STAGE_COUNT] = {
+    [BOOT_NVS] = {.name = "nvs", .run = boot_nvs},
+    [BOOT_PSRAM] = {.name = "psram", .run = boot_psram},
+    [BOOT_I2C] = {.name = "i2c", .run = boot_i2c, .undo = boot_i2c_undo},
+    [BOOT_LVGL] = {.name = "lvgl", .run = boot_lvgl, .undo = boot_lvgl_undo,
+                   .deps = BOOT_STAGE_DEP(BOOT_PSRAM)},
+    [BOOT_CH422G] = {.name = "ch422g", .run = boot_ch422g, .undo = boot_ch422g_undo,
+                     .deps = BOOT_STAGE_DEP(BOOT_I2C)},
+    [BOOT_DISPLAY] = {.name = "display", .run = boot_display, .undo = boot_display_undo,
+                      .deps = BOOT_STAGE_DEP(BOOT_NVS) | BOOT_STAGE_DEP(BOOT_LVGL) |
+                              BOOT_STAGE_DEP(BOOT_CH422G),
+                      .lvgl_lock = true},
+    [BOOT_PANEL] = {.name = "panel", .run = boot_panel, .deps = BOOT_STAGE_DEP(BOOT_DISPLAY)},
+    [BOOT_UI] = {.name = "ui", .run = boot_ui, .undo = boot_ui_undo,
+                 .deps = BOOT_STAGE_DEP(BOOT_DISPLAY), .lvgl_lock = true},
+    [BOOT_TOUCH] = {.name = "touch", .run = boot_touch, .undo = boot_touch_undo,
+                    .deps = BOOT_STAGE_DEP(BOOT_DISPLAY)},
+};
+
+/**
+ * @brief Initialisation du système NovaReptileElevage
+ *
+ * Les sous-systèmes sont initialisés par l'ordonnanceur de démarrage : les
+ * étapes indépendantes s'exécutent en parallèle et, en cas d'échec, les
+ * étapes réussies sont libérées dans l'ordre inverse de leur fin. Le rapport
+ * par étape est journalisé dans tous les cas.
+ * @return esp_err_t Code d'erreur ESP
+ */
+static esp_err_t nova_reptile_init(void)
+{
+    esp_err_t ret = boot_sched_run(boot_stages, BOOT_STAGE_COUNT, NOVA_BOOT_WORKERS, &boot_report);
+    boot_sched_log_report(boot_stages, &boot_report);
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Erreur initialisation UI: %s", esp_err_to_name(ret));
-        // Libération en ordre inverse: styles -> touch -> display -> LVGL
-        ui_styles_deinit();
-        touch_driver_deinit();
-        display_driver_deinit();
-        ch422g_deinit();
-        i2c_bus_deinit();
-        lv_deinit();
+        ESP_LOGE(TAG, "Erreur initialisation: %s", esp_err_to_name(ret));
         return ret;
     }
-    
+
     ESP_LOGI(TAG, "Système NovaReptileElevage initialisé avec succès");
     return ESP_OK;
 }
@@ -166,6 +402,7 @@ static void nova_reptile_deinit(void)
         lvgl_tick_timer = NULL;
     }
 
+    display_governor_stop();
     ui_main_deinit();
     touch_driver_deinit();
     display_driver_deinit();
@@ -199,6 +436,8 @@ void app_main(void)
     ESP_ERROR_CHECK(esp_timer_start_periodic(lvgl_tick_timer, 1000));
 
     // Création de la tâche LVGL (priorité élevée pour la fluidité)
+    // Les unités de dessin LVGL (LV_DRAW_SW_DRAW_UNIT_CNT) ont leurs propres
+    // tâches non épinglées : le rendu d'une trame occupe aussi le cœur 0
     // Si la création échoue, l'erreur est journalisée et le système redémarre
     BaseType_t task_ret = xTaskCreatePinnedToCore(
         lvgl_task,              // Fonction de la tâche
@@ -207,7 +446,7 @@ void app_main(void)
         NULL,                   // Paramètres
         5,                      // Priorité (élevée)
         NULL,                   // Handle de la tâche
-        1                       // Core 1 (Core 0 pour WiFi/BT)
+        1                       // Core 1 (Core 0 : flush et unité de dessin)
     );
 
     if (task_ret != pdPASS) {
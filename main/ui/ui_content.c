@@ -8,13 +8,57 @@
 #include "ui_styles.h"
 #include "esp_log.h"
 #include "ui_data.h"
+#include "ui_screen_cache.h"
+#include "ui_virtual_list.h"
 #include <stdio.h>
+#include <string.h>
 
 static const char *TAG = "UI_Content";
 
+#if CONFIG_NOVA_UI_SCREEN_CACHE
+#define UI_CONTENT_CACHE_BUDGET   ((size_t)CONFIG_NOVA_UI_SCREEN_CACHE_BUDGET_KB * 1024)
+#define UI_CONTENT_CACHE_MIN_FREE ((size_t)CONFIG_NOVA_UI_SCREEN_CACHE_MIN_FREE_KB * 1024)
+#else
+// Sans cache, seul l'écran affiché existe, comme avant
+#define UI_CONTENT_CACHE_BUDGET   0
+#define UI_CONTENT_CACHE_MIN_FREE 0
+#endif
+
+_Static_assert(SCREEN_COUNT <= UI_SCREEN_CACHE_SLOTS, "un emplacement de cache par écran");
+
+// Cartes de hauteur fixe : les listes n'en créent que pour l'écran visible
+#define REPTILE_CARD_HEIGHT     76
+#define REPTILE_LIST_OVERSCAN   2
+#define TERRARIUM_CARD_HEIGHT   110
+#define TERRARIUM_GRID_COLUMNS  2
+#define TERRARIUM_GRID_OVERSCAN 1
+// Graphique des statistiques : 24 mesures horaires, zoom ×1 à ×8 (Q8)
+#define STATS_CHART_POINTS      24
+#define STATS_CHART_ZOOM_MIN    256
+#define STATS_CHART_ZOOM_MAX    2048
+
 static lv_obj_t *content_container;
 static lv_obj_t *current_screen_container;
 static nova_screen_t current_screen = SCREEN_DASHBOARD;
+static ui_screen_cache_t screen_cache;
+// Écran construit à l'appui d'un élément de menu, pas encore affiché
+static lv_obj_t *prebuilt_screen;
+// Grille virtuelle des terrariums, tant que son écran existe
+static lv_obj_t *terrarium_grid;
+// Graphique des statistiques et sa vue défilante, tant que leur écran existe
+static lv_obj_t *stats_chart;
+static lv_obj_t *stats_chart_view;
+static uint32_t stats_chart_zoom = STATS_CHART_ZOOM_MIN;   // Zoom au repos
+static uint32_t stats_chart_zoom_shown = STATS_CHART_ZOOM_MIN;
+static int32_t stats_chart_pan_origin = -1;                // Défilement au début du glissé
+
+#if LV_USE_CHART
+// Températures moyennes horaires des dernières 24 h, en dixièmes de °C
+static const int16_t stats_temperature_24h[STATS_CHART_POINTS] = {
+    231, 228, 225, 223, 221, 221, 224, 232, 243, 254, 263, 270,
+    275, 278, 277, 272, 266, 259, 252, 247, 243, 239, 236, 233,
+};
+#endif
 
 // Prototypes des fonctions de création d'écrans
 static lv_obj_t* create_dashboard_screen(lv_obj_t *parent);
@@ -142,6 +186,75 @@ static lv_obj_t* create_dashboard_screen(lv_obj_t *parent)
     return screen;
 }
 
+/**
+ * @brief Crée une carte de reptile vierge, reliée ensuite par bind_reptile_card()
+ * @param list Liste virtuelle parente
+ * @param user_data Inutilisé
+ * @return lv_obj_t* Carte créée
+ */
+static lv_obj_t* create_reptile_card(lv_obj_t *list, void *user_data)
+{
+    (void)user_data;
+    lv_obj_t *reptile_card = lv_obj_create(list);
+    if (!reptile_card) {
+        ESP_LOGE(TAG, "Erreur création carte reptile");
+        return NULL;
+    }
+    lv_obj_remove_style_all(reptile_card);
+    lv_obj_add_style(reptile_card, ui_styles_get_card_style(), 0);
+    lv_obj_set_flex_flow(reptile_card, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(reptile_card, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    lv_obj_set_style_pad_all(reptile_card, 16, 0);
+    lv_obj_set_style_pad_gap(reptile_card, 10, 0);
+    lv_obj_clear_flag(reptile_card, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *text_cont = lv_obj_create(reptile_card);
+    lv_obj_remove_style_all(text_cont);
+    lv_obj_set_size(text_cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(text_cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_flex_grow(text_cont, 1);
+
+    lv_obj_t *reptile_name = lv_label_create(text_cont);
+    lv_obj_add_style(reptile_name, ui_styles_get_text_subtitle(), 0);
+
+    lv_obj_t *reptile_status = lv_label_create(text_cont);
+    lv_label_set_text_static(reptile_status, "État: Actif • Dernière alimentation: 2j");
+    lv_obj_add_style(reptile_status, ui_styles_get_text_small(), 0);
+
+    lv_obj_t *actions = lv_obj_create(reptile_card);
+    lv_obj_remove_style_all(actions);
+    lv_obj_set_size(actions, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(actions, LV_FLEX_FLOW_ROW);
+    lv_obj_set_style_pad_gap(actions, 10, 0);
+
+    lv_obj_t *edit_btn = lv_btn_create(actions);
+    lv_obj_add_style(edit_btn, ui_styles_get_button_secondary(), 0);
+    lv_obj_set_size(edit_btn, 60, 30);
+    lv_obj_t *edit_label = lv_label_create(edit_btn);
+    lv_label_set_text_static(edit_label, "Éditer");
+    lv_obj_center(edit_label);
+
+    lv_obj_t *view_btn = lv_btn_create(actions);
+    lv_obj_add_style(view_btn, ui_styles_get_button_primary(), 0);
+    lv_obj_set_size(view_btn, 60, 30);
+    lv_obj_t *view_label = lv_label_create(view_btn);
+    lv_label_set_text_static(view_label, "Voir");
+    lv_obj_center(view_label);
+
+    return reptile_card;
+}
+
+/**
+ * @brief Affiche le reptile d'index donné dans une carte recyclée
+ */
+static void bind_reptile_card(lv_obj_t *reptile_card, size_t index, void *user_data)
+{
+    (void)user_data;
+    lv_obj_t *reptile_name = lv_obj_get_child(lv_obj_get_child(reptile_card, 0), 0);
+    // Collection conservée par l'appelant de ui_data_set_reptiles() pendant l'affichage
+    lv_label_set_text_static(reptile_name, index < g_ui_reptiles_count ? g_ui_reptiles[index] : "");
+}
+
 /**
  * @brief Crée l'écran de gestion des reptiles
  * @param parent Conteneur parent
@@ -179,62 +292,166 @@ static lv_obj_t* create_reptiles_screen(lv_obj_t *parent)
     lv_label_set_text(add_label, "+ Nouveau Reptile");
     lv_obj_center(add_label);
 
-    // Liste des reptiles configurable
+    // Liste des reptiles : seules les cartes visibles existent, recyclées au défilement
+    const ui_virtual_list_config_t list_config = {
+        .row_height = REPTILE_CARD_HEIGHT,
+        .row_gap = 10,
+        .overscan = REPTILE_LIST_OVERSCAN,
+        .count = g_ui_reptiles_count,
+        .create_row = create_reptile_card,
+        .bind_row = bind_reptile_card,
+    };
+    lv_obj_t *list = ui_virtual_list_create(screen, &list_config);
+    if (!list) {
+        ESP_LOGE(TAG, "Erreur création liste reptiles");
+        return NULL;
+    }
+    lv_obj_set_flex_grow(list, 1);
 
-    lv_obj_t *list = lv_obj_create(screen);
-    lv_obj_remove_style_all(list);
-    lv_obj_set_size(list, lv_pct(100), LV_SIZE_CONTENT);
-    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_style_pad_gap(list, 10, 0);
+    ESP_LOGI(TAG, "Écran reptiles créé");
+    return screen;
+}
 
-    for (size_t i = 0; i < g_ui_reptiles_count; i++) {
-        lv_obj_t *reptile_card = lv_obj_create(list);
-        if (!reptile_card) {
-            ESP_LOGE(TAG, "Erreur création carte reptile %d", i);
-            return NULL;
-        }
-        lv_obj_remove_style_all(reptile_card);
-        lv_obj_add_style(reptile_card, ui_styles_get_card_style(), 0);
-        lv_obj_set_size(reptile_card, lv_pct(100), LV_SIZE_CONTENT);
-        lv_obj_set_flex_flow(reptile_card, LV_FLEX_FLOW_ROW);
-        lv_obj_set_style_pad_all(reptile_card, 16, 0);
-        lv_obj_set_style_pad_gap(reptile_card, 10, 0);
-
-        lv_obj_t *text_cont = lv_obj_create(reptile_card);
-        lv_obj_remove_style_all(text_cont);
-        lv_obj_set_flex_flow(text_cont, LV_FLEX_FLOW_COLUMN);
-        lv_obj_set_flex_grow(text_cont, 1);
+/**
+ * @brief Crée une carte de terrarium vierge, reliée ensuite par bind_terrarium_card()
+ * @param row Ligne de la grille
+ * @return lv_obj_t* Carte créée
+ */
+static lv_obj_t* create_terrarium_card(lv_obj_t *row)
+{
+    lv_obj_t *terrarium_card = lv_obj_create(row);
+    if (!terrarium_card) {
+        ESP_LOGE(TAG, "Erreur création carte terrarium");
+        return NULL;
+    }
+    lv_obj_remove_style_all(terrarium_card);
+    lv_obj_add_style(terrarium_card, ui_styles_get_card_style(), 0);
+    lv_obj_set_height(terrarium_card, lv_pct(100));
+    lv_obj_set_flex_grow(terrarium_card, 1);
+    lv_obj_set_flex_flow(terrarium_card, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_all(terrarium_card, 12, 0);
+    lv_obj_set_style_pad_gap(terrarium_card, 8, 0);
+    lv_obj_clear_flag(terrarium_card, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *ter_title = lv_label_create(terrarium_card);
+    lv_obj_add_style(ter_title, ui_styles_get_text_subtitle(), 0);
+
+    lv_obj_t *data_row = lv_obj_create(terrarium_card);
+    lv_obj_remove_style_all(data_row);
+    lv_obj_set_size(data_row, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(data_row, LV_FLEX_FLOW_ROW);
+    lv_obj_set_style_pad_gap(data_row, 10, 0);
+
+    lv_obj_t *temp_label = lv_label_create(data_row);
+    lv_obj_add_style(temp_label, ui_styles_get_text_body(), 0);
+
+    lv_obj_t *hum_label = lv_label_create(data_row);
+    lv_obj_add_style(hum_label, ui_styles_get_text_body(), 0);
+
+    lv_obj_t *status_indicator = lv_obj_create(data_row);
+    if (!status_indicator) {
+        ESP_LOGE(TAG, "Erreur création indicateur terrarium");
+        return NULL;
+    }
+    lv_obj_set_size(status_indicator, 60, 25);
+    lv_obj_add_style(status_indicator, ui_styles_get_status_ok(), 0);
 
-        lv_obj_t *reptile_name = lv_label_create(text_cont);
-        lv_label_set_text(reptile_name, g_ui_reptiles[i]);
-        lv_obj_add_style(reptile_name, ui_styles_get_text_subtitle(), 0);
+    lv_obj_t *status_text = lv_label_create(status_indicator);
+    lv_label_set_text_static(status_text, "OK");
+    lv_obj_add_style(status_text, ui_styles_get_text_small(), 0);
+    lv_obj_center(status_text);
 
-        lv_obj_t *reptile_status = lv_label_create(text_cont);
-        lv_label_set_text(reptile_status, "État: Actif • Dernière alimentation: 2j");
-        lv_obj_add_style(reptile_status, ui_styles_get_text_small(), 0);
+    return terrarium_card;
+}
 
-        lv_obj_t *actions = lv_obj_create(reptile_card);
-        lv_obj_remove_style_all(actions);
-        lv_obj_set_flex_flow(actions, LV_FLEX_FLOW_ROW);
-        lv_obj_set_style_pad_gap(actions, 10, 0);
+/**
+ * @brief Remplace le texte d'un libellé s'il a changé (pas d'invalidation sinon)
+ */
+static void set_label_text_if_changed(lv_obj_t *label, const char *text)
+{
+    if (strcmp(lv_label_get_text(label), text) != 0) {
+        lv_label_set_text(label, text);
+    }
+}
 
-        lv_obj_t *edit_btn = lv_btn_create(actions);
-        lv_obj_add_style(edit_btn, ui_styles_get_button_secondary(), 0);
-        lv_obj_set_size(edit_btn, 60, 30);
-        lv_obj_t *edit_label = lv_label_create(edit_btn);
-        lv_label_set_text(edit_label, "Éditer");
-        lv_obj_center(edit_label);
+/**
+ * @brief Affiche nom et mesures d'un terrarium dans une carte recyclée
+ */
+static void bind_terrarium_card(lv_obj_t *terrarium_card, size_t index)
+{
+    if (index >= g_ui_terrariums_count) {
+        lv_obj_add_flag(terrarium_card, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+    const ui_terrarium_item_t *terrarium = &g_ui_terrariums[index];
+    lv_obj_t *data_row = lv_obj_get_child(terrarium_card, 1);
+    char temp_text[64], hum_text[64];
+    snprintf(temp_text, sizeof(temp_text), "Temp: %.1f°C", terrarium->temperature);
+    snprintf(hum_text, sizeof(hum_text), "Hum: %u%%", (unsigned)terrarium->humidity);
+
+    lv_label_set_text_static(lv_obj_get_child(terrarium_card, 0), terrarium->name);
+    set_label_text_if_changed(lv_obj_get_child(data_row, 0), temp_text);
+    set_label_text_if_changed(lv_obj_get_child(data_row, 1), hum_text);
+    lv_obj_clear_flag(terrarium_card, LV_OBJ_FLAG_HIDDEN);
+}
 
-        lv_obj_t *view_btn = lv_btn_create(actions);
-        lv_obj_add_style(view_btn, ui_styles_get_button_primary(), 0);
-        lv_obj_set_size(view_btn, 60, 30);
-        lv_obj_t *view_label = lv_label_create(view_btn);
-        lv_label_set_text(view_label, "Voir");
-        lv_obj_center(view_label);
+/**
+ * @brief Crée une ligne de la grille des terrariums (TERRARIUM_GRID_COLUMNS cartes)
+ */
+static lv_obj_t* create_terrarium_row(lv_obj_t *list, void *user_data)
+{
+    (void)user_data;
+    lv_obj_t *row = lv_obj_create(list);
+    if (!row) {
+        ESP_LOGE(TAG, "Erreur création ligne terrariums");
+        return NULL;
     }
+    lv_obj_remove_style_all(row);
+    lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+    lv_obj_set_style_pad_column(row, 10, 0);
+    for (int col = 0; col < TERRARIUM_GRID_COLUMNS; col++) {
+        if (!create_terrarium_card(row)) {
+            return NULL;
+        }
+    }
+    return row;
+}
 
-    ESP_LOGI(TAG, "Écran reptiles créé");
-    return screen;
+/**
+ * @brief Affiche la ligne de terrariums d'index donné (cartes en trop masquées)
+ */
+static void bind_terrarium_row(lv_obj_t *row, size_t index, void *user_data)
+{
+    (void)user_data;
+    for (int col = 0; col < TERRARIUM_GRID_COLUMNS; col++) {
+        bind_terrarium_card(lv_obj_get_child(row, col), index * TERRARIUM_GRID_COLUMNS + col);
+    }
+}
+
+/**
+ * @brief Oublie la grille des terrariums supprimée avec son écran
+ */
+static void terrarium_grid_delete_cb(lv_event_t *e)
+{
+    (void)e;
+    terrarium_grid = NULL;
+}
+
+/**
+ * @brief Mesures d'un terrarium modifiées : seule une carte matérialisée et visible est touchée
+ */
+static void ui_content_item_changed(nova_screen_t screen_type, size_t index)
+{
+    if (screen_type != SCREEN_TERRARIUMS || current_screen != SCREEN_TERRARIUMS || !terrarium_grid ||
+        lv_obj_has_flag(lv_obj_get_parent(terrarium_grid), LV_OBJ_FLAG_HIDDEN)) {
+        // Modèle seul : la carte sera reliée quand elle entrera dans la fenêtre
+        return;
+    }
+    // Ligne de marge hors de la vue : reliée au prochain défilement
+    lv_obj_t *row = ui_virtual_list_row_changed(terrarium_grid, index / TERRARIUM_GRID_COLUMNS);
+    if (row) {
+        bind_terrarium_card(lv_obj_get_child(row, (int32_t)(index % TERRARIUM_GRID_COLUMNS)), index);
+    }
 }
 
 /**
@@ -259,74 +476,53 @@ static lv_obj_t* create_terrariums_screen(lv_obj_t *parent)
     lv_label_set_text(title, "Gestion des Terrariums");
     lv_obj_add_style(title, ui_styles_get_text_title(), 0);
 
-    // Conteneur grille 2x3
-    lv_obj_t *grid = lv_obj_create(screen);
-    lv_obj_remove_style_all(grid);
-    lv_obj_set_size(grid, lv_pct(100), LV_SIZE_CONTENT);
-    lv_obj_set_layout(grid, LV_LAYOUT_GRID);
-    static lv_coord_t col_dsc[] = {LV_GRID_FR(1), LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
-    static lv_coord_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
-    lv_obj_set_grid_dsc_array(grid, col_dsc, row_dsc);
-    lv_obj_set_style_pad_column(grid, 10, 0);
-    lv_obj_set_style_pad_row(grid, 10, 0);
-
-    for (int i = 0; i < 6; i++) {
-        lv_obj_t *terrarium_card = lv_obj_create(grid);
-        if (!terrarium_card) {
-            ESP_LOGE(TAG, "Erreur création carte terrarium %d", i);
-            return NULL;
-        }
-        lv_obj_remove_style_all(terrarium_card);
-        lv_obj_add_style(terrarium_card, ui_styles_get_card_style(), 0);
-        lv_obj_set_size(terrarium_card, LV_PCT(100), 110);
-        lv_obj_set_grid_cell(terrarium_card, LV_GRID_ALIGN_STRETCH, i % 2, 1,
-                              LV_GRID_ALIGN_START, i / 2, 1);
-        lv_obj_set_flex_flow(terrarium_card, LV_FLEX_FLOW_COLUMN);
-        lv_obj_set_style_pad_all(terrarium_card, 12, 0);
-        lv_obj_set_style_pad_gap(terrarium_card, 8, 0);
-
-        char title_text[32];
-        snprintf(title_text, sizeof(title_text), "Terrarium #%d", i + 1);
-        lv_obj_t *ter_title = lv_label_create(terrarium_card);
-        lv_label_set_text(ter_title, title_text);
-        lv_obj_add_style(ter_title, ui_styles_get_text_subtitle(), 0);
-
-        // Données simulées
-        char temp_text[64], hum_text[64];
-        snprintf(temp_text, sizeof(temp_text), "Temp: %.1f°C", 24.0 + (i * 0.5));
-        snprintf(hum_text, sizeof(hum_text), "Hum: %d%%", 60 + (i * 2));
-
-        lv_obj_t *data_row = lv_obj_create(terrarium_card);
-        lv_obj_remove_style_all(data_row);
-        lv_obj_set_flex_flow(data_row, LV_FLEX_FLOW_ROW);
-        lv_obj_set_style_pad_gap(data_row, 10, 0);
-
-        lv_obj_t *temp_label = lv_label_create(data_row);
-        lv_label_set_text(temp_label, temp_text);
-        lv_obj_add_style(temp_label, ui_styles_get_text_body(), 0);
-
-        lv_obj_t *hum_label = lv_label_create(data_row);
-        lv_label_set_text(hum_label, hum_text);
-        lv_obj_add_style(hum_label, ui_styles_get_text_body(), 0);
-
-        lv_obj_t *status_indicator = lv_obj_create(data_row);
-        if (!status_indicator) {
-            ESP_LOGE(TAG, "Erreur création indicateur terrarium %d", i);
-            return NULL;
-        }
-        lv_obj_set_size(status_indicator, 60, 25);
-        lv_obj_add_style(status_indicator, ui_styles_get_status_ok(), 0);
-
-        lv_obj_t *status_text = lv_label_create(status_indicator);
-        lv_label_set_text(status_text, "OK");
-        lv_obj_add_style(status_text, ui_styles_get_text_small(), 0);
-        lv_obj_center(status_text);
+    // Grille à deux colonnes : seules les lignes visibles existent, y compris en défilement inertiel
+    const ui_virtual_list_config_t grid_config = {
+        .row_height = TERRARIUM_CARD_HEIGHT,
+        .row_gap = 10,
+        .overscan = TERRARIUM_GRID_OVERSCAN,
+        .snap_rows = true,
+        .count = (g_ui_terrariums_count + TERRARIUM_GRID_COLUMNS - 1) / TERRARIUM_GRID_COLUMNS,
+        .create_row = create_terrarium_row,
+        .bind_row = bind_terrarium_row,
+    };
+    lv_obj_t *grid = ui_virtual_list_create(screen, &grid_config);
+    if (!grid) {
+        ESP_LOGE(TAG, "Erreur création grille terrariums");
+        return NULL;
     }
+    lv_obj_set_flex_grow(grid, 1);
+    lv_obj_add_event_cb(grid, terrarium_grid_delete_cb, LV_EVENT_DELETE, NULL);
+    terrarium_grid = grid;
 
     ESP_LOGI(TAG, "Écran terrariums créé");
     return screen;
 }
 
+#if LV_USE_CHART
+/**
+ * @brief Oublie le graphique supprimé avec son écran
+ */
+static void stats_chart_delete_cb(lv_event_t *e)
+{
+    (void)e;
+    stats_chart = NULL;
+    stats_chart_view = NULL;
+}
+#endif
+
+/**
+ * @brief Graphique des statistiques affiché, NULL sinon
+ */
+static lv_obj_t *stats_chart_visible(void)
+{
+    if (current_screen != SCREEN_STATISTICS || !stats_chart ||
+        lv_obj_has_flag(lv_obj_get_parent(lv_obj_get_parent(stats_chart_view)), LV_OBJ_FLAG_HIDDEN)) {
+        return NULL;
+    }
+    return stats_chart;
+}
+
 /**
  * @brief Crée l'écran des statistiques
  * @param parent Conteneur parent
@@ -349,7 +545,7 @@ static lv_obj_t* create_statistics_screen(lv_obj_t *parent)
     lv_label_set_text(title, "Statistiques et Graphiques");
     lv_obj_add_style(title, ui_styles_get_text_title(), 0);
 
-    // Placeholder pour un graphique (nécessiterait l'activation de LV_USE_CHART)
+    // Graphique (texte de remplacement sans LV_USE_CHART)
     lv_obj_t *chart_placeholder = lv_obj_create(screen);
     if (!chart_placeholder) {
         ESP_LOGE(TAG, "Erreur création placeholder graphique");
@@ -366,9 +562,45 @@ static lv_obj_t* create_statistics_screen(lv_obj_t *parent)
     lv_label_set_text(chart_title, "Évolution Température (24h)");
     lv_obj_add_style(chart_title, ui_styles_get_text_subtitle(), 0);
 
+#if LV_USE_CHART
+    // Vue défilante : le pincement élargit le graphique, deux doigts le font défiler
+    lv_obj_t *view = lv_obj_create(chart_placeholder);
+    if (!view) {
+        ESP_LOGE(TAG, "Erreur création vue graphique");
+        return NULL;
+    }
+    lv_obj_remove_style_all(view);
+    lv_obj_set_width(view, lv_pct(100));
+    lv_obj_set_flex_grow(view, 1);
+    lv_obj_set_scroll_dir(view, LV_DIR_HOR);
+    lv_obj_set_scrollbar_mode(view, LV_SCROLLBAR_MODE_ACTIVE);
+
+    lv_obj_t *chart = lv_chart_create(view);
+    if (!chart) {
+        ESP_LOGE(TAG, "Erreur création graphique");
+        return NULL;
+    }
+    lv_obj_set_size(chart, lv_pct(100), lv_pct(100));
+    lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+    lv_chart_set_point_count(chart, STATS_CHART_POINTS);
+    lv_chart_set_axis_range(chart, LV_CHART_AXIS_PRIMARY_Y, 200, 300);
+    lv_chart_set_div_line_count(chart, 5, 6);
+    lv_obj_clear_flag(chart, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_CHAIN);
+    lv_chart_series_t *series = lv_chart_add_series(chart, COLOR_ACCENT_BLUE, LV_CHART_AXIS_PRIMARY_Y);
+    for (uint32_t i = 0; series && i < STATS_CHART_POINTS; i++) {
+        lv_chart_set_value_by_id(chart, series, i, stats_temperature_24h[i]);
+    }
+    lv_obj_add_event_cb(chart, stats_chart_delete_cb, LV_EVENT_DELETE, NULL);
+    stats_chart = chart;
+    stats_chart_view = view;
+    stats_chart_zoom = STATS_CHART_ZOOM_MIN;
+    stats_chart_zoom_shown = STATS_CHART_ZOOM_MIN;
+    stats_chart_pan_origin = -1;
+#else
     lv_obj_t *chart_info = lv_label_create(chart_placeholder);
     lv_label_set_text(chart_info, "Graphique des températures moyennes\npar terrarium sur les dernières 24h");
     lv_obj_add_style(chart_info, ui_styles_get_text_body(), 0);
+#endif
 
     // Statistiques résumées
     lv_obj_t *cards = lv_obj_create(screen);
@@ -559,60 +791,204 @@ esp_err_t ui_content_init(lv_obj_t *parent)
     
     content_container = parent;
     current_screen_container = NULL;
+    prebuilt_screen = NULL;
+    terrarium_grid = NULL;
+    stats_chart = NULL;
+    stats_chart_view = NULL;
+    // Les écrans conservés ont disparu avec le conteneur précédent
+    ui_screen_cache_init(&screen_cache, UI_CONTENT_CACHE_BUDGET);
+    ui_data_set_changed_cb(ui_content_invalidate_screen);
+    ui_data_set_item_changed_cb(ui_content_item_changed);
     
     ESP_LOGI(TAG, "Contenu principal initialisé");
     return ESP_OK;
 }
 
-esp_err_t ui_content_load_screen(nova_screen_t screen_type)
+/**
+ * @brief Tas LVGL occupé, en octets
+ */
+static size_t ui_content_heap_used(void)
 {
-    if (screen_type >= SCREEN_COUNT) {
-        ESP_LOGE(TAG, "Type d'écran invalide: %d", screen_type);
-        return ESP_ERR_INVALID_ARG;
-    }
-    
-    // Suppression de l'écran précédent
-    if (current_screen_container) {
-        lv_obj_del(current_screen_container);
-        current_screen_container = NULL;
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size > mon.free_size ? mon.total_size - mon.free_size : 0;
+}
+
+/**
+ * @brief Le tas LVGL est-il sous la marge à préserver ?
+ */
+static bool ui_content_heap_tight(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size && mon.free_size < UI_CONTENT_CACHE_MIN_FREE;
+}
+
+/**
+ * @brief Supprime les écrans conservés en trop (budget, tas LVGL, données périmées)
+ * @param keep Écran affiché, jamais supprimé (UI_SCREEN_CACHE_SLOTS : aucun)
+ */
+static void ui_content_trim_cache(uint8_t keep)
+{
+    lv_obj_t *victim;
+    while ((victim = ui_screen_cache_evict(&screen_cache, keep, ui_content_heap_tight()))) {
+        if (victim == prebuilt_screen) {
+            prebuilt_screen = NULL;
+        }
+        lv_obj_del(victim);
     }
-    
-    // Création du nouvel écran
+}
+
+/**
+ * @brief Construit l'arbre d'un écran dans le conteneur de contenu
+ * @param screen_type Écran à construire
+ * @param[out] bytes Tas LVGL consommé par la construction
+ * @return lv_obj_t* Écran créé, NULL en cas d'échec
+ */
+static lv_obj_t *ui_content_build(nova_screen_t screen_type, size_t *bytes)
+{
+    lv_obj_t *screen = NULL;
+    size_t heap_before = ui_content_heap_used();
+
     switch (screen_type) {
         case SCREEN_DASHBOARD:
-            current_screen_container = create_dashboard_screen(content_container);
+            screen = create_dashboard_screen(content_container);
             break;
         case SCREEN_REPTILES:
-            current_screen_container = create_reptiles_screen(content_container);
+            screen = create_reptiles_screen(content_container);
             break;
         case SCREEN_TERRARIUMS:
-            current_screen_container = create_terrariums_screen(content_container);
+            screen = create_terrariums_screen(content_container);
             break;
         case SCREEN_STATISTICS:
-            current_screen_container = create_statistics_screen(content_container);
+            screen = create_statistics_screen(content_container);
             break;
         case SCREEN_ALERTS:
-            current_screen_container = create_alerts_screen(content_container);
+            screen = create_alerts_screen(content_container);
             break;
         case SCREEN_SETTINGS:
-            current_screen_container = create_settings_screen(content_container);
+            screen = create_settings_screen(content_container);
             break;
         default:
             ESP_LOGE(TAG, "Écran non implémenté: %d", screen_type);
-            return ESP_ERR_NOT_SUPPORTED;
+            return NULL;
+    }
+
+    size_t heap_after = ui_content_heap_used();
+    *bytes = heap_after > heap_before ? heap_after - heap_before : 0;
+    return screen;
+}
+
+esp_err_t ui_content_load_screen(nova_screen_t screen_type)
+{
+    if (screen_type >= SCREEN_COUNT) {
+        ESP_LOGE(TAG, "Type d'écran invalide: %d", screen_type);
+        return ESP_ERR_INVALID_ARG;
     }
     
+    // Écran conservé ou préparé à l'appui : l'afficher invalide sa zone, sans reconstruction
+    lv_obj_t *cached = ui_screen_cache_get(&screen_cache, screen_type);
+    if (cached) {
+        if (current_screen_container && current_screen_container != cached) {
+            lv_obj_add_flag(current_screen_container, LV_OBJ_FLAG_HIDDEN);
+        }
+        lv_obj_clear_flag(cached, LV_OBJ_FLAG_HIDDEN);
+        if (cached == prebuilt_screen) {
+            screen_cache.stats.prebuilds_used++;
+            prebuilt_screen = NULL;
+        }
+        current_screen_container = cached;
+        current_screen = screen_type;
+        if (screen_type == SCREEN_TERRARIUMS && terrarium_grid) {
+            // Mesures reçues pendant que l'écran était masqué
+            ui_virtual_list_refresh(terrarium_grid);
+        }
+        ui_content_trim_cache(screen_type);
+        ESP_LOGI(TAG, "Écran repris du cache: %d", screen_type);
+        return ESP_OK;
+    }
+
+    // L'écran précédent reste en cache, masqué, si le budget le permet
+    if (current_screen_container) {
+        lv_obj_add_flag(current_screen_container, LV_OBJ_FLAG_HIDDEN);
+        current_screen_container = NULL;
+    }
+    lv_obj_t *stale = ui_screen_cache_remove(&screen_cache, screen_type);
+    if (stale) {
+        if (stale == prebuilt_screen) {
+            prebuilt_screen = NULL;
+        }
+        lv_obj_del(stale);
+    }
+    ui_content_trim_cache(UI_SCREEN_CACHE_SLOTS);
+    
+    // Création du nouvel écran
+    size_t bytes = 0;
+    current_screen_container = ui_content_build(screen_type, &bytes);
     if (!current_screen_container) {
         ESP_LOGE(TAG, "Erreur création écran %d", screen_type);
         return ESP_ERR_NO_MEM;
     }
     
+    ui_screen_cache_put(&screen_cache, screen_type, current_screen_container, bytes);
+    ui_content_trim_cache(screen_type);
     current_screen = screen_type;
     ESP_LOGI(TAG, "Écran chargé: %d", screen_type);
     
     return ESP_OK;
 }
 
+esp_err_t ui_content_prebuild_screen(nova_screen_t screen_type)
+{
+    if (screen_type >= SCREEN_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if ((screen_type == current_screen && current_screen_container) ||
+        ui_screen_cache_contains(&screen_cache, screen_type)) {
+        return ESP_OK;
+    }
+
+    // Une seule préparation à la fois, et jamais au détriment du tas
+    ui_content_cancel_prebuild();
+    if (ui_content_heap_tight()) {
+        ESP_LOGD(TAG, "Tas LVGL tendu, pas de préparation de l'écran %d", screen_type);
+        return ESP_ERR_NO_MEM;
+    }
+    lv_obj_t *stale = ui_screen_cache_remove(&screen_cache, screen_type);
+    if (stale) {
+        lv_obj_del(stale);
+    }
+
+    size_t bytes = 0;
+    lv_obj_t *screen = ui_content_build(screen_type, &bytes);
+    if (!screen) {
+        ESP_LOGW(TAG, "Préparation de l'écran %d impossible", screen_type);
+        return ESP_ERR_NO_MEM;
+    }
+    lv_obj_add_flag(screen, LV_OBJ_FLAG_HIDDEN);
+    // Hors budget jusqu'à son affichage : le tri suivant en tiendra compte
+    ui_screen_cache_put(&screen_cache, screen_type, screen, bytes);
+    screen_cache.stats.prebuilds++;
+    prebuilt_screen = screen;
+    ESP_LOGD(TAG, "Écran %d préparé à l'appui", screen_type);
+    return ESP_OK;
+}
+
+void ui_content_cancel_prebuild(void)
+{
+    if (!prebuilt_screen) {
+        return;
+    }
+    for (uint8_t slot = 0; slot < SCREEN_COUNT; slot++) {
+        if (screen_cache.entries[slot].obj == prebuilt_screen) {
+            lv_obj_del(ui_screen_cache_remove(&screen_cache, slot));
+            screen_cache.stats.prebuilds_discarded++;
+            break;
+        }
+    }
+    prebuilt_screen = NULL;
+}
+
 void ui_content_update_realtime_data(void)
 {
     // Mise à jour des données temps réel selon l'écran actuel
@@ -622,7 +998,77 @@ void ui_content_update_realtime_data(void)
     }
 }
 
+void ui_content_zoom_chart(uint32_t scale_q8, int32_t center_x, bool done)
+{
+    lv_obj_t *chart = stats_chart_visible();
+    if (!chart) {
+        return;
+    }
+
+    uint32_t zoom = stats_chart_zoom * scale_q8 / 256;
+    zoom = LV_CLAMP(STATS_CHART_ZOOM_MIN, zoom, STATS_CHART_ZOOM_MAX);
+    if (done) {
+        stats_chart_zoom = zoom;
+    }
+    if (zoom == stats_chart_zoom_shown) {
+        return;
+    }
+
+    // Le point du graphique sous le centre du geste reste en place
+    lv_area_t view_area;
+    lv_obj_get_coords(stats_chart_view, &view_area);
+    int32_t anchor = LV_CLAMP(0, center_x - view_area.x1, lv_area_get_width(&view_area));
+    int32_t content_x = lv_obj_get_scroll_x(stats_chart_view) + anchor;
+    int32_t width = lv_obj_get_content_width(stats_chart_view);
+
+    lv_obj_set_width(chart, (int32_t)((int64_t)width * zoom / 256));
+    lv_obj_update_layout(stats_chart_view);
+    int32_t scroll = (int32_t)((int64_t)content_x * zoom / stats_chart_zoom_shown) - anchor;
+    lv_obj_scroll_to_x(stats_chart_view, LV_MAX(scroll, 0), LV_ANIM_OFF);
+    stats_chart_zoom_shown = zoom;
+}
+
+void ui_content_pan_chart(int32_t dx, bool done)
+{
+    if (!stats_chart_visible()) {
+        return;
+    }
+    if (stats_chart_pan_origin < 0) {
+        stats_chart_pan_origin = lv_obj_get_scroll_x(stats_chart_view);
+    }
+    // lv_obj_scroll_to_x() borne le défilement à l'étendue du graphique
+    lv_obj_scroll_to_x(stats_chart_view, LV_MAX(stats_chart_pan_origin - dx, 0), LV_ANIM_OFF);
+    if (done) {
+        stats_chart_pan_origin = -1;
+    }
+}
+
 lv_obj_t* ui_content_get_container(void)
 {
     return content_container;
 }
+
+void ui_content_invalidate_screen(nova_screen_t screen_type)
+{
+    if (screen_type >= SCREEN_COUNT) {
+        for (int s = 0; s < SCREEN_COUNT; s++) {
+            ui_screen_cache_invalidate(&screen_cache, (uint8_t)s);
+        }
+    } else {
+        ui_screen_cache_invalidate(&screen_cache, screen_type);
+    }
+
+    // L'écran affiché est reconstruit tout de suite avec les nouvelles données
+    if (current_screen_container &&
+        (screen_type >= SCREEN_COUNT || screen_type == current_screen) &&
+        ui_content_load_screen(current_screen) != ESP_OK) {
+        ESP_LOGW(TAG, "Reconstruction de l'écran affiché %d impossible", current_screen);
+    }
+}
+
+void ui_content_get_cache_stats(ui_screen_cache_stats_t *stats)
+{
+    if (stats) {
+        *stats = screen_cache.stats;
+    }
+}
@@ -10,6 +10,7 @@
 #include "lvgl.h"
 #include "esp_err.h"
 #include "ui_main.h"
+#include "ui_screen_cache.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,11 +30,62 @@ esp_err_t ui_content_init(lv_obj_t *parent);
  */
 esp_err_t ui_content_load_screen(nova_screen_t screen_type);
 
+/**
+ * @brief Construit un écran masqué en prévision de son affichage
+ *
+ * Appelée à l'appui d'un élément de menu : le clic qui suit n'a plus qu'à
+ * afficher l'écran via ui_content_load_screen(). Sans effet si l'écran est
+ * affiché ou déjà conservé à jour ; remplace une préparation en cours.
+ * @param screen_type Écran visé
+ * @return esp_err_t ESP_ERR_NO_MEM si le tas LVGL est tendu ou la construction échoue
+ */
+esp_err_t ui_content_prebuild_screen(nova_screen_t screen_type);
+
+/**
+ * @brief Abandonne l'écran préparé s'il n'a pas été affiché
+ *
+ * Appui annulé (doigt glissé hors de l'élément, relâché sans clic).
+ */
+void ui_content_cancel_prebuild(void);
+
 /**
  * @brief Met à jour les données temps réel du contenu
  */
 void ui_content_update_realtime_data(void);
 
+/**
+ * @brief Marque un écran conservé comme périmé
+ *
+ * Appelée par ui_data quand une collection change : un écran masqué est
+ * reconstruit à son prochain chargement, l'écran affiché l'est aussitôt.
+ * @param screen_type Écran concerné, SCREEN_COUNT pour tous
+ */
+void ui_content_invalidate_screen(nova_screen_t screen_type);
+
+/**
+ * @brief Compteurs du cache d'écrans (succès, constructions, évictions, tas)
+ * @param[out] stats Compteurs courants
+ */
+void ui_content_get_cache_stats(ui_screen_cache_stats_t *stats);
+
+/**
+ * @brief Zoom horizontal du graphique des statistiques (pincement)
+ *
+ * Sans effet si l'écran des statistiques n'est pas affiché. Le point sous
+ * le centre du geste reste en place ; zoom borné de ×1 à ×8.
+ * @param scale_q8 Facteur depuis le début du geste, 256 = ×1
+ * @param center_x Abscisse écran du centre du geste
+ * @param done Fin du geste : le zoom atteint devient la base du suivant
+ */
+void ui_content_zoom_chart(uint32_t scale_q8, int32_t center_x, bool done);
+
+/**
+ * @brief Défilement horizontal du graphique des statistiques (deux doigts)
+ * @param dx Déplacement depuis le début du geste
+ * @param done Fin du geste
+ */
+void ui_content_pan_chart(int32_t dx, bool done);
+
 /**
  * @brief Obtient le conteneur de contenu actuel
  * @return lv_obj_t* Pointeur vers le conteneur
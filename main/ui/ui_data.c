@@ -1,4 +1,5 @@
 #include "ui_data.h"
+#include <string.h>
 
 // Données par défaut pour les éléments de menu
 static const ui_menu_item_t default_menu_items[] = {
@@ -27,6 +28,19 @@ static const ui_alert_item_t default_alerts[] = {
     {"INFO", "Maintenance programmée demain", "Nettoyage système filtration"},
 };
 
+// Terrariums par défaut, copiés dans default_terrarium_readings pour recevoir les mesures
+static const ui_terrarium_item_t default_terrariums[] = {
+    {"Terrarium #1", 24.0f, 60},
+    {"Terrarium #2", 24.5f, 62},
+    {"Terrarium #3", 25.0f, 64},
+    {"Terrarium #4", 25.5f, 66},
+    {"Terrarium #5", 26.0f, 68},
+    {"Terrarium #6", 26.5f, 70},
+};
+
+#define DEFAULT_TERRARIUMS_COUNT (sizeof(default_terrariums)/sizeof(default_terrariums[0]))
+static ui_terrarium_item_t default_terrarium_readings[DEFAULT_TERRARIUMS_COUNT];
+
 // Sections de paramètres par défaut
 static const char *default_settings_sections[] = {
     "Réseau et Connectivité",
@@ -39,29 +53,45 @@ static const char *default_settings_sections[] = {
 ui_menu_item_t g_ui_menu_items[sizeof(default_menu_items)/sizeof(default_menu_items[0])];
 size_t g_ui_menu_items_count = sizeof(default_menu_items)/sizeof(default_menu_items[0]);
 
-const char *g_ui_reptiles[sizeof(default_reptiles)/sizeof(default_reptiles[0])];
+// Collections affichées : valeurs par défaut ou tableaux fournis par l'appelant
+const char *const *g_ui_reptiles = default_reptiles;
 size_t g_ui_reptiles_count = sizeof(default_reptiles)/sizeof(default_reptiles[0]);
 
-ui_alert_item_t g_ui_alerts[sizeof(default_alerts)/sizeof(default_alerts[0])];
+const ui_alert_item_t *g_ui_alerts = default_alerts;
 size_t g_ui_alerts_count = sizeof(default_alerts)/sizeof(default_alerts[0]);
 
+ui_terrarium_item_t *g_ui_terrariums = default_terrarium_readings;
+size_t g_ui_terrariums_count = DEFAULT_TERRARIUMS_COUNT;
+
 const char *g_ui_settings_sections[sizeof(default_settings_sections)/sizeof(default_settings_sections[0])];
 size_t g_ui_settings_sections_count = sizeof(default_settings_sections)/sizeof(default_settings_sections[0]);
 
+// Abonnés aux changements de collections (cache d'écrans) et d'éléments
+static ui_data_changed_cb_t changed_cb;
+static ui_data_item_changed_cb_t item_changed_cb;
+
+static void ui_data_notify(nova_screen_t screen)
+{
+    if (changed_cb) {
+        changed_cb(screen);
+    }
+}
+
 void ui_data_load_defaults(void)
 {
+    lv_lock();
     for (size_t i = 0; i < g_ui_menu_items_count; ++i) {
         g_ui_menu_items[i] = default_menu_items[i];
     }
-    for (size_t i = 0; i < g_ui_reptiles_count; ++i) {
-        g_ui_reptiles[i] = default_reptiles[i];
-    }
-    for (size_t i = 0; i < g_ui_alerts_count; ++i) {
-        g_ui_alerts[i] = default_alerts[i];
-    }
+    ui_data_set_reptiles(default_reptiles, sizeof(default_reptiles)/sizeof(default_reptiles[0]));
+    ui_data_set_alerts(default_alerts, sizeof(default_alerts)/sizeof(default_alerts[0]));
+    memcpy(default_terrarium_readings, default_terrariums, sizeof(default_terrariums));
+    ui_data_set_terrariums(default_terrarium_readings, DEFAULT_TERRARIUMS_COUNT);
     for (size_t i = 0; i < g_ui_settings_sections_count; ++i) {
         g_ui_settings_sections[i] = default_settings_sections[i];
     }
+    ui_data_notify(SCREEN_COUNT);
+    lv_unlock();
 }
 
 void ui_data_reload(void)
@@ -71,3 +101,57 @@ void ui_data_reload(void)
     // valeurs par défaut pour simuler une mise à jour dynamique.
     ui_data_load_defaults();
 }
+
+void ui_data_set_reptiles(const char *const *names, size_t count)
+{
+    lv_lock();
+    g_ui_reptiles = names;
+    g_ui_reptiles_count = names ? count : 0;
+    ui_data_notify(SCREEN_REPTILES);
+    lv_unlock();
+}
+
+void ui_data_set_alerts(const ui_alert_item_t *alerts, size_t count)
+{
+    lv_lock();
+    g_ui_alerts = alerts;
+    g_ui_alerts_count = alerts ? count : 0;
+    ui_data_notify(SCREEN_ALERTS);
+    lv_unlock();
+}
+
+void ui_data_set_terrariums(ui_terrarium_item_t *terrariums, size_t count)
+{
+    lv_lock();
+    g_ui_terrariums = terrariums;
+    g_ui_terrariums_count = terrariums ? count : 0;
+    ui_data_notify(SCREEN_TERRARIUMS);
+    lv_unlock();
+}
+
+esp_err_t ui_data_update_terrarium(size_t index, float temperature, uint8_t humidity)
+{
+    esp_err_t ret = ESP_ERR_INVALID_ARG;
+
+    lv_lock();
+    if (index < g_ui_terrariums_count) {
+        g_ui_terrariums[index].temperature = temperature;
+        g_ui_terrariums[index].humidity = humidity;
+        if (item_changed_cb) {
+            item_changed_cb(SCREEN_TERRARIUMS, index);
+        }
+        ret = ESP_OK;
+    }
+    lv_unlock();
+    return ret;
+}
+
+void ui_data_set_changed_cb(ui_data_changed_cb_t cb)
+{
+    changed_cb = cb;
+}
+
+void ui_data_set_item_changed_cb(ui_data_item_changed_cb_t cb)
+{
+    item_changed_cb = cb;
+}
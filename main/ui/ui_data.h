@@ -4,6 +4,7 @@
 #include "lvgl.h"
 #include "ui_main.h"
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -27,21 +28,81 @@ typedef struct {
     const char *details; /**< Détails supplémentaires */
 } ui_alert_item_t;
 
+/**
+ * @brief Représentation d'un terrarium et de ses dernières mesures.
+ */
+typedef struct {
+    const char *name;     /**< Nom affiché */
+    float temperature;    /**< Température (°C) */
+    uint8_t humidity;     /**< Humidité relative (%) */
+} ui_terrarium_item_t;
+
 extern ui_menu_item_t g_ui_menu_items[];
 extern size_t g_ui_menu_items_count;
 
-extern const char *g_ui_reptiles[];
+extern const char *const *g_ui_reptiles;
 extern size_t g_ui_reptiles_count;
 
-extern ui_alert_item_t g_ui_alerts[];
+extern const ui_alert_item_t *g_ui_alerts;
 extern size_t g_ui_alerts_count;
 
+extern ui_terrarium_item_t *g_ui_terrariums;
+extern size_t g_ui_terrariums_count;
+
 extern const char *g_ui_settings_sections[];
 extern size_t g_ui_settings_sections_count;
 
 void ui_data_load_defaults(void);
 void ui_data_reload(void);
 
+/**
+ * @brief Remplace les collections affichées par celles de l'appelant.
+ *
+ * Les tableaux ne sont pas copiés et doivent rester valides tant qu'ils
+ * sont affichés, ou jusqu'au prochain ui_data_load_defaults(). Prises en
+ * compte au prochain chargement de l'écran concerné, signalé par la
+ * fonction de ui_data_set_changed_cb(). Les mesures des terrariums sont
+ * ensuite écrites dans le tableau fourni par ui_data_update_terrarium().
+ * Prennent le verrou LVGL, appelables depuis n'importe quelle tâche.
+ */
+void ui_data_set_reptiles(const char *const *names, size_t count);
+void ui_data_set_alerts(const ui_alert_item_t *alerts, size_t count);
+void ui_data_set_terrariums(ui_terrarium_item_t *terrariums, size_t count);
+
+/**
+ * @brief Enregistre les dernières mesures d'un terrarium.
+ *
+ * Met à jour le modèle, puis prévient la fonction de
+ * ui_data_set_item_changed_cb() : seule une carte affichée est rafraîchie,
+ * un terrarium hors de l'écran ne touche aucun objet LVGL. Prend le verrou
+ * LVGL, appelable depuis n'importe quelle tâche.
+ * @return ESP_ERR_INVALID_ARG si l'index est hors de la collection
+ */
+esp_err_t ui_data_update_terrarium(size_t index, float temperature, uint8_t humidity);
+
+/**
+ * @brief Fonction appelée quand une collection change.
+ * @param screen Écran qui l'affiche, SCREEN_COUNT si toutes ont changé
+ */
+typedef void (*ui_data_changed_cb_t)(nova_screen_t screen);
+
+/**
+ * @brief Enregistre la fonction prévenue des changements (NULL pour aucune).
+ */
+void ui_data_set_changed_cb(ui_data_changed_cb_t cb);
+
+/**
+ * @brief Fonction appelée quand un élément d'une collection change.
+ * @param screen Écran qui affiche la collection
+ * @param index Élément modifié
+ */
+typedef void (*ui_data_item_changed_cb_t)(nova_screen_t screen, size_t index);
+
+/**
+ * @brief Enregistre la fonction prévenue des changements d'éléments (NULL pour aucune).
+ */
+void ui_data_set_item_changed_cb(ui_data_item_changed_cb_t cb);
+
 #ifdef __cplusplus
 }
 #endif
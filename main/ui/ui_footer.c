@@ -6,6 +6,7 @@
 
 #include "ui_footer.h"
 #include "ui_styles.h"
+#include "ui_static_layer.h"
 #include "esp_log.h"
 #include "esp_random.h"
 #include <stdio.h>
@@ -147,6 +148,12 @@ esp_err_t ui_footer_init(lv_obj_t *parent)
         ESP_LOGE(TAG, "Erreur création informations système");
         return ret;
     }
+
+    // Libellés mis à jour en cours d'exécution : rendus hors du calque figé
+    ui_static_layer_set_dynamic(footer_wifi_icon, true);
+    ui_static_layer_set_dynamic(footer_notifications, true);
+    ui_static_layer_set_dynamic(footer_datetime, true);
+    ui_static_layer_set_dynamic(footer_system_info, true);
     
     ESP_LOGI(TAG, "Footer initialisé avec succès");
     return ESP_OK;
@@ -154,6 +161,7 @@ esp_err_t ui_footer_init(lv_obj_t *parent)
 
 void ui_footer_update_status(void)
 {
+    lv_lock();
     // Mise à jour des informations système
     if (footer_system_info) {
         // Simulation de données système
@@ -181,12 +189,14 @@ void ui_footer_update_status(void)
         
         lv_label_set_text(footer_system_info, sys_info);
     }
+    lv_unlock();
     
     ESP_LOGD(TAG, "Statut mis à jour");
 }
 
 void ui_footer_set_wifi_status(bool connected, int signal_strength)
 {
+    lv_lock();
     if (footer_wifi_text) {
         char wifi_status[50];
         
@@ -214,10 +224,12 @@ void ui_footer_set_wifi_status(bool connected, int signal_strength)
             lv_label_set_text(footer_wifi_icon, LV_SYMBOL_CLOSE);
         }
     }
+    lv_unlock();
 }
 
 void ui_footer_set_notification_count(int count)
 {
+    lv_lock();
     if (footer_notifications) {
         char notif_text[50];
         
@@ -231,11 +243,14 @@ void ui_footer_set_notification_count(int count)
         lv_label_set_text(footer_notifications, notif_text);
         ESP_LOGI(TAG, "Notifications: %d", count);
     }
+    lv_unlock();
 }
 
 void ui_footer_set_datetime(const char *time_str)
 {
+    lv_lock();
     if (footer_datetime && time_str) {
         lv_label_set_text(footer_datetime, time_str);
     }
+    lv_unlock();
 }
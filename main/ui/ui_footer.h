@@ -14,6 +14,8 @@
 extern "C" {
 #endif
 
+/* Mises à jour appelables depuis toute tâche : verrou LVGL pris en interne (voir ui_main.h) */
+
 /**
  * @brief Initialise la barre d'état
  * @param parent Conteneur parent pour le footer
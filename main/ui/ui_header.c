@@ -7,6 +7,7 @@
 #include "ui_header.h"
 #include "ui_styles.h"
 #include "ui_icons.h"
+#include "ui_static_layer.h"
 #include "esp_log.h"
 
 static const char *TAG = "UI_Header";
@@ -282,6 +283,12 @@ esp_err_t ui_header_init(lv_obj_t *parent)
         ESP_LOGE(TAG, "Erreur création composants header");
         return ESP_ERR_NO_MEM;
     }
+
+    // Heure, connexion et boutons (état pressé) hors du calque figé
+    ui_static_layer_set_dynamic(header_connection_indicator, true);
+    ui_static_layer_set_dynamic(header_time, true);
+    ui_static_layer_set_dynamic(header_profile_btn, true);
+    ui_static_layer_set_dynamic(header_settings_btn, true);
     
     ESP_LOGI(TAG, "Header initialisé avec succès");
     return ESP_OK;
@@ -289,28 +296,35 @@ esp_err_t ui_header_init(lv_obj_t *parent)
 
 void ui_header_set_title(const char *title)
 {
+    lv_lock();
     if (header_title && title) {
         lv_label_set_text(header_title, title);
+        ui_static_layer_invalidate(UI_STATIC_LAYER_HEADER);
         ESP_LOGI(TAG, "Titre mis à jour: %s", title);
     }
+    lv_unlock();
 }
 
 void ui_header_set_connection_status(bool connected)
 {
+    lv_lock();
     if (header_connection_indicator) {
         lv_obj_add_style(header_connection_indicator,
                          connected ? &style_connected : &style_disconnected,
                          0);
         ESP_LOGI(TAG, "État connexion: %s", connected ? "Connecté" : "Déconnecté");
     }
+    lv_unlock();
 }
 
 void ui_header_set_time(const char *time_str)
 {
+    lv_lock();
     if (header_time && time_str) {
         lv_label_set_text(header_time, time_str);
         ESP_LOGI(TAG, "Heure mise à jour: %s", time_str);
     }
+    lv_unlock();
 }
 
 void ui_header_deinit(void)
@@ -14,6 +14,8 @@
 extern "C" {
 #endif
 
+/* Les setters ui_header_set_* prennent le verrou LVGL (voir ui_main.h) */
+
 /**
  * @brief Initialise la barre de titre
  * @param parent Conteneur parent pour le header
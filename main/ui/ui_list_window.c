@@ -0,0 +1,108 @@
+/**
+ * @file ui_list_window.c
+ * @brief Fenêtre de lignes matérialisées d'une liste virtuelle
+ * @author NovaReptileElevage Team
+ */
+
+#include "ui_list_window.h"
+#include <string.h>
+
+uint16_t ui_list_window_pool_size(int32_t viewport, int32_t pitch, uint16_t overscan)
+{
+    if (pitch <= 0 || viewport <= 0) {
+        return 0;
+    }
+    uint32_t pool = (uint32_t)((viewport + pitch - 1) / pitch) + 1 + 2u * overscan;
+    return pool > UI_LIST_WINDOW_MAX_POOL ? UI_LIST_WINDOW_MAX_POOL : (uint16_t)pool;
+}
+
+void ui_list_window_init(ui_list_window_t *win, int32_t pitch, uint16_t pool, uint16_t overscan)
+{
+    memset(win, 0, sizeof(*win));
+    win->pitch = pitch > 0 ? pitch : 1;
+    win->pool = pool > UI_LIST_WINDOW_MAX_POOL ? UI_LIST_WINDOW_MAX_POOL : pool;
+    win->overscan = overscan;
+    ui_list_window_invalidate(win);
+}
+
+void ui_list_window_set_count(ui_list_window_t *win, size_t count)
+{
+    win->count = count;
+    ui_list_window_invalidate(win);
+}
+
+void ui_list_window_invalidate(ui_list_window_t *win)
+{
+    for (uint16_t slot = 0; slot < UI_LIST_WINDOW_MAX_POOL; slot++) {
+        win->bound[slot] = UI_LIST_WINDOW_NONE;
+    }
+    win->first = 0;
+    win->end = 0;
+    // Emplacements libres compris : ils doivent être masqués
+    win->dirty = true;
+}
+
+void ui_list_window_forget(ui_list_window_t *win, size_t index)
+{
+    if (!win->pool) {
+        return;
+    }
+    uint16_t slot = (uint16_t)(index % win->pool);
+    if (win->bound[slot] == index) {
+        win->bound[slot] = UI_LIST_WINDOW_NONE;
+    }
+}
+
+uint32_t ui_list_window_update(ui_list_window_t *win, int32_t scroll,
+                               ui_list_window_bind_cb_t bind, void *ctx)
+{
+    if (!win->pool) {
+        return 0;
+    }
+
+    // Première ligne visible, moins la marge ; fenêtre pleine en fin de liste
+    size_t visible = scroll > 0 ? (size_t)(scroll / win->pitch) : 0;
+    size_t first = visible > win->overscan ? visible - win->overscan : 0;
+    size_t end = first + win->pool;
+    if (end > win->count) {
+        end = win->count;
+        first = end > win->pool ? end - win->pool : 0;
+    }
+
+    uint32_t binds = 0;
+    for (uint16_t slot = 0; slot < win->pool; slot++) {
+        // Ligne de la fenêtre qui revient à cet emplacement
+        size_t index = first + (slot + win->pool - first % win->pool) % win->pool;
+        if (index >= end) {
+            index = UI_LIST_WINDOW_NONE;
+        }
+        if (win->bound[slot] == index && !win->dirty) {
+            continue;
+        }
+        win->bound[slot] = index;
+        if (bind) {
+            bind(slot, index, ctx);
+        }
+        binds++;
+    }
+    win->first = first;
+    win->end = end;
+    win->dirty = false;
+    win->binds += binds;
+    return binds;
+}
+
+bool ui_list_window_is_visible(const ui_list_window_t *win, size_t index, int32_t scroll,
+                               int32_t viewport)
+{
+    if (index >= win->count) {
+        return false;
+    }
+    int64_t top = (int64_t)index * win->pitch;
+    return top < (int64_t)scroll + viewport && top + win->pitch > scroll;
+}
+
+int32_t ui_list_window_content_height(const ui_list_window_t *win)
+{
+    return (int32_t)win->count * win->pitch;
+}
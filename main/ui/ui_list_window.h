@@ -0,0 +1,106 @@
+/**
+ * @file ui_list_window.h
+ * @brief Fenêtre de lignes matérialisées d'une liste virtuelle
+ * @author NovaReptileElevage Team
+ *
+ * Une liste de N lignes de hauteur fixe n'en matérialise qu'un petit
+ * nombre (lignes visibles plus une marge de part et d'autre). La ligne
+ * d'index i occupe toujours l'emplacement i % pool : un défilement d'une
+ * ligne ne relie qu'un emplacement. Le module ne connaît que des index ;
+ * l'appelant crée les objets et les relie aux données.
+ */
+
+#ifndef UI_LIST_WINDOW_H
+#define UI_LIST_WINDOW_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Emplacements au plus, marge comprise */
+#define UI_LIST_WINDOW_MAX_POOL 32
+
+/** Emplacement libre (liste plus courte que la fenêtre) */
+#define UI_LIST_WINDOW_NONE SIZE_MAX
+
+/**
+ * @brief Relie un emplacement à une ligne
+ * @param index Ligne à afficher, UI_LIST_WINDOW_NONE pour masquer l'emplacement
+ */
+typedef void (*ui_list_window_bind_cb_t)(uint16_t slot, size_t index, void *ctx);
+
+typedef struct {
+    int32_t pitch;       /**< Hauteur d'une ligne plus l'espacement */
+    uint16_t pool;       /**< Emplacements matérialisés */
+    uint16_t overscan;   /**< Lignes de marge au-dessus et au-dessous */
+    size_t count;        /**< Lignes de la liste */
+    size_t first;        /**< Première ligne reliée */
+    size_t end;          /**< Ligne suivant la dernière reliée */
+    size_t bound[UI_LIST_WINDOW_MAX_POOL]; /**< Ligne reliée à chaque emplacement */
+    bool dirty;          /**< Tous les emplacements à relier */
+    uint32_t binds;      /**< Liaisons effectuées depuis l'initialisation */
+} ui_list_window_t;
+
+/**
+ * @brief Emplacements nécessaires pour couvrir une hauteur visible
+ *
+ * Lignes visibles quand la première est coupée, plus la marge des deux
+ * côtés, borné à UI_LIST_WINDOW_MAX_POOL.
+ */
+uint16_t ui_list_window_pool_size(int32_t viewport, int32_t pitch, uint16_t overscan);
+
+/**
+ * @brief Fenêtre vide, tous les emplacements libres
+ */
+void ui_list_window_init(ui_list_window_t *win, int32_t pitch, uint16_t pool, uint16_t overscan);
+
+/**
+ * @brief Change le nombre de lignes ; tous les emplacements seront reliés à nouveau
+ */
+void ui_list_window_set_count(ui_list_window_t *win, size_t count);
+
+/**
+ * @brief Force la liaison de tous les emplacements à la prochaine mise à jour
+ *
+ * Pour des données modifiées sans changement du nombre de lignes.
+ */
+void ui_list_window_invalidate(ui_list_window_t *win);
+
+/**
+ * @brief Oublie la liaison d'une ligne : elle sera reliée à la prochaine mise à jour
+ *
+ * Pour une ligne de marge dont les données changent, reliée seulement
+ * quand un défilement la rapproche de la vue.
+ */
+void ui_list_window_forget(ui_list_window_t *win, size_t index);
+
+/**
+ * @brief Place la fenêtre pour un défilement et relie les emplacements changés
+ * @param scroll Défilement vertical du contenu (0 en haut)
+ * @return Nombre d'emplacements reliés
+ */
+uint32_t ui_list_window_update(ui_list_window_t *win, int32_t scroll,
+                               ui_list_window_bind_cb_t bind, void *ctx);
+
+/**
+ * @brief La ligne est-elle dans la zone affichée (marge exclue) ?
+ * @param scroll Défilement vertical du contenu (0 en haut)
+ * @param viewport Hauteur affichée de la liste
+ */
+bool ui_list_window_is_visible(const ui_list_window_t *win, size_t index, int32_t scroll,
+                               int32_t viewport);
+
+/**
+ * @brief Hauteur totale du contenu de la liste (count × pitch)
+ */
+int32_t ui_list_window_content_height(const ui_list_window_t *win);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_LIST_WINDOW_H
@@ -11,6 +11,7 @@
 #include "ui_footer.h"
 #include "ui_styles.h"
 #include "ui_data.h"
+#include "ui_static_layer.h"
 #include "esp_log.h"
 
 static const char *TAG = "UI_Main";
@@ -82,6 +83,22 @@ static esp_err_t create_main_layout(void)
     lv_obj_add_style(g_nova_ui.footer_container, ui_styles_get_footer_bg(), 0);
     lv_obj_set_grid_cell(g_nova_ui.footer_container, LV_GRID_ALIGN_STRETCH, 0, 2,
                          LV_GRID_ALIGN_STRETCH, 2, 1);
+
+#if CONFIG_NOVA_UI_STATIC_LAYER_CACHE
+    // Header, sidebar et footer servis depuis un instantané PSRAM
+    lv_obj_t *const regions[UI_STATIC_LAYER_COUNT] = {
+        [UI_STATIC_LAYER_HEADER] = g_nova_ui.header_container,
+        [UI_STATIC_LAYER_SIDEBAR] = g_nova_ui.sidebar_container,
+        [UI_STATIC_LAYER_FOOTER] = g_nova_ui.footer_container,
+    };
+    for (size_t i = 0; i < UI_STATIC_LAYER_COUNT; i++) {
+        esp_err_t ret = ui_static_layer_attach((ui_static_layer_id_t)i, regions[i]);
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "Calque figé %u indisponible (%s), rendu direct", (unsigned)i,
+                     esp_err_to_name(ret));
+        }
+    }
+#endif
     
     ESP_LOGI(TAG, "Layout principal créé avec succès");
     return ESP_OK;
@@ -180,6 +197,7 @@ esp_err_t ui_main_set_screen(nova_screen_t screen)
         return ESP_ERR_INVALID_ARG;
     }
     
+    lv_lock();
     g_current_screen = screen;
     
     // Notification à la sidebar pour mettre à jour la sélection
@@ -187,6 +205,7 @@ esp_err_t ui_main_set_screen(nova_screen_t screen)
     
     // Chargement du contenu correspondant
     esp_err_t ret = ui_content_load_screen(screen);
+    lv_unlock();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Erreur chargement écran %d", screen);
         return ret;
@@ -203,6 +222,7 @@ nova_screen_t ui_main_get_current_screen(void)
 
 void ui_main_update_realtime_data(void)
 {
+    lv_lock();
     // Mise à jour des données temps réel
     ui_footer_update_status();
 
@@ -210,10 +230,13 @@ void ui_main_update_realtime_data(void)
     if (g_current_screen == SCREEN_DASHBOARD || g_current_screen == SCREEN_STATISTICS) {
         ui_content_update_realtime_data();
     }
+    lv_unlock();
 }
 
 void ui_main_deinit(void)
 {
+    ui_static_layer_deinit();
+
     if (g_nova_ui.main_screen) {
         lv_obj_del(g_nova_ui.main_screen);
     }
@@ -223,11 +246,14 @@ void ui_main_deinit(void)
     g_nova_ui = (nova_ui_t){0};
 }
 
-esp_err_t ui_main_reload_data(void)
+/**
+ * @brief Reconstruit sidebar et contenu, verrou LVGL tenu par l'appelant
+ * @return esp_err_t Code d'erreur
+ */
+static esp_err_t rebuild_data_views(void)
 {
-    ui_data_reload();
-
     if (g_nova_ui.sidebar_container) {
+        ui_static_layer_reset(UI_STATIC_LAYER_SIDEBAR);
         lv_obj_clean(g_nova_ui.sidebar_container);
         esp_err_t ret = ui_sidebar_init(g_nova_ui.sidebar_container);
         if (ret != ESP_OK) {
@@ -246,3 +272,14 @@ esp_err_t ui_main_reload_data(void)
 
     return ESP_OK;
 }
+
+esp_err_t ui_main_reload_data(void)
+{
+    lv_lock();
+    ui_data_reload();
+    esp_err_t ret = rebuild_data_views();
+    // Thème ou données changés : les instantanés sont repris au prochain rafraîchissement
+    ui_static_layer_invalidate_all();
+    lv_unlock();
+    return ret;
+}
@@ -34,6 +34,21 @@ typedef struct {
     lv_obj_t *footer_container; // Conteneur footer
 } nova_ui_t;
 
+/*
+ * Modèle de verrouillage
+ *
+ * LVGL tourne avec LV_USE_OS = FreeRTOS : lv_timer_handler() prend le verrou
+ * global récursif de LVGL (lv_lock()) pendant tout le traitement, et les unités
+ * de dessin logicielles rendent en parallèle sur les deux cœurs sans jamais
+ * toucher aux objets. Les fonctions publiques ui_main_*, ui_header_set_*,
+ * ui_footer_set_* / ui_footer_update_status et ui_sidebar_update_indicators
+ * prennent ce verrou elles-mêmes et peuvent donc être appelées depuis
+ * n'importe quelle tâche. Pour grouper plusieurs mises à jour dans une même
+ * trame, encadrer les appels par lv_lock() / lv_unlock() (verrou récursif).
+ * Les autres fonctions ui_* et tout appel direct à l'API LVGL hors de la
+ * tâche LVGL doivent être faits verrou tenu.
+ */
+
 // Types d'écrans disponibles
 typedef enum {
     SCREEN_DASHBOARD = 0,   // Tableau de bord principal
@@ -0,0 +1,148 @@
+/**
+ * @file ui_render_bench.c
+ * @brief Benchmark de rendu plein écran par écran
+ * @author NovaReptileElevage Team
+ */
+
+#include <string.h>
+
+#include "ui_render_bench.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lvgl_private.h"
+
+static const char *TAG = "UI_Bench";
+
+static const char *const screen_names[SCREEN_COUNT] = {
+    "dashboard", "reptiles", "terrariums", "statistics", "alerts", "settings",
+};
+
+#ifndef LV_DRAW_SW_DRAW_UNIT_CNT
+#define LV_DRAW_SW_DRAW_UNIT_CNT 1
+#endif
+
+/** Unités SW retirées de la liste de LVGL pendant la passe à une unité */
+static lv_draw_unit_t *s_parked_units;
+static uint32_t s_parked_count;
+
+/**
+ * @brief Ne laisse qu'une unité de dessin SW à LVGL, ou restaure les autres
+ *
+ * Appelé entre deux rendus complets, verrou LVGL tenu : aucune tâche de
+ * dessin n'est en cours, les unités retirées attendent simplement une
+ * requête qui ne vient plus.
+ * @param single true pour garder une seule unité SW, false pour restaurer
+ */
+static void bench_set_single_draw_unit(bool single)
+{
+    lv_draw_global_info_t *info = &LV_GLOBAL_DEFAULT()->draw_info;
+
+    if (!single) {
+        while (s_parked_units) {
+            lv_draw_unit_t *u = s_parked_units;
+            s_parked_units = u->next;
+            u->next = info->unit_head;
+            info->unit_head = u;
+        }
+        info->unit_cnt += s_parked_count;
+        s_parked_count = 0;
+        return;
+    }
+
+    bool kept = false;
+    lv_draw_unit_t **link = &info->unit_head;
+    while (*link) {
+        lv_draw_unit_t *u = *link;
+        if (u->name && strcmp(u->name, "SW") == 0) {
+            if (!kept) {
+                kept = true;
+            } else {
+                *link = u->next;
+                u->next = s_parked_units;
+                s_parked_units = u;
+                s_parked_count++;
+                continue;
+            }
+        }
+        link = &u->next;
+    }
+    info->unit_cnt -= s_parked_count;
+}
+
+/**
+ * @brief Durée moyenne d'un rafraîchissement plein écran de l'écran actif
+ */
+static uint32_t bench_frame_us(lv_display_t *disp)
+{
+    uint64_t total = 0;
+    for (int i = 0; i < UI_RENDER_BENCH_ITERATIONS; ++i) {
+        lv_obj_invalidate(lv_screen_active());
+        int64_t start = esp_timer_get_time();
+        lv_refr_now(disp);
+        total += (uint64_t)(esp_timer_get_time() - start);
+    }
+    return (uint32_t)(total / UI_RENDER_BENCH_ITERATIONS);
+}
+
+uint32_t ui_render_bench_speedup_x100(uint32_t frame_one_unit_us, uint32_t frame_us)
+{
+    if (frame_us == 0) {
+        return 100;
+    }
+    return (uint32_t)((uint64_t)frame_one_unit_us * 100 / frame_us);
+}
+
+esp_err_t ui_render_bench_run(ui_render_bench_result_t results[SCREEN_COUNT])
+{
+    if (!results) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    lv_display_t *disp = lv_display_get_default();
+    if (!disp) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    lv_lock();
+    nova_screen_t previous = ui_main_get_current_screen();
+    esp_err_t ret = ESP_OK;
+
+    for (int s = 0; s < SCREEN_COUNT; ++s) {
+        ret = ui_main_set_screen((nova_screen_t)s);
+        if (ret != ESP_OK) {
+            break;
+        }
+        /* Mise en page et premier rendu hors mesure */
+        lv_refr_now(disp);
+
+        ui_render_bench_result_t *r = &results[s];
+        r->screen = (nova_screen_t)s;
+        r->frame_us = bench_frame_us(disp);
+
+        /* Mêmes rafraîchissements avec une seule unité de dessin */
+        bench_set_single_draw_unit(true);
+        r->frame_one_unit_us = bench_frame_us(disp);
+        bench_set_single_draw_unit(false);
+
+        r->speedup_x100 = ui_render_bench_speedup_x100(r->frame_one_unit_us, r->frame_us);
+    }
+
+    ui_main_set_screen(previous);
+    lv_unlock();
+    return ret;
+}
+
+void ui_render_bench_log(const ui_render_bench_result_t results[SCREEN_COUNT])
+{
+    if (!results) {
+        return;
+    }
+    ESP_LOGI(TAG, "Rendu plein écran, %d unité(s) de dessin contre 1, %d itérations",
+             LV_DRAW_SW_DRAW_UNIT_CNT, UI_RENDER_BENCH_ITERATIONS);
+    for (int s = 0; s < SCREEN_COUNT; ++s) {
+        const ui_render_bench_result_t *r = &results[s];
+        ESP_LOGI(TAG, "%-10s %6lu us  (1 unité %6lu us)  gain x%lu.%02lu",
+                 screen_names[r->screen], (unsigned long)r->frame_us,
+                 (unsigned long)r->frame_one_unit_us,
+                 (unsigned long)(r->speedup_x100 / 100), (unsigned long)(r->speedup_x100 % 100));
+    }
+}
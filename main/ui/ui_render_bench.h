@@ -0,0 +1,63 @@
+/**
+ * @file ui_render_bench.h
+ * @brief Benchmark de rendu plein écran par écran (répartition sur deux cœurs)
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef UI_RENDER_BENCH_H
+#define UI_RENDER_BENCH_H
+
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "ui_main.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Rafraîchissements mesurés par écran, après un premier rendu non compté */
+#define UI_RENDER_BENCH_ITERATIONS 10
+
+/**
+ * @brief Résultat du benchmark pour un écran
+ */
+typedef struct {
+    nova_screen_t screen;  /**< Écran mesuré */
+    uint32_t frame_us;          /**< Durée moyenne d'un rafraîchissement plein écran */
+    uint32_t frame_one_unit_us; /**< Même mesure avec une seule unité de dessin SW */
+    uint32_t speedup_x100;      /**< frame_one_unit_us / frame_us (x100) */
+} ui_render_bench_result_t;
+
+/**
+ * @brief Gain de la répartition sur plusieurs unités de dessin
+ * @param frame_one_unit_us Durée du rafraîchissement avec une seule unité
+ * @param frame_us Durée du même rafraîchissement avec toutes les unités
+ * @return uint32_t Gain x100 (100 = aucun gain)
+ */
+uint32_t ui_render_bench_speedup_x100(uint32_t frame_one_unit_us, uint32_t frame_us);
+
+/**
+ * @brief Mesure le rafraîchissement plein écran de chaque écran
+ *
+ * Parcourt SCREEN_DASHBOARD à SCREEN_SETTINGS, invalide l'écran et force le
+ * rendu avec lv_refr_now(), puis restaure l'écran courant. Chaque écran est
+ * mesuré deux fois : avec toutes les unités de dessin SW, puis avec les
+ * unités au-delà de la première retirées de la liste de LVGL.
+ * À appeler depuis la tâche LVGL ; le verrou LVGL est pris pendant la mesure.
+ * @param[out] results Un résultat par écran
+ * @return esp_err_t Code d'erreur
+ */
+esp_err_t ui_render_bench_run(ui_render_bench_result_t results[SCREEN_COUNT]);
+
+/**
+ * @brief Journalise les résultats du benchmark
+ * @param results Résultats de ui_render_bench_run()
+ */
+void ui_render_bench_log(const ui_render_bench_result_t results[SCREEN_COUNT]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_RENDER_BENCH_H
@@ -0,0 +1,107 @@
+/**
+ * @file ui_screen_cache.c
+ * @brief Cache LRU des écrans construits, sous budget mémoire
+ * @author NovaReptileElevage Team
+ */
+
+#include "ui_screen_cache.h"
+#include <string.h>
+
+void ui_screen_cache_init(ui_screen_cache_t *cache, size_t budget_bytes)
+{
+    memset(cache, 0, sizeof(*cache));
+    cache->budget_bytes = budget_bytes;
+}
+
+void *ui_screen_cache_get(ui_screen_cache_t *cache, uint8_t slot)
+{
+    if (slot >= UI_SCREEN_CACHE_SLOTS) {
+        return NULL;
+    }
+    ui_screen_cache_entry_t *entry = &cache->entries[slot];
+    if (!entry->obj || entry->stale) {
+        cache->stats.misses++;
+        return NULL;
+    }
+    entry->last_use = ++cache->clock;
+    cache->stats.hits++;
+    return entry->obj;
+}
+
+bool ui_screen_cache_contains(const ui_screen_cache_t *cache, uint8_t slot)
+{
+    return slot < UI_SCREEN_CACHE_SLOTS && cache->entries[slot].obj && !cache->entries[slot].stale;
+}
+
+void ui_screen_cache_put(ui_screen_cache_t *cache, uint8_t slot, void *obj, size_t bytes)
+{
+    if (slot >= UI_SCREEN_CACHE_SLOTS || !obj) {
+        return;
+    }
+    ui_screen_cache_entry_t *entry = &cache->entries[slot];
+    if (entry->obj) {
+        cache->stats.bytes -= entry->bytes;
+        cache->stats.screens--;
+    }
+    *entry = (ui_screen_cache_entry_t){
+        .obj = obj,
+        .bytes = bytes,
+        .last_use = ++cache->clock,
+    };
+    cache->stats.bytes += bytes;
+    cache->stats.screens++;
+}
+
+void *ui_screen_cache_remove(ui_screen_cache_t *cache, uint8_t slot)
+{
+    if (slot >= UI_SCREEN_CACHE_SLOTS || !cache->entries[slot].obj) {
+        return NULL;
+    }
+    ui_screen_cache_entry_t *entry = &cache->entries[slot];
+    void *obj = entry->obj;
+    cache->stats.bytes -= entry->bytes;
+    cache->stats.screens--;
+    *entry = (ui_screen_cache_entry_t){0};
+    return obj;
+}
+
+bool ui_screen_cache_invalidate(ui_screen_cache_t *cache, uint8_t slot)
+{
+    if (slot >= UI_SCREEN_CACHE_SLOTS || !cache->entries[slot].obj || cache->entries[slot].stale) {
+        return false;
+    }
+    cache->entries[slot].stale = true;
+    cache->stats.invalidations++;
+    return true;
+}
+
+int ui_screen_cache_pick_victim(const ui_screen_cache_t *cache, uint8_t keep, bool heap_tight)
+{
+    int victim = -1;
+    bool over_budget = cache->stats.bytes > cache->budget_bytes;
+    for (int slot = 0; slot < UI_SCREEN_CACHE_SLOTS; ++slot) {
+        const ui_screen_cache_entry_t *entry = &cache->entries[slot];
+        if (!entry->obj || slot == keep) {
+            continue;
+        }
+        /* Un écran périmé ne sera plus affiché tel quel : libéré sans condition */
+        if (entry->stale) {
+            return slot;
+        }
+        if ((over_budget || heap_tight) &&
+            (victim < 0 || entry->last_use < cache->entries[victim].last_use)) {
+            victim = slot;
+        }
+    }
+    return victim;
+}
+
+void *ui_screen_cache_evict(ui_screen_cache_t *cache, uint8_t keep, bool heap_tight)
+{
+    int victim = ui_screen_cache_pick_victim(cache, keep, heap_tight);
+    if (victim < 0) {
+        return NULL;
+    }
+    cache->stats.evictions++;
+    return ui_screen_cache_remove(cache, (uint8_t)victim);
+}
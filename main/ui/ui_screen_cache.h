@@ -0,0 +1,114 @@
+/**
+ * @file ui_screen_cache.h
+ * @brief Cache LRU des écrans construits, sous budget mémoire
+ * @author NovaReptileElevage Team
+ *
+ * Le cache ne connaît que des emplacements (un par écran) et des objets
+ * opaques : l'appelant masque, affiche et supprime les objets LVGL.
+ */
+
+#ifndef UI_SCREEN_CACHE_H
+#define UI_SCREEN_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Emplacements disponibles, au moins SCREEN_COUNT */
+#define UI_SCREEN_CACHE_SLOTS 8
+
+/**
+ * @brief Écran conservé
+ */
+typedef struct {
+    void *obj;          /**< Arbre de l'écran, NULL si emplacement vide */
+    size_t bytes;       /**< Tas LVGL consommé à la construction */
+    uint32_t last_use;  /**< Horodatage logique du dernier affichage */
+    bool stale;         /**< Données modifiées depuis la construction */
+} ui_screen_cache_entry_t;
+
+/**
+ * @brief Compteurs du cache
+ */
+typedef struct {
+    uint32_t hits;          /**< Affichages servis par un écran conservé */
+    uint32_t misses;        /**< Constructions (absent ou périmé) */
+    uint32_t evictions;     /**< Écrans supprimés pour budget ou tas LVGL */
+    uint32_t invalidations; /**< Écrans conservés marqués périmés */
+    uint32_t prebuilds;     /**< Écrans construits à l'avance (appui sur le menu) */
+    uint32_t prebuilds_used;      /**< … puis affichés */
+    uint32_t prebuilds_discarded; /**< … puis abandonnés (appui annulé) */
+    size_t bytes;           /**< Tas LVGL des écrans conservés, écran affiché compris */
+    uint8_t screens;        /**< Écrans conservés */
+} ui_screen_cache_stats_t;
+
+typedef struct {
+    ui_screen_cache_entry_t entries[UI_SCREEN_CACHE_SLOTS];
+    size_t budget_bytes;    /**< Plafond des écrans conservés, écran affiché compris */
+    uint32_t clock;
+    ui_screen_cache_stats_t stats;
+} ui_screen_cache_t;
+
+/**
+ * @brief Vide le cache (sans toucher aux objets) et fixe le budget
+ * @param budget_bytes 0 : seul l'écran affiché est conservé
+ */
+void ui_screen_cache_init(ui_screen_cache_t *cache, size_t budget_bytes);
+
+/**
+ * @brief Écran conservé et à jour pour cet emplacement
+ *
+ * Compte un succès et rafraîchit l'horodatage, ou compte un échec.
+ * @return Objet de l'écran, NULL s'il faut le construire
+ */
+void *ui_screen_cache_get(ui_screen_cache_t *cache, uint8_t slot);
+
+/**
+ * @brief Écran conservé et à jour, sans compter d'accès
+ */
+bool ui_screen_cache_contains(const ui_screen_cache_t *cache, uint8_t slot);
+
+/**
+ * @brief Enregistre un écran tout juste construit
+ */
+void ui_screen_cache_put(ui_screen_cache_t *cache, uint8_t slot, void *obj, size_t bytes);
+
+/**
+ * @brief Retire un écran du cache
+ * @return Objet à supprimer par l'appelant, NULL si l'emplacement était vide
+ */
+void *ui_screen_cache_remove(ui_screen_cache_t *cache, uint8_t slot);
+
+/**
+ * @brief Marque un écran périmé : il sera reconstruit au prochain affichage
+ * @return true si un écran conservé a été marqué
+ */
+bool ui_screen_cache_invalidate(ui_screen_cache_t *cache, uint8_t slot);
+
+/**
+ * @brief Choisit l'écran à supprimer, le cas échéant
+ *
+ * Tant que le cache dépasse son budget, ou que le tas LVGL est tendu,
+ * les écrans périmés partent d'abord, puis le moins récemment affiché.
+ * L'écran affiché n'est jamais choisi.
+ * @param keep Emplacement affiché (UI_SCREEN_CACHE_SLOTS : aucun)
+ * @param heap_tight Tas LVGL sous son seuil de marge
+ * @return Emplacement à libérer, -1 si rien à supprimer
+ */
+int ui_screen_cache_pick_victim(const ui_screen_cache_t *cache, uint8_t keep, bool heap_tight);
+
+/**
+ * @brief Retire l'écran choisi par ui_screen_cache_pick_victim() et le compte
+ * @return Objet à supprimer par l'appelant, NULL si rien à supprimer
+ */
+void *ui_screen_cache_evict(ui_screen_cache_t *cache, uint8_t keep, bool heap_tight);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_SCREEN_CACHE_H
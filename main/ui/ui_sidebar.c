@@ -7,6 +7,8 @@
 #include "ui_sidebar.h"
 #include "ui_styles.h"
 #include "ui_main.h"
+#include "ui_content.h"
+#include "ui_static_layer.h"
 #include "esp_log.h"
 #include "ui_data.h"
 
@@ -24,8 +26,24 @@ typedef struct {
 
 // Tableau des éléments de menu
 static sidebar_item_t menu_items[SCREEN_COUNT];
+_Static_assert(SCREEN_COUNT <= UI_STATIC_LAYER_MAX_DYNAMIC, "une entrée dynamique par élément de menu");
 static lv_obj_t *sidebar_container;
 
+#if CONFIG_NOVA_UI_SCREEN_PREBUILD
+static bool prebuild_enabled = true;
+#else
+static bool prebuild_enabled = false;
+#endif
+
+/**
+ * @brief Abandon différé : exécuté après un éventuel LV_EVENT_CLICKED
+ */
+static void prebuild_cancel_async(void *arg)
+{
+    (void)arg;
+    ui_content_cancel_prebuild();
+}
+
 /**
  * @brief Callback pour les clics sur les éléments de menu
  * @param e Événement LVGL
@@ -45,9 +63,20 @@ static void menu_item_event_cb(lv_event_t *e)
             }
         }
     } else if (code == LV_EVENT_PRESSED) {
-        // Effet visuel de pression
+        // Effet visuel de pression, rendu hors du calque figé
         lv_obj_add_style(obj, ui_styles_get_nav_item_hover(), 0);
-    } else if (code == LV_EVENT_RELEASED) {
+        if (prebuild_enabled) {
+            for (size_t i = 0; i < g_ui_menu_items_count; i++) {
+                if (menu_items[i].container == obj) {
+                    // Retour visuel d'abord, puis l'écran visé est construit
+                    // masqué pendant l'appui (80 à 150 ms en général)
+                    lv_refr_now(NULL);
+                    ui_content_prebuild_screen(menu_items[i].screen_type);
+                    break;
+                }
+            }
+        }
+    } else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
         // Retour à l'état normal si pas actif
         for (size_t i = 0; i < g_ui_menu_items_count; i++) {
             if (menu_items[i].container == obj && !menu_items[i].is_active) {
@@ -55,6 +84,14 @@ static void menu_item_event_cb(lv_event_t *e)
                 break;
             }
         }
+        if (prebuild_enabled) {
+            if (code == LV_EVENT_PRESS_LOST) {
+                ui_content_cancel_prebuild();
+            } else {
+                // Relâché sans clic (défilement) : l'écran préparé n'a pas été affiché
+                lv_async_call(prebuild_cancel_async, NULL);
+            }
+        }
     }
 }
 
@@ -113,6 +150,10 @@ static esp_err_t create_menu_item(lv_obj_t *parent, int index)
     
     // Ajout du callback d'événement
     lv_obj_add_event_cb(item->container, menu_item_event_cb, LV_EVENT_ALL, NULL);
+
+    // Rendue à chaque trame, indicateur compris : pression et activation
+    // ne périment pas l'instantané de la sidebar
+    ui_static_layer_set_dynamic(item->container, true);
     
     return ESP_OK;
 }
@@ -193,11 +234,21 @@ void ui_sidebar_update_indicators(void)
     // Simulation d'une alerte active
     static bool has_alerts = true;
     
+    lv_lock();
     if (has_alerts) {
         lv_obj_clear_flag(alerts_item->indicator, LV_OBJ_FLAG_HIDDEN);
     } else {
         lv_obj_add_flag(alerts_item->indicator, LV_OBJ_FLAG_HIDDEN);
     }
+    lv_unlock();
     
     ESP_LOGD(TAG, "Indicateurs mis à jour");
 }
+
+void ui_sidebar_set_prebuild(bool enable)
+{
+    prebuild_enabled = enable;
+    if (!enable) {
+        ui_content_cancel_prebuild();
+    }
+}
@@ -33,6 +33,14 @@ void ui_sidebar_set_active_item(nova_screen_t screen_type);
  */
 void ui_sidebar_update_indicators(void);
 
+/**
+ * @brief Active la construction de l'écran visé dès l'appui sur le menu
+ *
+ * Valeur initiale : CONFIG_NOVA_UI_SCREEN_PREBUILD.
+ * @param enable false : l'écran n'est construit qu'au clic
+ */
+void ui_sidebar_set_prebuild(bool enable);
+
 #ifdef __cplusplus
 }
 #endif
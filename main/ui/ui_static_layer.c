@@ -0,0 +1,323 @@
+/**
+ * @file ui_static_layer.c
+ * @brief Calques figés du header, de la sidebar et du footer
+ *
+ * Ces zones sont presque entièrement statiques, mais toute invalidation qui
+ * les touche fait redessiner ombres, coins arrondis et texte. Chaque zone est
+ * donc rendue une fois dans un tampon PSRAM (lv_snapshot) affiché ensuite
+ * comme image de fond de son conteneur : une zone invalidée n'est plus
+ * qu'une copie de pixels, plus le rendu des quelques enfants dynamiques.
+ *
+ * Les enfants figés sont masqués par opa_layered nul : lv_obj_refr() les
+ * saute sans rien dessiner, mais ils restent cliquables et gardent leur place
+ * dans le layout. Le fond du conteneur reste opaque sous l'image, ce qui
+ * permet au rendu de l'ombre de sauter tout l'intérieur de la zone.
+ */
+
+#include "ui_static_layer.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+static const char *TAG = "UI_StaticLayer";
+
+typedef struct {
+    lv_obj_t *region;
+    lv_obj_t *dynamic[UI_STATIC_LAYER_MAX_DYNAMIC];
+    size_t dynamic_count;
+    lv_draw_buf_t snapshot;
+    void *pixels;
+    size_t capacity;
+    bool cached;
+    bool stale;
+    uint32_t builds;
+    uint32_t cached_children;
+    uint32_t live_children;
+} ui_static_layer_t;
+
+static ui_static_layer_t layers[UI_STATIC_LAYER_COUNT];
+static lv_display_t *layer_display;
+
+/**
+ * @brief Enfant direct de la zone contenant obj (NULL hors zone)
+ */
+static lv_obj_t *ui_static_layer_top_child(const ui_static_layer_t *layer, lv_obj_t *obj)
+{
+    while (obj) {
+        lv_obj_t *parent = lv_obj_get_parent(obj);
+        if (parent == layer->region) {
+            return obj;
+        }
+        obj = parent;
+    }
+    return NULL;
+}
+
+static bool ui_static_layer_is_live(const ui_static_layer_t *layer, const lv_obj_t *child)
+{
+    for (size_t i = 0; i < layer->dynamic_count; ++i) {
+        if (ui_static_layer_top_child(layer, layer->dynamic[i]) == child) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void ui_static_layer_set_drawn(lv_obj_t *child, bool drawn)
+{
+    if (drawn) {
+        lv_obj_remove_local_style_prop(child, LV_STYLE_OPA_LAYERED, 0);
+    } else {
+        lv_obj_set_style_opa_layered(child, LV_OPA_TRANSP, 0);
+    }
+}
+
+/**
+ * @brief Repasse la zone en rendu direct (instantané conservé pour réutilisation)
+ */
+static void ui_static_layer_show_live(ui_static_layer_t *layer)
+{
+    lv_obj_remove_local_style_prop(layer->region, LV_STYLE_BG_IMAGE_SRC, 0);
+    uint32_t count = lv_obj_get_child_count(layer->region);
+    for (uint32_t i = 0; i < count; ++i) {
+        ui_static_layer_set_drawn(lv_obj_get_child(layer->region, i), true);
+    }
+    layer->cached = false;
+    layer->cached_children = 0;
+    layer->live_children = count;
+    lv_obj_invalidate(layer->region);
+}
+
+static void ui_static_layer_release(ui_static_layer_t *layer)
+{
+    if (layer->pixels) {
+        lv_image_cache_drop(&layer->snapshot);
+        heap_caps_free(layer->pixels);
+    }
+    layer->pixels = NULL;
+    layer->capacity = 0;
+}
+
+/**
+ * @brief Reprend l'instantané de la zone et l'affiche à la place de son rendu
+ *
+ * L'instantané couvre le conteneur et sa zone de dessin étendue (ombre) ;
+ * centré comme image de fond, il est découpé aux bornes du conteneur et
+ * l'ombre extérieure reste dessinée par le conteneur lui-même.
+ */
+static esp_err_t ui_static_layer_build(ui_static_layer_t *layer)
+{
+    lv_obj_t *region = layer->region;
+    layer->stale = false;
+
+    /* Rendu d'origine de la zone, enfants dynamiques exclus */
+    lv_obj_remove_local_style_prop(region, LV_STYLE_BG_IMAGE_SRC, 0);
+    uint32_t count = lv_obj_get_child_count(region);
+    for (uint32_t i = 0; i < count; ++i) {
+        lv_obj_t *child = lv_obj_get_child(region, i);
+        ui_static_layer_set_drawn(child, !ui_static_layer_is_live(layer, child));
+    }
+
+    lv_obj_update_layout(region);
+    int32_t ext = lv_obj_get_ext_draw_size(region);
+    int32_t w = lv_obj_get_width(region) + 2 * ext;
+    int32_t h = lv_obj_get_height(region) + 2 * ext;
+    if (w <= 0 || h <= 0) {
+        ESP_LOGW(TAG, "Zone %d vide, rendu direct", (int)(layer - layers));
+        goto live;
+    }
+    uint32_t stride = lv_draw_buf_width_to_stride((uint32_t)w, LV_COLOR_FORMAT_RGB565);
+    size_t size = (size_t)stride * (size_t)h;
+
+    if (size > layer->capacity) {
+        ui_static_layer_release(layer);
+        layer->pixels = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        if (!layer->pixels) {
+            ESP_LOGW(TAG, "Instantané de %u octets impossible en PSRAM, rendu direct",
+                     (unsigned)size);
+            goto live;
+        }
+        layer->capacity = size;
+    } else if (layer->pixels) {
+        /* Même tampon, nouveau contenu : pas d'image décodée périmée */
+        lv_image_cache_drop(&layer->snapshot);
+    }
+
+    if (lv_draw_buf_init(&layer->snapshot, (uint32_t)w, (uint32_t)h, LV_COLOR_FORMAT_RGB565,
+                         stride, layer->pixels, (uint32_t)layer->capacity) != LV_RESULT_OK ||
+        lv_snapshot_take_to_draw_buf(region, LV_COLOR_FORMAT_RGB565, &layer->snapshot) !=
+            LV_RESULT_OK) {
+        ESP_LOGW(TAG, "Instantané de la zone %d échoué, rendu direct", (int)(layer - layers));
+        goto live;
+    }
+
+    /* Désormais seuls les enfants dynamiques sont dessinés sur l'image */
+    layer->cached_children = 0;
+    layer->live_children = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        lv_obj_t *child = lv_obj_get_child(region, i);
+        bool live = ui_static_layer_is_live(layer, child);
+        ui_static_layer_set_drawn(child, live);
+        if (live) {
+            ++layer->live_children;
+        } else {
+            ++layer->cached_children;
+        }
+    }
+    lv_obj_set_style_bg_image_src(region, &layer->snapshot, 0);
+    layer->cached = true;
+    ++layer->builds;
+    lv_obj_invalidate(region);
+    ESP_LOGD(TAG, "Zone %d : %ldx%ld, %lu enfants figés, %lu dynamiques", (int)(layer - layers),
+             (long)w, (long)h, (unsigned long)layer->cached_children,
+             (unsigned long)layer->live_children);
+    return ESP_OK;
+
+live:
+    ui_static_layer_show_live(layer);
+    return ESP_FAIL;
+}
+
+/**
+ * @brief Reconstruit les calques périmés avant la mise en page et le rendu
+ */
+static void ui_static_layer_refr_start_cb(lv_event_t *e)
+{
+    (void)e;
+    for (size_t i = 0; i < UI_STATIC_LAYER_COUNT; ++i) {
+        if (layers[i].region && layers[i].stale) {
+            ui_static_layer_build(&layers[i]);
+        }
+    }
+}
+
+static void ui_static_layer_detach(ui_static_layer_t *layer)
+{
+    ui_static_layer_show_live(layer);
+    ui_static_layer_release(layer);
+    *layer = (ui_static_layer_t){0};
+}
+
+esp_err_t ui_static_layer_attach(ui_static_layer_id_t id, lv_obj_t *region)
+{
+    if (id >= UI_STATIC_LAYER_COUNT || !region) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (layers[id].region) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!layer_display) {
+        layer_display = lv_display_get_default();
+        if (!layer_display) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        lv_display_add_event_cb(layer_display, ui_static_layer_refr_start_cb,
+                                LV_EVENT_REFR_START, NULL);
+    }
+    layers[id] = (ui_static_layer_t){
+        .region = region,
+        .stale = true,
+    };
+    return ESP_OK;
+}
+
+esp_err_t ui_static_layer_set_dynamic(lv_obj_t *obj, bool dynamic)
+{
+    if (!obj) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    ui_static_layer_t *layer = NULL;
+    lv_obj_t *top = NULL;
+    for (size_t i = 0; i < UI_STATIC_LAYER_COUNT && !top; ++i) {
+        if (layers[i].region) {
+            layer = &layers[i];
+            top = ui_static_layer_top_child(layer, obj);
+        }
+    }
+    if (!top) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    size_t index = 0;
+    while (index < layer->dynamic_count && layer->dynamic[index] != obj) {
+        ++index;
+    }
+    bool known = index < layer->dynamic_count;
+    if (dynamic == known) {
+        return ESP_OK;
+    }
+
+    if (dynamic) {
+        if (layer->dynamic_count == UI_STATIC_LAYER_MAX_DYNAMIC) {
+            ESP_LOGE(TAG, "Trop d'objets dynamiques dans la zone %d, rendu direct",
+                     (int)(layer - layers));
+            ui_static_layer_detach(layer);
+            return ESP_ERR_NO_MEM;
+        }
+        layer->dynamic[layer->dynamic_count++] = obj;
+        /* Visible tout de suite, l'instantané suivra au prochain rafraîchissement */
+        ui_static_layer_set_drawn(top, true);
+    } else {
+        layer->dynamic[index] = layer->dynamic[--layer->dynamic_count];
+    }
+    layer->stale = true;
+    return ESP_OK;
+}
+
+void ui_static_layer_invalidate(ui_static_layer_id_t id)
+{
+    if (id < UI_STATIC_LAYER_COUNT && layers[id].region) {
+        layers[id].stale = true;
+    }
+}
+
+void ui_static_layer_invalidate_all(void)
+{
+    for (size_t i = 0; i < UI_STATIC_LAYER_COUNT; ++i) {
+        ui_static_layer_invalidate((ui_static_layer_id_t)i);
+    }
+}
+
+void ui_static_layer_reset(ui_static_layer_id_t id)
+{
+    if (id < UI_STATIC_LAYER_COUNT && layers[id].region) {
+        layers[id].dynamic_count = 0;
+        layers[id].stale = true;
+    }
+}
+
+esp_err_t ui_static_layer_get_stats(ui_static_layer_id_t id, ui_static_layer_stats_t *out)
+{
+    if (id >= UI_STATIC_LAYER_COUNT || !out) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t ret = ESP_OK;
+    lv_lock();
+    const ui_static_layer_t *layer = &layers[id];
+    if (!layer->region) {
+        ret = ESP_ERR_INVALID_STATE;
+    } else {
+        *out = (ui_static_layer_stats_t){
+            .cached = layer->cached,
+            .builds = layer->builds,
+            .cached_children = layer->cached_children,
+            .live_children = layer->live_children,
+            .bytes = layer->capacity,
+        };
+    }
+    lv_unlock();
+    return ret;
+}
+
+void ui_static_layer_deinit(void)
+{
+    for (size_t i = 0; i < UI_STATIC_LAYER_COUNT; ++i) {
+        if (layers[i].region) {
+            ui_static_layer_detach(&layers[i]);
+        }
+    }
+    if (layer_display) {
+        lv_display_remove_event_cb_with_user_data(layer_display, ui_static_layer_refr_start_cb,
+                                                  NULL);
+        layer_display = NULL;
+    }
+}
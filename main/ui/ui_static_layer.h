@@ -0,0 +1,106 @@
+/**
+ * @file ui_static_layer.h
+ * @brief Calques figés du header, de la sidebar et du footer
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef UI_STATIC_LAYER_H
+#define UI_STATIC_LAYER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Objets dynamiques suivis au plus par calque */
+#define UI_STATIC_LAYER_MAX_DYNAMIC 8
+
+/**
+ * @brief Zones de l'interface mises en cache
+ */
+typedef enum {
+    UI_STATIC_LAYER_HEADER = 0,
+    UI_STATIC_LAYER_SIDEBAR,
+    UI_STATIC_LAYER_FOOTER,
+    UI_STATIC_LAYER_COUNT,
+} ui_static_layer_id_t;
+
+/**
+ * @brief État observable d'un calque
+ */
+typedef struct {
+    bool cached;               /**< La zone est affichée depuis son instantané */
+    uint32_t builds;           /**< Instantanés pris depuis l'attache */
+    uint32_t cached_children;  /**< Enfants directs figés dans l'instantané */
+    uint32_t live_children;    /**< Enfants directs rendus à chaque trame */
+    size_t bytes;              /**< Taille du tampon PSRAM de l'instantané */
+} ui_static_layer_stats_t;
+
+/**
+ * @brief Met un conteneur de zone en cache
+ *
+ * Le conteneur est rendu une fois (ombre, coins arrondis et texte compris)
+ * dans un tampon RGB565 en PSRAM, puis affiché comme image de fond : ses
+ * enfants directs figés ne sont plus dessinés (ils restent cliquables) et
+ * seuls les enfants contenant un objet dynamique sont rendus à chaque trame.
+ * L'instantané est pris au début du rafraîchissement suivant.
+ * @param id Zone
+ * @param region Conteneur de la zone
+ * @return esp_err_t ESP_ERR_INVALID_STATE sans affichage LVGL ou si déjà attaché
+ */
+esp_err_t ui_static_layer_attach(ui_static_layer_id_t id, lv_obj_t *region);
+
+/**
+ * @brief Déclare un objet dont l'apparence change en cours d'exécution
+ *
+ * L'enfant direct de la zone qui contient l'objet est exclu de l'instantané
+ * et rendu normalement. Un changement de déclaration reconstruit le calque
+ * au rafraîchissement suivant.
+ * @param obj Objet situé dans une zone attachée
+ * @param dynamic true pour le rendre à chaque trame, false pour le figer
+ * @return esp_err_t ESP_ERR_NOT_FOUND hors zone attachée (calques désactivés),
+ *         ESP_ERR_NO_MEM si la table est pleine (la zone repasse en rendu direct)
+ */
+esp_err_t ui_static_layer_set_dynamic(lv_obj_t *obj, bool dynamic);
+
+/**
+ * @brief Reconstruit le calque au prochain rafraîchissement (contenu figé modifié)
+ * @param id Zone
+ */
+void ui_static_layer_invalidate(ui_static_layer_id_t id);
+
+/**
+ * @brief Reconstruit tous les calques (changement de thème ou de données)
+ */
+void ui_static_layer_invalidate_all(void);
+
+/**
+ * @brief Oublie les objets dynamiques d'une zone avant la suppression de ses enfants
+ * @param id Zone
+ */
+void ui_static_layer_reset(ui_static_layer_id_t id);
+
+/**
+ * @brief Lit l'état d'un calque (depuis n'importe quelle tâche)
+ * @param id Zone
+ * @param[out] out État courant
+ * @return esp_err_t ESP_ERR_INVALID_STATE si la zone n'est pas attachée
+ */
+esp_err_t ui_static_layer_get_stats(ui_static_layer_id_t id, ui_static_layer_stats_t *out);
+
+/**
+ * @brief Détache toutes les zones et libère les instantanés
+ */
+void ui_static_layer_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_STATIC_LAYER_H
@@ -0,0 +1,211 @@
+/**
+ * @file ui_virtual_list.c
+ * @brief Liste défilante à lignes recyclées
+ * @author NovaReptileElevage Team
+ *
+ * Les lignes sont positionnées en absolu (index × pas). Un objet
+ * transparent de la hauteur totale donne à la liste son étendue de
+ * défilement, barre de défilement comprise.
+ */
+
+#include "ui_virtual_list.h"
+#include "ui_list_window.h"
+#include "esp_log.h"
+
+static const char *TAG = "UI_VLIST";
+
+typedef struct {
+    ui_list_window_t window;
+    ui_virtual_list_config_t config;
+    lv_obj_t *extent;
+    lv_obj_t *rows[UI_LIST_WINDOW_MAX_POOL];
+} ui_virtual_list_t;
+
+static ui_virtual_list_t *ui_virtual_list_get(lv_obj_t *list)
+{
+    return list ? (ui_virtual_list_t *)lv_obj_get_user_data(list) : NULL;
+}
+
+static void ui_virtual_list_bind_slot(uint16_t slot, size_t index, void *ctx)
+{
+    ui_virtual_list_t *vlist = ctx;
+    lv_obj_t *row = vlist->rows[slot];
+
+    if (index == UI_LIST_WINDOW_NONE) {
+        lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+    lv_obj_set_y(row, (int32_t)index * vlist->window.pitch);
+    vlist->config.bind_row(row, index, vlist->config.user_data);
+    lv_obj_clear_flag(row, LV_OBJ_FLAG_HIDDEN);
+}
+
+static void ui_virtual_list_update(lv_obj_t *list, ui_virtual_list_t *vlist)
+{
+    ui_list_window_update(&vlist->window, lv_obj_get_scroll_y(list), ui_virtual_list_bind_slot, vlist);
+}
+
+static void ui_virtual_list_event_cb(lv_event_t *e)
+{
+    lv_obj_t *list = lv_event_get_current_target(e);
+    ui_virtual_list_t *vlist = ui_virtual_list_get(list);
+    if (!vlist) {
+        return;
+    }
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_SCROLL:
+            ui_virtual_list_update(list, vlist);
+            break;
+        case LV_EVENT_DELETE:
+            lv_obj_set_user_data(list, NULL);
+            lv_free(vlist);
+            break;
+        default:
+            break;
+    }
+}
+
+static void ui_virtual_list_set_extent(ui_virtual_list_t *vlist)
+{
+    int32_t height = ui_list_window_content_height(&vlist->window);
+    if (height > vlist->config.row_gap) {
+        // Pas d'espacement sous la dernière ligne
+        height -= vlist->config.row_gap;
+    }
+    lv_obj_set_height(vlist->extent, height);
+}
+
+lv_obj_t *ui_virtual_list_create(lv_obj_t *parent, const ui_virtual_list_config_t *config)
+{
+    if (!parent || !config || !config->create_row || !config->bind_row || config->row_height <= 0) {
+        ESP_LOGE(TAG, "Configuration de liste invalide");
+        return NULL;
+    }
+
+    lv_obj_t *list = lv_obj_create(parent);
+    if (!list) {
+        ESP_LOGE(TAG, "Erreur création liste");
+        return NULL;
+    }
+    lv_obj_remove_style_all(list);
+    lv_obj_set_width(list, lv_pct(100));
+    lv_obj_set_scroll_dir(list, LV_DIR_VER);
+    if (config->snap_rows) {
+        // Les lignes recyclées encadrent toujours la position visée par l'inertie
+        lv_obj_set_scroll_snap_y(list, LV_SCROLL_SNAP_START);
+    }
+
+    ui_virtual_list_t *vlist = lv_malloc(sizeof(*vlist));
+    if (!vlist) {
+        ESP_LOGE(TAG, "Erreur allocation liste");
+        lv_obj_del(list);
+        return NULL;
+    }
+    lv_memzero(vlist, sizeof(*vlist));
+    vlist->config = *config;
+    lv_obj_set_user_data(list, vlist);
+    lv_obj_add_event_cb(list, ui_virtual_list_event_cb, LV_EVENT_ALL, NULL);
+
+    // Lignes pour la hauteur de l'écran : la liste n'est jamais plus haute
+    int32_t pitch = config->row_height + config->row_gap;
+    int32_t viewport = lv_display_get_vertical_resolution(lv_obj_get_display(list));
+    uint16_t pool = ui_list_window_pool_size(viewport, pitch, config->overscan);
+    ui_list_window_init(&vlist->window, pitch, pool, config->overscan);
+    ui_list_window_set_count(&vlist->window, config->count);
+
+    vlist->extent = lv_obj_create(list);
+    if (!vlist->extent) {
+        ESP_LOGE(TAG, "Erreur création étendue de liste");
+        lv_obj_del(list);
+        return NULL;
+    }
+    lv_obj_remove_style_all(vlist->extent);
+    lv_obj_clear_flag(vlist->extent, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SNAPPABLE);
+    lv_obj_set_width(vlist->extent, 1);
+    ui_virtual_list_set_extent(vlist);
+
+    for (uint16_t slot = 0; slot < pool; slot++) {
+        lv_obj_t *row = config->create_row(list, config->user_data);
+        if (!row) {
+            ESP_LOGE(TAG, "Erreur création ligne %d", slot);
+            lv_obj_del(list);
+            return NULL;
+        }
+        lv_obj_set_size(row, lv_pct(100), config->row_height);
+        lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        vlist->rows[slot] = row;
+    }
+
+    ui_virtual_list_update(list, vlist);
+    ESP_LOGD(TAG, "Liste virtuelle: %u lignes, %d objets de ligne", (unsigned)config->count, pool);
+    return list;
+}
+
+void ui_virtual_list_set_count(lv_obj_t *list, size_t count)
+{
+    ui_virtual_list_t *vlist = ui_virtual_list_get(list);
+    if (!vlist) {
+        return;
+    }
+    vlist->config.count = count;
+    ui_list_window_set_count(&vlist->window, count);
+    ui_virtual_list_set_extent(vlist);
+    // Défilement ramené dans la nouvelle étendue avant de relier
+    lv_obj_update_layout(list);
+    int32_t overscroll = lv_obj_get_scroll_bottom(list);
+    if (overscroll < 0 && lv_obj_get_scroll_y(list) > 0) {
+        lv_obj_scroll_by(list, 0, LV_MIN(-overscroll, lv_obj_get_scroll_y(list)), LV_ANIM_OFF);
+    }
+    ui_virtual_list_update(list, vlist);
+}
+
+void ui_virtual_list_refresh(lv_obj_t *list)
+{
+    ui_virtual_list_t *vlist = ui_virtual_list_get(list);
+    if (!vlist) {
+        return;
+    }
+    ui_list_window_invalidate(&vlist->window);
+    ui_virtual_list_update(list, vlist);
+}
+
+lv_obj_t *ui_virtual_list_get_row(lv_obj_t *list, size_t index)
+{
+    ui_virtual_list_t *vlist = ui_virtual_list_get(list);
+    if (!vlist || !vlist->window.pool) {
+        return NULL;
+    }
+    uint16_t slot = (uint16_t)(index % vlist->window.pool);
+    return vlist->window.bound[slot] == index ? vlist->rows[slot] : NULL;
+}
+
+lv_obj_t *ui_virtual_list_row_changed(lv_obj_t *list, size_t index)
+{
+    ui_virtual_list_t *vlist = ui_virtual_list_get(list);
+    if (!vlist) {
+        return NULL;
+    }
+    if (!ui_list_window_is_visible(&vlist->window, index, lv_obj_get_scroll_y(list),
+                                   lv_obj_get_height(list))) {
+        ui_list_window_forget(&vlist->window, index);
+        return NULL;
+    }
+    return ui_virtual_list_get_row(list, index);
+}
+
+void ui_virtual_list_get_stats(lv_obj_t *list, ui_virtual_list_stats_t *stats)
+{
+    ui_virtual_list_t *vlist = ui_virtual_list_get(list);
+    if (!stats) {
+        return;
+    }
+    *stats = (ui_virtual_list_stats_t){0};
+    if (!vlist) {
+        return;
+    }
+    stats->rows = vlist->window.pool;
+    stats->binds = vlist->window.binds;
+    stats->first = vlist->window.first;
+    stats->end = vlist->window.end;
+}
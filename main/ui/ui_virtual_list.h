@@ -0,0 +1,96 @@
+/**
+ * @file ui_virtual_list.h
+ * @brief Liste défilante à lignes recyclées
+ * @author NovaReptileElevage Team
+ *
+ * Seules les lignes visibles et une marge de part et d'autre existent en
+ * objets LVGL ; au défilement, les lignes sorties de la fenêtre sont
+ * déplacées et reliées aux données entrantes. Mémoire et coût de rendu
+ * ne dépendent pas du nombre de lignes.
+ */
+
+#ifndef UI_VIRTUAL_LIST_H
+#define UI_VIRTUAL_LIST_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Crée l'objet d'une ligne (appelé une fois par emplacement)
+ * @param list Liste parente de la ligne
+ */
+typedef lv_obj_t *(*ui_virtual_list_create_row_cb_t)(lv_obj_t *list, void *user_data);
+
+/**
+ * @brief Affiche la ligne d'index donné dans un objet recyclé
+ */
+typedef void (*ui_virtual_list_bind_row_cb_t)(lv_obj_t *row, size_t index, void *user_data);
+
+typedef struct {
+    int32_t row_height;                       /**< Hauteur fixe d'une ligne */
+    int32_t row_gap;                          /**< Espacement entre deux lignes */
+    uint16_t overscan;                        /**< Lignes de marge de chaque côté */
+    bool snap_rows;                           /**< Défilement arrêté en haut d'une ligne */
+    size_t count;                             /**< Lignes de la liste */
+    ui_virtual_list_create_row_cb_t create_row;
+    ui_virtual_list_bind_row_cb_t bind_row;
+    void *user_data;                          /**< Transmis aux deux fonctions */
+} ui_virtual_list_config_t;
+
+typedef struct {
+    uint16_t rows;   /**< Objets de ligne matérialisés */
+    uint32_t binds;  /**< Liaisons de lignes depuis la création */
+    size_t first;    /**< Première ligne reliée */
+    size_t end;      /**< Ligne suivant la dernière reliée */
+} ui_virtual_list_stats_t;
+
+/**
+ * @brief Crée une liste virtuelle défilante
+ *
+ * Les lignes sont créées pour la hauteur de l'écran ; la liste prend la
+ * taille que lui donne son parent (flex_grow, taille fixe…).
+ * @return lv_obj_t* Liste créée, NULL en cas d'échec
+ */
+lv_obj_t *ui_virtual_list_create(lv_obj_t *parent, const ui_virtual_list_config_t *config);
+
+/**
+ * @brief Change le nombre de lignes et relie à nouveau la fenêtre
+ */
+void ui_virtual_list_set_count(lv_obj_t *list, size_t count);
+
+/**
+ * @brief Relie à nouveau les lignes affichées (données modifiées)
+ */
+void ui_virtual_list_refresh(lv_obj_t *list);
+
+/**
+ * @brief Objet qui affiche une ligne
+ * @return lv_obj_t* Ligne matérialisée, NULL si la ligne est hors de la fenêtre
+ */
+lv_obj_t *ui_virtual_list_get_row(lv_obj_t *list, size_t index);
+
+/**
+ * @brief Données d'une ligne modifiées
+ *
+ * Une ligne de marge, reliée mais hors de la vue, est oubliée : elle sera
+ * reliée au prochain défilement.
+ * @return lv_obj_t* Objet à relier si la ligne est affichée, NULL sinon
+ */
+lv_obj_t *ui_virtual_list_row_changed(lv_obj_t *list, size_t index);
+
+/**
+ * @brief Statistiques de recyclage de la liste
+ */
+void ui_virtual_list_get_stats(lv_obj_t *list, ui_virtual_list_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_VIRTUAL_LIST_H
@@ -0,0 +1,259 @@
+/*
+ * Octets déplacés par trame en mode partiel et en mode direct.
+ *
+ * Le flush réel de display_driver.c est exécuté contre les stubs ; la part
+ * prise en charge par LVGL (rendu, découpage en bandes du mode partiel,
+ * synchronisation des deux framebuffers du mode direct) est modélisée ici.
+ * Le balayage RGB (W x H x 2 octets par trame) est identique dans les deux
+ * modes et n'est pas compté dans les octets par trame ; il l'est dans la
+ * charge PSRAM estimée à 60 trames/s (psram_budget).
+ */
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "display_driver.h"
+#include "st7701_rgb.h"
+#include "ui_main.h"
+#include "mock_support.h"
+
+#define MAX_AREAS 16
+#define BYTES_PER_PX ((uint64_t)sizeof(lv_color_t))
+
+typedef struct {
+    lv_area_t areas[MAX_AREAS];
+    size_t count;
+} frame_t;
+
+typedef struct {
+    const char *name;
+    frame_t frame;
+    int repeat;
+} scenario_t;
+
+typedef struct {
+    uint64_t rendered;
+    uint64_t copied;
+    uint64_t synced;
+    uint64_t flush_calls;
+    uint64_t frames;
+} traffic_t;
+
+static lv_color_t draw_buf1[DISPLAY_BUF_SIZE];
+static lv_color_t draw_buf2[DISPLAY_BUF_SIZE];
+
+static uint64_t area_px(const lv_area_t *a)
+{
+    return (uint64_t)(a->x2 - a->x1 + 1) * (uint64_t)(a->y2 - a->y1 + 1);
+}
+
+/* Pixels de @p a non couverts par les zones de @p cover (balayage par ligne) */
+static uint64_t area_px_not_covered(const lv_area_t *a, const frame_t *cover)
+{
+    uint64_t total = 0;
+    for (int32_t y = a->y1; y <= a->y2; ++y) {
+        int32_t covered = 0;
+        int32_t cursor = a->x1;
+        while (cursor <= a->x2) {
+            int32_t next = cursor;
+            for (size_t i = 0; i < cover->count; ++i) {
+                const lv_area_t *c = &cover->areas[i];
+                if (y >= c->y1 && y <= c->y2 && cursor >= c->x1 && cursor <= c->x2 && c->x2 + 1 > next) {
+                    next = c->x2 + 1;
+                }
+            }
+            if (next == cursor) {
+                ++cursor;
+            } else {
+                int32_t end = next > a->x2 + 1 ? a->x2 + 1 : next;
+                covered += end - cursor;
+                cursor = end;
+            }
+        }
+        total += (uint64_t)(a->x2 - a->x1 + 1 - covered);
+    }
+    return total;
+}
+
+static void run_partial(const scenario_t *sc, traffic_t *t)
+{
+    const int32_t buf_px = (int32_t)(test_lvgl_buffer_size() / sizeof(lv_color_t));
+    uint8_t *bufs[2] = {test_lvgl_buffer(0), test_lvgl_buffer(1)};
+    int active = 0;
+
+    for (int r = 0; r < sc->repeat; ++r) {
+        size_t before = test_panel_bytes_copied();
+        for (size_t i = 0; i < sc->frame.count; ++i) {
+            const lv_area_t *a = &sc->frame.areas[i];
+            int32_t w = a->x2 - a->x1 + 1;
+            int32_t rows = buf_px / w;
+            /* LVGL découpe les zones plus grandes que le tampon en bandes */
+            for (int32_t y = a->y1; y <= a->y2; y += rows) {
+                lv_area_t chunk = {a->x1, y, a->x2, y + rows - 1 > a->y2 ? a->y2 : y + rows - 1};
+                t->rendered += area_px(&chunk) * BYTES_PER_PX;
+                test_lvgl_set_flush_is_last(i + 1 == sc->frame.count && chunk.y2 == a->y2);
+                test_lvgl_flush(&chunk, bufs[active]);
+                active ^= 1;
+                ++t->flush_calls;
+            }
+        }
+        test_lvgl_wait_flushing();
+        /* Lecture du tampon de rendu + écriture dans le framebuffer */
+        t->copied += 2 * (uint64_t)(test_panel_bytes_copied() - before);
+        ++t->frames;
+    }
+}
+
+static void run_direct(const scenario_t *sc, traffic_t *t, frame_t *previous)
+{
+    uint8_t *fbs[2] = {test_lvgl_buffer(0), test_lvgl_buffer(1)};
+    static int back = 1;
+
+    for (int r = 0; r < sc->repeat; ++r) {
+        /* Synchronisation LVGL : zones de la trame précédente non redessinées */
+        for (size_t i = 0; i < previous->count; ++i) {
+            t->synced += 2 * area_px_not_covered(&previous->areas[i], &sc->frame) * BYTES_PER_PX;
+        }
+        size_t before = test_panel_bytes_copied();
+        for (size_t i = 0; i < sc->frame.count; ++i) {
+            t->rendered += area_px(&sc->frame.areas[i]) * BYTES_PER_PX;
+            test_lvgl_set_flush_is_last(i + 1 == sc->frame.count);
+            test_lvgl_flush(&sc->frame.areas[i], fbs[back]);
+            ++t->flush_calls;
+        }
+        test_lvgl_wait_flushing();
+        t->copied += 2 * (uint64_t)(test_panel_bytes_copied() - before);
+        back ^= 1;
+        *previous = sc->frame;
+        ++t->frames;
+    }
+}
+
+static void add_area(frame_t *f, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    assert(f->count < MAX_AREAS);
+    f->areas[f->count++] = (lv_area_t){x1, y1, x2, y2};
+}
+
+static size_t build_scenarios(scenario_t *out)
+{
+    size_t n = 0;
+    const int32_t content_x = SIDEBAR_WIDTH;
+    const int32_t content_y = HEADER_HEIGHT;
+    const int32_t footer_y = SCREEN_HEIGHT - FOOTER_HEIGHT;
+
+    /* Horloge du header + date/heure et infos système du footer (1 Hz) */
+    memset(&out[n], 0, sizeof(out[n]));
+    out[n].name = "clock+status";
+    out[n].repeat = 60;
+    add_area(&out[n].frame, 874, 28, 929, 51);
+    add_area(&out[n].frame, 520, footer_y + 20, 707, footer_y + 35);
+    add_area(&out[n].frame, 727, footer_y + 20, 1013, footer_y + 35);
+    ++n;
+
+    /* Valeurs des 8 cartes du tableau de bord (5 par ligne, 140x80) */
+    memset(&out[n], 0, sizeof(out[n]));
+    out[n].name = "dashboard cards";
+    out[n].repeat = 30;
+    for (int i = 0; i < 8; ++i) {
+        int32_t x = content_x + 16 + (i % 5) * 150 + 12;
+        int32_t y = content_y + 16 + 40 + (i / 5) * 90 + 38;
+        add_area(&out[n].frame, x, y, x + 115, y + 29);
+    }
+    ++n;
+
+    /* Défilement de la liste des reptiles : toute la zone de contenu */
+    memset(&out[n], 0, sizeof(out[n]));
+    out[n].name = "list scroll";
+    out[n].repeat = 60;
+    add_area(&out[n].frame, content_x, content_y, SCREEN_WIDTH - 1, footer_y - 1);
+    ++n;
+
+    /* Navigation : contenu + deux entrées de la sidebar */
+    memset(&out[n], 0, sizeof(out[n]));
+    out[n].name = "screen change";
+    out[n].repeat = 1;
+    add_area(&out[n].frame, content_x, content_y, SCREEN_WIDTH - 1, footer_y - 1);
+    add_area(&out[n].frame, 12, content_y + 12, SIDEBAR_WIDTH - 13, content_y + 61);
+    add_area(&out[n].frame, 12, content_y + 72, SIDEBAR_WIDTH - 13, content_y + 121);
+    ++n;
+
+    /* Rafraîchissement complet (chargement d'écran, thème) */
+    memset(&out[n], 0, sizeof(out[n]));
+    out[n].name = "full refresh";
+    out[n].repeat = 1;
+    add_area(&out[n].frame, 0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1);
+    ++n;
+
+    return n;
+}
+
+static void print_row(const char *mode, const traffic_t *t)
+{
+    uint64_t total = t->rendered + t->copied + t->synced;
+    /* Charge PSRAM si la scène est rejouée à 60 trames/s */
+    const psram_budget_input_t in = {
+        .psram_bandwidth_bps = (uint64_t)DISPLAY_PSRAM_BANDWIDTH_MBPS * 1000000ull,
+        .pclk_hz = ST7701_RGB_PCLK_HZ_DEFAULT,
+        .bits_per_pixel = sizeof(lv_color_t) * 8,
+        .render_bytes = total * 60 / t->frames,
+        .window_us = 1000000,
+    };
+    psram_budget_t budget;
+    psram_budget_compute(&in, &budget);
+    printf("  %-8s frames=%3llu flush/frame=%5.1f rendered=%9.0f copied=%9.0f synced=%9.0f total=%9.0f B/frame"
+           " psram@60fps=%5.1f%%\n",
+           mode, (unsigned long long)t->frames,
+           (double)t->flush_calls / (double)t->frames,
+           (double)t->rendered / (double)t->frames,
+           (double)t->copied / (double)t->frames,
+           (double)t->synced / (double)t->frames,
+           (double)total / (double)t->frames,
+           (double)budget.load_permille / 10.0);
+}
+
+int main(void)
+{
+    scenario_t scenarios[8];
+    size_t count = build_scenarios(scenarios);
+    frame_t previous = {0};
+
+    puts("Display bandwidth per frame (excluding RGB scan-out)");
+    for (size_t s = 0; s < count; ++s) {
+        traffic_t partial = {0};
+        traffic_t direct = {0};
+
+        test_reset_mocks();
+        void *sequence[] = {draw_buf1, draw_buf2};
+        test_heap_caps_set_sequence(sequence, 2);
+        display_driver_config_t config = DISPLAY_DRIVER_DEFAULT_CONFIG();
+        config.render_mode = DISPLAY_RENDER_MODE_PARTIAL;
+        assert(display_driver_init_with_config(&config) == ESP_OK);
+        assert(test_lvgl_render_mode() == LV_DISPLAY_RENDER_MODE_PARTIAL);
+        assert(test_panel_num_fbs() == 1);
+        run_partial(&scenarios[s], &partial);
+        display_driver_deinit();
+
+        test_reset_mocks();
+        config.render_mode = DISPLAY_RENDER_MODE_DIRECT;
+        assert(display_driver_init_with_config(&config) == ESP_OK);
+        assert(test_lvgl_render_mode() == LV_DISPLAY_RENDER_MODE_DIRECT);
+        assert(test_panel_num_fbs() == 2);
+        assert(test_panel_is_frame_buffer(test_lvgl_buffer(0)));
+        assert(test_panel_is_frame_buffer(test_lvgl_buffer(1)));
+        run_direct(&scenarios[s], &direct, &previous);
+        /* Une bascule par trame, aucun octet copié par le flush */
+        assert(test_panel_fb_swaps() == direct.frames);
+        assert(direct.copied == 0);
+        assert(test_lvgl_flush_ready_count() == direct.flush_calls);
+        display_driver_deinit();
+
+        printf("%s\n", scenarios[s].name);
+        print_row("partial", &partial);
+        print_row("direct", &direct);
+        assert(direct.rendered + direct.copied + direct.synced <=
+               partial.rendered + partial.copied + partial.synced);
+    }
+
+    puts("Display bandwidth benchmark passed");
+    return 0;
+}
@@ -0,0 +1,170 @@
+/*
+ * Modèle du pipeline rendu -> copie du mode partiel : copie CPU synchrone,
+ * copie CPU sur le cœur 0 (flush asynchrone) et copie GDMA depuis des bandes
+ * en SRAM interne, pour plusieurs hauteurs de bande.
+ *
+ * Chaque bande suit la sémantique de lv_refr.c avec deux tampons : LVGL rend
+ * la bande i, attend la fin du transfert i-1, lance le transfert i puis rend
+ * la bande i+1. Les débits ci-dessous sont des hypothèses ESP32-S3 à 240 MHz
+ * avec PSRAM octale à 80 MHz et balayage RGB actif ; ils se règlent ici pour
+ * refléter des mesures sur cible.
+ */
+#include <assert.h>
+#include <stdio.h>
+#include "display_driver.h"
+#include "ui_main.h"
+
+/* Rendu logiciel LVGL, tampon en SRAM interne / en PSRAM (ns par pixel) */
+#define RENDER_NS_PER_PX_SRAM   25.0
+#define RENDER_NS_PER_PX_PSRAM  35.0
+/* memcpy CPU vers le framebuffer PSRAM à travers le cache (octets/µs) */
+#define CPU_COPY_BYTES_PER_US   50.0
+/* GDMA AHB SRAM -> PSRAM en concurrence avec le balayage (octets/µs) */
+#define GDMA_BYTES_PER_US       80.0
+/* CPU par bande GDMA : esp_cache_msync + soumission (µs) */
+#define GDMA_SETUP_US           6.0
+/* Latence ISR de fin de transfert (µs) */
+#define GDMA_ISR_US             4.0
+/* Tampons LVGL du mode partiel CPU : 1/4 d'écran en PSRAM */
+#define PARTIAL_BUF_PX          (DISPLAY_WIDTH * DISPLAY_HEIGHT / 4)
+
+#define MAX_AREAS 4
+
+typedef struct {
+    const char *name;
+    lv_area_t areas[MAX_AREAS];
+    size_t count;
+} scenario_t;
+
+typedef enum {
+    PATH_CPU_SYNC,
+    PATH_CPU_ASYNC,
+    PATH_GDMA,
+} copy_path_t;
+
+typedef struct {
+    double frame_us;
+    double core1_us; /* rendu + copie ou préparation, tâche LVGL */
+    double core0_us; /* copie déportée (flush asynchrone) */
+    double render_px;
+    unsigned stripes;
+} result_t;
+
+typedef struct {
+    double render_end;
+    double stage_end_prev;
+    double stage_start_prev;
+    bool first;
+} pipeline_t;
+
+/* Ajoute une bande au pipeline à deux tampons */
+static void pipeline_push(pipeline_t *p, copy_path_t path, double render_us, double stage_us,
+                          double setup_us, result_t *r)
+{
+    /* LVGL rend la bande dès que le flush précédent a été lancé */
+    double render_start = p->first ? 0.0 : (path == PATH_CPU_SYNC ? p->stage_end_prev : p->stage_start_prev);
+    double render_end = render_start + render_us + setup_us;
+    /* Attente du transfert précédent avant de lancer celui-ci */
+    double stage_start = (p->first || render_end > p->stage_end_prev) ? render_end : p->stage_end_prev;
+    double stage_end = stage_start + stage_us;
+
+    p->render_end = render_end;
+    p->stage_start_prev = stage_start;
+    p->stage_end_prev = stage_end;
+    p->first = false;
+
+    r->core1_us += render_us + setup_us + (path == PATH_CPU_SYNC ? stage_us : 0.0);
+    r->core0_us += path == PATH_CPU_ASYNC ? stage_us : 0.0;
+    r->frame_us = stage_end;
+    ++r->stripes;
+}
+
+static result_t run_cpu(const scenario_t *sc, copy_path_t path)
+{
+    result_t r = {0};
+    pipeline_t p = {.first = true};
+    for (size_t i = 0; i < sc->count; ++i) {
+        const lv_area_t *a = &sc->areas[i];
+        int32_t w = a->x2 - a->x1 + 1;
+        int32_t rows = PARTIAL_BUF_PX / w;
+        for (int32_t y = a->y1; y <= a->y2; y += rows) {
+            int32_t h = y + rows - 1 > a->y2 ? a->y2 - y + 1 : rows;
+            double px = (double)w * h;
+            r.render_px += px;
+            pipeline_push(&p, path, px * RENDER_NS_PER_PX_PSRAM / 1000.0,
+                          px * sizeof(lv_color_t) / CPU_COPY_BYTES_PER_US, 0.0, &r);
+        }
+    }
+    return r;
+}
+
+static result_t run_gdma(const scenario_t *sc, int32_t stripe_lines)
+{
+    result_t r = {0};
+    pipeline_t p = {.first = true};
+    for (size_t i = 0; i < sc->count; ++i) {
+        /* Zones élargies à la pleine largeur par LV_EVENT_INVALIDATE_AREA */
+        const lv_area_t *a = &sc->areas[i];
+        for (int32_t y = a->y1; y <= a->y2; y += stripe_lines) {
+            int32_t h = y + stripe_lines - 1 > a->y2 ? a->y2 - y + 1 : stripe_lines;
+            double px = (double)DISPLAY_WIDTH * h;
+            r.render_px += px;
+            pipeline_push(&p, PATH_GDMA, px * RENDER_NS_PER_PX_SRAM / 1000.0,
+                          px * sizeof(lv_color_t) / GDMA_BYTES_PER_US + GDMA_ISR_US,
+                          GDMA_SETUP_US, &r);
+        }
+    }
+    return r;
+}
+
+static void print_row(const char *label, const result_t *r)
+{
+    printf("  %-14s stripes=%3u rendered=%7.0f px frame=%8.0f us (%5.1f fps) core1=%8.0f us core0=%8.0f us\n",
+           label, r->stripes, r->render_px, r->frame_us, 1e6 / r->frame_us, r->core1_us, r->core0_us);
+}
+
+int main(void)
+{
+    const int32_t content_x = SIDEBAR_WIDTH;
+    const int32_t content_y = HEADER_HEIGHT;
+    const int32_t footer_y = SCREEN_HEIGHT - FOOTER_HEIGHT;
+    const scenario_t scenarios[] = {
+        {"full refresh", {{0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1}}, 1},
+        {"list scroll", {{content_x, content_y, SCREEN_WIDTH - 1, footer_y - 1}}, 1},
+        {"clock+status", {{874, 28, 929, 51},
+                          {520, footer_y + 20, 707, footer_y + 35},
+                          {727, footer_y + 20, 1013, footer_y + 35}}, 3},
+    };
+    const int32_t stripe_heights[] = {10, 20, 40, 60, 100};
+
+    printf("Partial-mode copy pipeline model (render %.0f/%.0f ns/px SRAM/PSRAM, CPU copy %.0f MB/s,"
+           " GDMA %.0f MB/s)\n",
+           RENDER_NS_PER_PX_SRAM, RENDER_NS_PER_PX_PSRAM, CPU_COPY_BYTES_PER_US, GDMA_BYTES_PER_US);
+
+    for (size_t s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); ++s) {
+        const scenario_t *sc = &scenarios[s];
+        printf("%s\n", sc->name);
+        result_t sync = run_cpu(sc, PATH_CPU_SYNC);
+        result_t async = run_cpu(sc, PATH_CPU_ASYNC);
+        print_row("cpu sync", &sync);
+        print_row("cpu async", &async);
+        assert(async.frame_us <= sync.frame_us);
+
+        for (size_t h = 0; h < sizeof(stripe_heights) / sizeof(stripe_heights[0]); ++h) {
+            char label[24];
+            snprintf(label, sizeof(label), "gdma %3d lines", (int)stripe_heights[h]);
+            result_t dma = run_gdma(sc, stripe_heights[h]);
+            print_row(label, &dma);
+            /* Aucune copie CPU : le cœur 1 ne fait que rendre et préparer */
+            assert(dma.core0_us == 0.0);
+            assert(dma.core1_us < dma.frame_us + 1e-6);
+            if (sc->areas[0].x2 - sc->areas[0].x1 + 1 == DISPLAY_WIDTH) {
+                /* Zones pleine largeur : GDMA plus rapide que la copie CPU synchrone */
+                assert(dma.frame_us < sync.frame_us);
+            }
+        }
+    }
+
+    puts("GDMA pipeline model passed");
+    return 0;
+}
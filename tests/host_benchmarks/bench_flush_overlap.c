@@ -0,0 +1,106 @@
+/*
+ * Recouvrement rendu / transfert du flush partiel, synchrone ou asynchrone.
+ *
+ * La boucle de rendu reproduit lv_refr.c avec deux tampons : chaque bande est
+ * rendue (temps simulé) puis flushée, LVGL n'attendant la fin du flush
+ * précédent qu'au moment de flusher à nouveau. La copie vers le framebuffer
+ * (draw_bitmap) et le retard éventuel de on_color_trans_done sont simulés par
+ * les stubs du panneau.
+ */
+#include <assert.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include "display_driver.h"
+#include "mock_support.h"
+
+#define FRAMES 8
+
+typedef struct {
+    const char *name;
+    uint32_t render_us;
+    uint32_t copy_us;
+    uint32_t completion_delay_us;
+} scenario_t;
+
+static lv_color_t draw_buf1[DISPLAY_BUF_SIZE];
+static lv_color_t draw_buf2[DISPLAY_BUF_SIZE];
+
+static int64_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* Durée moyenne d'une trame plein écran, en µs */
+static double run(const scenario_t *sc, bool async_flush, uint32_t *bands_per_frame)
+{
+    test_reset_mocks();
+    void *sequence[] = {draw_buf1, draw_buf2};
+    test_heap_caps_set_sequence(sequence, 2);
+    display_driver_config_t config = DISPLAY_DRIVER_DEFAULT_CONFIG();
+    config.render_mode = DISPLAY_RENDER_MODE_PARTIAL;
+    config.async_flush = async_flush;
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    test_panel_set_copy_time_us(sc->copy_us);
+    test_panel_set_completion_delay_us(sc->completion_delay_us);
+
+    const int32_t rows = (int32_t)(test_lvgl_buffer_size() / sizeof(lv_color_t) / DISPLAY_WIDTH);
+    uint8_t *bufs[2] = {test_lvgl_buffer(0), test_lvgl_buffer(1)};
+    int active = 0;
+    uint32_t bands = 0;
+
+    int64_t start = now_us();
+    for (int f = 0; f < FRAMES; ++f) {
+        bands = 0;
+        for (int32_t y = 0; y < DISPLAY_HEIGHT; y += rows) {
+            lv_area_t band = {0, y, DISPLAY_WIDTH - 1, y + rows - 1 >= DISPLAY_HEIGHT ? DISPLAY_HEIGHT - 1 : y + rows - 1};
+            /* Rendu de la bande dans le tampon libre */
+            usleep(sc->render_us);
+            test_lvgl_set_flush_is_last(band.y2 == DISPLAY_HEIGHT - 1);
+            test_lvgl_flush(&band, bufs[active]);
+            active ^= 1;
+            ++bands;
+        }
+    }
+    test_lvgl_wait_flushing();
+    int64_t elapsed = now_us() - start;
+
+    assert(test_lvgl_flush_ready_count() == (size_t)FRAMES * bands);
+    assert(test_panel_draw_calls() == (size_t)FRAMES * bands);
+    display_driver_deinit();
+
+    *bands_per_frame = bands;
+    return (double)elapsed / FRAMES;
+}
+
+int main(void)
+{
+    const scenario_t scenarios[] = {
+        {"render > copy", 3000, 2000, 0},
+        {"copy > render", 2000, 3000, 0},
+        {"late completion", 3000, 2000, 1000},
+    };
+
+    puts("Render/transfer overlap (partial mode, full-screen frames)");
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); ++i) {
+        const scenario_t *sc = &scenarios[i];
+        uint32_t bands = 0;
+        double sync_us = run(sc, false, &bands);
+        double async_us = run(sc, true, &bands);
+        /* Part du transfert masquée par le rendu de la bande suivante */
+        double transfer_us = (double)bands * sc->copy_us;
+        double hidden = (sync_us - async_us) / transfer_us * 100.0;
+
+        printf("%-16s bands=%u render=%uus copy=%uus late=%uus sync=%8.0fus async=%8.0fus"
+               " speedup=%4.2fx transfer hidden=%5.1f%%\n",
+               sc->name, bands, sc->render_us, sc->copy_us, sc->completion_delay_us,
+               sync_us, async_us, sync_us / async_us, hidden);
+        /* Le recouvrement doit masquer une part significative du transfert */
+        assert(async_us < sync_us * 0.9);
+    }
+
+    puts("Flush overlap benchmark passed");
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * Débit des noyaux RGB565 (pixels/s) : référence scalaire face à la version
+ * optimisée, sur des charges tirées de l'écran des terrariums (fond de carte,
+ * icône opaque, bande copiée).
+ *
+ * Sur poste, la version optimisée utilise les boucles C de repli à la place
+ * des blocs PIE 128 bits : seul le découpage est mesuré ici ; sur cible le
+ * même code appelle rgb565_simd_esp32s3.S.
+ */
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "rgb565_simd.h"
+
+#define CARD_W       244
+#define CARD_H       110
+#define DEST_STRIDE  1024
+#define MIN_BENCH_NS 50000000LL
+
+typedef enum {
+    KERNEL_FILL,
+    KERNEL_COPY,
+} kernel_t;
+
+typedef struct {
+    const char *name;
+    kernel_t kernel;
+    int32_t w;
+    int32_t h;
+} workload_t;
+
+static uint16_t dest[DEST_STRIDE * CARD_H];
+static uint16_t src[DEST_STRIDE * CARD_H];
+
+static int64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void run_kernel(const workload_t *wl, bool reference)
+{
+    /* Décalage d'un pixel : cas courant d'une zone non alignée dans le tampon */
+    uint16_t *d = dest + 1;
+    switch (wl->kernel) {
+    case KERNEL_FILL:
+        (reference ? rgb565_fill_ref : rgb565_fill)(d, wl->w, wl->h, DEST_STRIDE, 0x2945);
+        break;
+    case KERNEL_COPY:
+        (reference ? rgb565_copy_ref : rgb565_copy)(d, DEST_STRIDE, src + 1, DEST_STRIDE, wl->w, wl->h);
+        break;
+    }
+}
+
+/* Pixels par seconde */
+static double measure(const workload_t *wl, bool reference)
+{
+    int64_t start = now_ns();
+    int64_t elapsed = 0;
+    uint64_t pixels = 0;
+    while (elapsed < MIN_BENCH_NS) {
+        for (int i = 0; i < 16; i++) {
+            run_kernel(wl, reference);
+        }
+        pixels += 16ULL * (uint64_t)wl->w * (uint64_t)wl->h;
+        elapsed = now_ns() - start;
+    }
+    return (double)pixels * 1e9 / (double)elapsed;
+}
+
+int main(void)
+{
+    for (size_t i = 0; i < sizeof(dest) / sizeof(dest[0]); i++) {
+        dest[i] = 0x2945;
+        src[i] = (uint16_t)(i * 2654435761u >> 16);
+    }
+
+    const workload_t workloads[] = {
+        {"card background", KERNEL_FILL, CARD_W, CARD_H},
+        {"icon copy", KERNEL_COPY, 64, 64},
+        {"stripe copy", KERNEL_COPY, DEST_STRIDE - 2, 20},
+    };
+
+    puts("RGB565 kernels (Mpx/s, reference vs optimized)");
+    for (size_t i = 0; i < sizeof(workloads) / sizeof(workloads[0]); i++) {
+        const workload_t *wl = &workloads[i];
+        double ref = measure(wl, true);
+        double opt = measure(wl, false);
+        printf("  %-16s %4dx%-4d ref %8.1f  opt %8.1f  x%.2f\n", wl->name, (int)wl->w, (int)wl->h,
+               ref / 1e6, opt / 1e6, opt / ref);
+        assert(ref > 0.0 && opt > 0.0);
+    }
+
+    puts("RGB565 kernel benchmark done");
+    return 0;
+}
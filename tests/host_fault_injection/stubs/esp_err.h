@@ -9,3 +9,12 @@ typedef int esp_err_t;
 #define ESP_ERR_NO_MEM      (0x101)
 #define ESP_ERR_INVALID_ARG (0x102)
 #define ESP_ERR_INVALID_STATE (0x103)
+#define ESP_ERR_NOT_FOUND   (0x105)
+#define ESP_ERR_NOT_SUPPORTED (0x106)
+#define ESP_ERR_TIMEOUT     (0x107)
+
+static inline const char *esp_err_to_name(esp_err_t err)
+{
+    (void)err;
+    return "ESP_ERR";
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+
+/* Version simulée : configuration async memcpy par dma_burst_size */
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(5, 4, 0)
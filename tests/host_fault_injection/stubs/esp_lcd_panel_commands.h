@@ -0,0 +1,7 @@
+#pragma once
+
+#define LCD_CMD_SWRESET 0x01
+#define LCD_CMD_SLPIN   0x10
+#define LCD_CMD_SLPOUT  0x11
+#define LCD_CMD_DISPOFF 0x28
+#define LCD_CMD_DISPON  0x29
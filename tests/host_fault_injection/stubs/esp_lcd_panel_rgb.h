@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_panel_ops.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    int dummy;
+} esp_lcd_rgb_panel_event_data_t;
+
+typedef bool (*esp_lcd_rgb_panel_vsync_cb_t)(esp_lcd_panel_handle_t panel,
+                                             const esp_lcd_rgb_panel_event_data_t *edata,
+                                             void *user_ctx);
+typedef bool (*esp_lcd_rgb_panel_draw_buf_complete_cb_t)(esp_lcd_panel_handle_t panel,
+                                                         const esp_lcd_rgb_panel_event_data_t *edata,
+                                                         void *user_ctx);
+esp_err_t esp_lcd_rgb_panel_set_pclk(esp_lcd_panel_handle_t panel, uint32_t freq_hz);
+
+typedef struct {
+    esp_lcd_rgb_panel_draw_buf_complete_cb_t on_color_trans_done;
+    esp_lcd_rgb_panel_vsync_cb_t on_vsync;
+} esp_lcd_rgb_panel_event_callbacks_t;
+
+esp_err_t esp_lcd_rgb_panel_get_frame_buffer(esp_lcd_panel_handle_t panel, uint32_t fb_num,
+                                             void **fb0, ...);
+esp_err_t esp_lcd_rgb_panel_register_event_callbacks(esp_lcd_panel_handle_t panel,
+                                                     const esp_lcd_rgb_panel_event_callbacks_t *callbacks,
+                                                     void *user_ctx);
+esp_err_t esp_lcd_rgb_panel_set_pclk(esp_lcd_panel_handle_t panel, uint32_t freq_hz);
+
+#ifdef __cplusplus
+}
+#endif
@@ -6,3 +6,16 @@
 #define ESP_LOGW(tag, fmt, ...) ((void)fprintf(stderr, "W (%s): " fmt "\n", tag, ##__VA_ARGS__))
 #define ESP_LOGI(tag, fmt, ...) ((void)fprintf(stdout, "I (%s): " fmt "\n", tag, ##__VA_ARGS__))
 #define ESP_LOGD(tag, fmt, ...) ((void)fprintf(stdout, "D (%s): " fmt "\n", tag, ##__VA_ARGS__))
+
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE,
+} esp_log_level_t;
+
+#define ESP_LOG_LEVEL(level, tag, fmt, ...)                                                      \
+    ((void)fprintf((level) <= ESP_LOG_WARN ? stderr : stdout, "%c (%s): " fmt "\n",              \
+                   "NEWIDV"[(level)], tag, ##__VA_ARGS__))
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Attente active : avance l'horloge simulée de esp_timer_get_time() */
+void esp_rom_delay_us(uint32_t us);
@@ -24,14 +24,66 @@ typedef struct {
     int32_t y2;
 } lv_area_t;
 
+static inline uint32_t lv_area_get_size(const lv_area_t *area)
+{
+    return (uint32_t)(area->x2 - area->x1 + 1) * (uint32_t)(area->y2 - area->y1 + 1);
+}
+
 typedef struct lv_display_t lv_display_t;
 typedef void (*lv_display_flush_cb_t)(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+typedef void (*lv_display_flush_wait_cb_t)(lv_display_t *disp);
+
+typedef enum {
+    LV_EVENT_ALL = 0,
+    LV_EVENT_INVALIDATE_AREA,
+    LV_EVENT_RENDER_START,
+    LV_EVENT_REFR_START,
+} lv_event_code_t;
+
+typedef struct lv_timer_t lv_timer_t;
+typedef void (*lv_timer_cb_t)(lv_timer_t *timer);
+
+typedef struct lv_event_t lv_event_t;
+typedef void (*lv_event_cb_t)(lv_event_t *e);
 
 typedef enum {
     LV_DISPLAY_RENDER_MODE_PARTIAL = 0,
+    LV_DISPLAY_RENDER_MODE_DIRECT,
+    LV_DISPLAY_RENDER_MODE_FULL,
 } lv_display_render_mode_t;
 
 typedef int32_t lv_coord_t;
+typedef uint8_t lv_opa_t;
+
+#define LV_OPA_TRANSP 0
+#define LV_OPA_COVER 255
+
+typedef enum {
+    LV_RESULT_INVALID = 0,
+    LV_RESULT_OK,
+} lv_result_t;
+
+typedef enum {
+    LV_COLOR_FORMAT_RGB565 = 0x12,
+} lv_color_format_t;
+
+typedef struct {
+    uint32_t cf;
+    uint32_t w;
+    uint32_t h;
+    uint32_t stride;
+} lv_image_header_t;
+
+typedef struct {
+    lv_image_header_t header;
+    uint32_t data_size;
+    uint8_t *data;
+} lv_draw_buf_t;
+
+typedef enum {
+    LV_STYLE_BG_IMAGE_SRC = 1,
+    LV_STYLE_OPA_LAYERED,
+} lv_style_prop_t;
 
 typedef struct lv_style_t {
     int dummy;
@@ -39,6 +91,11 @@ typedef struct lv_style_t {
 
 typedef struct lv_obj_t {
     struct lv_obj_t *parent;
+    int32_t w;
+    int32_t h;
+    int32_t ext_draw_size;
+    lv_opa_t opa_layered;
+    const void *bg_image_src;
 } lv_obj_t;
 
 typedef int32_t lv_style_selector_t;
@@ -57,10 +114,29 @@ typedef enum {
 lv_display_t *lv_display_create(int32_t hor_res, int32_t ver_res);
 void lv_display_delete(lv_display_t *display);
 void lv_display_set_default(lv_display_t *display);
+lv_display_t *lv_display_get_default(void);
 void lv_display_set_flush_cb(lv_display_t *display, lv_display_flush_cb_t cb);
 void lv_display_set_buffers(lv_display_t *display, void *buf1, void *buf2,
                             size_t size_in_bytes, lv_display_render_mode_t mode);
+void lv_display_set_flush_wait_cb(lv_display_t *display, lv_display_flush_wait_cb_t cb);
 void lv_display_flush_ready(lv_display_t *display);
+bool lv_display_flush_is_last(lv_display_t *display);
+void lv_display_add_event_cb(lv_display_t *display, lv_event_cb_t cb, lv_event_code_t filter,
+                             void *user_data);
+void *lv_event_get_param(lv_event_t *e);
+void lv_lock(void);
+void lv_unlock(void);
+void lv_refr_now(lv_display_t *display);
+lv_timer_t *lv_display_get_refr_timer(lv_display_t *display);
+uint32_t lv_display_get_inactive_time(const lv_display_t *display);
+uint32_t lv_anim_count_running(void);
+lv_timer_t *lv_timer_create(lv_timer_cb_t cb, uint32_t period, void *user_data);
+void lv_timer_delete(lv_timer_t *timer);
+void lv_timer_set_period(lv_timer_t *timer, uint32_t period);
+uint32_t lv_timer_get_period(const lv_timer_t *timer);
+void lv_timer_ready(lv_timer_t *timer);
+uint32_t lv_display_remove_event_cb_with_user_data(lv_display_t *display, lv_event_cb_t cb,
+                                                   void *user_data);
 
 lv_obj_t *lv_obj_create(lv_obj_t *parent);
 void lv_obj_del(lv_obj_t *obj);
@@ -73,7 +149,26 @@ void lv_obj_set_grid_cell(lv_obj_t *obj,
                           lv_grid_align_t y_align, uint8_t row, uint8_t row_span);
 void lv_scr_load(lv_obj_t *scr);
 lv_obj_t *lv_scr_act(void);
+lv_obj_t *lv_screen_active(void);
+void lv_obj_invalidate(const lv_obj_t *obj);
 void lv_obj_clean(lv_obj_t *obj);
+lv_obj_t *lv_obj_get_parent(const lv_obj_t *obj);
+lv_obj_t *lv_obj_get_child(const lv_obj_t *obj, int32_t idx);
+uint32_t lv_obj_get_child_count(const lv_obj_t *obj);
+void lv_obj_update_layout(const lv_obj_t *obj);
+int32_t lv_obj_get_width(const lv_obj_t *obj);
+int32_t lv_obj_get_height(const lv_obj_t *obj);
+int32_t lv_obj_get_ext_draw_size(const lv_obj_t *obj);
+void lv_obj_set_style_opa_layered(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector);
+void lv_obj_set_style_bg_image_src(lv_obj_t *obj, const void *value, lv_style_selector_t selector);
+bool lv_obj_remove_local_style_prop(lv_obj_t *obj, lv_style_prop_t prop,
+                                    lv_style_selector_t selector);
+uint32_t lv_draw_buf_width_to_stride(uint32_t w, lv_color_format_t color_format);
+lv_result_t lv_draw_buf_init(lv_draw_buf_t *draw_buf, uint32_t w, uint32_t h,
+                             lv_color_format_t cf, uint32_t stride, void *data, uint32_t data_size);
+lv_result_t lv_snapshot_take_to_draw_buf(lv_obj_t *obj, lv_color_format_t cf,
+                                         lv_draw_buf_t *draw_buf);
+void lv_image_cache_drop(const void *src);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LV_INV_BUF_SIZE 32
+
+/* Sous-ensemble des champs de lv_display_private.h utilisés par le driver */
+struct lv_display_t {
+    lv_area_t inv_areas[LV_INV_BUF_SIZE];
+    uint8_t inv_area_joined[LV_INV_BUF_SIZE];
+    uint32_t inv_p;
+};
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,9 +1,21 @@
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include "esp_timer.h"
+#include "esp_rom_sys.h"
 #include "esp_heap_caps.h"
 #include "esp_lcd_panel_ops.h"
+#include "esp_lcd_panel_rgb.h"
+#include "esp_async_memcpy.h"
+#include "esp_cache.h"
 #include "st7701_rgb.h"
 #include "lvgl.h"
+#include "lvgl_private.h"
 #include "esp_log.h"
 #include "mock_support.h"
 #include "ui_main.h"
@@ -14,11 +26,14 @@
 #include "ui_data.h"
 #include "ui_styles.h"
 
-#define MAX_TRACKED_PTRS 16
+#define MAX_TRACKED_PTRS 32
+#define MOCK_FRAME_PERIOD_US 1000
+#define MOCK_CACHE_LINE 64
 #define MAX_LV_OBJECTS 32
 
 typedef struct {
     bool used;
+    bool in_snapshot;
     lv_obj_t obj;
 } lv_obj_slot_t;
 
@@ -57,12 +72,19 @@ static size_t freed_ptrs_count;
 static lv_obj_slot_t lv_obj_pool[MAX_LV_OBJECTS];
 static size_t lv_obj_active_count;
 static lv_obj_t *lv_active_screen;
+static size_t lv_snapshot_count;
+static bool lv_snapshot_fail;
+static size_t lv_image_cache_drops;
 
 static lv_style_t style_pool[STYLE_COUNT];
 static esp_err_t header_init_result = ESP_OK;
 static size_t styles_init_calls;
 static size_t styles_deinit_calls;
 static lv_obj_t *content_container_ref;
+static esp_err_t content_load_result = ESP_OK;
+static bool content_loaded_locked;
+static int lv_lock_depth;
+static size_t lv_lock_calls;
 
 static size_t backlight_call_count;
 static bool last_backlight_level;
@@ -72,13 +94,116 @@ static bool panel_del_invoked;
 static bool panel_disp_off_invoked;
 
 static mock_panel_t panel_instance;
+static uint8_t panel_num_fbs;
+/* Séquence de commandes ST7701 envoyée (différée ou non) */
+static bool panel_started;
+static size_t panel_start_calls;
+static size_t panel_bounce_px;
+static uint16_t panel_fbs[2][ST7701_RGB_H_RES * ST7701_RGB_V_RES]
+    __attribute__((aligned(MOCK_CACHE_LINE)));
+static esp_lcd_rgb_panel_event_callbacks_t panel_cbs;
+static void *panel_cbs_ctx;
+static atomic_size_t panel_draw_calls;
+static atomic_size_t panel_bytes_copied;
+static atomic_size_t panel_fb_swaps;
+static uint32_t panel_copy_time_us;
+static uint32_t panel_completion_delay_us;
+static uint32_t panel_frame_period_us = MOCK_FRAME_PERIOD_US;
+
+/* Balayage simulé : VSYNC périodique tant que le panneau existe */
+static pthread_t vsync_thread;
+static atomic_bool vsync_running;
+static atomic_bool panel_manual_vsync;
+
+/* Complétions de copie tardives encore en vol */
+static pthread_mutex_t completion_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t completion_cond = PTHREAD_COND_INITIALIZER;
+static size_t completions_in_flight;
+
+struct async_memcpy_context_t {
+    int dummy;
+};
+
+typedef struct {
+    void *dst;
+    void *src;
+    size_t n;
+    async_memcpy_isr_cb_t cb;
+    void *cb_args;
+} mock_dma_job_t;
+
+static struct async_memcpy_context_t dma_instance;
+static bool dma_installed;
+static bool dma_fail;
+static size_t dma_burst_size;
+static uint32_t dma_delay_us;
+static atomic_size_t dma_copies;
+static atomic_size_t dma_bytes;
+static size_t cache_msync_calls;
+static size_t cache_msync_errors;
+static int cache_msync_last_flags;
+static uint32_t heap_last_caps;
+/* Capacités demandées pour chaque pointeur rendu (dernière allocation en tête de recherche) */
+static struct {
+    void *ptr;
+    uint32_t caps;
+} heap_blocks[MAX_TRACKED_PTRS];
+static size_t heap_block_count;
+
+static lv_display_t display_instance;
+
+struct lv_event_t {
+    void *param;
+};
+
+#define MOCK_MAX_EVENT_CBS 4
+
+static struct {
+    lv_event_cb_t cb;
+    lv_event_code_t filter;
+} lv_event_cbs[MOCK_MAX_EVENT_CBS];
+static size_t lv_event_cb_count;
+static lv_display_flush_cb_t lv_flush_cb;
+static lv_display_flush_wait_cb_t lv_flush_wait_cb;
+static atomic_bool lv_flushing;
+static bool lv_flush_is_last = true;
+static atomic_size_t lv_flush_ready_count;
+static lv_display_render_mode_t lv_render_mode;
+static void *lv_buffers[2];
+static size_t lv_buffer_size;
+static bool lv_display_created;
+static uint32_t lv_refr_band_us;
+static uint32_t lv_refr_psram_ns_per_px;
+static uint32_t lv_refr_sram_ns_per_px;
+static size_t lv_refr_count;
+static size_t lv_invalidate_count;
+/* Timers LVGL : le timer de rafraîchissement de l'affichage et un timer applicatif */
+struct lv_timer_t {
+    lv_timer_cb_t cb;
+    uint32_t period;
+    void *user_data;
+    bool ready;
+};
+static lv_timer_t lv_refr_timer;
+static lv_timer_t lv_app_timer;
+static bool lv_app_timer_created;
+static uint32_t lv_inactive_ms;
+static uint32_t lv_running_anims;
+/* Ordre des opérations observé (numéro de séquence de la dernière de chaque type) */
+static uint32_t mock_op_seq;
+static uint32_t lv_refr_period_seq;
+static uint32_t panel_pclk_seq;
+static uint32_t mock_panel_pclk_hz;
+static size_t panel_pclk_changes;
 
 ui_menu_item_t g_ui_menu_items[1];
 size_t g_ui_menu_items_count;
-const char *g_ui_reptiles[1];
+const char *const *g_ui_reptiles;
 size_t g_ui_reptiles_count;
-ui_alert_item_t g_ui_alerts[1];
+const ui_alert_item_t *g_ui_alerts;
 size_t g_ui_alerts_count;
+ui_terrarium_item_t *g_ui_terrariums;
+size_t g_ui_terrariums_count;
 const char *g_ui_settings_sections[1];
 size_t g_ui_settings_sections_count;
 
@@ -86,13 +211,48 @@ static void reset_lvgl_objects_state(void);
 static void lv_delete_children(lv_obj_t *parent);
 static void lv_obj_del_internal(lv_obj_t *obj);
 
+static int64_t mock_time_us;
+static size_t rom_delay_calls;
+
 int64_t esp_timer_get_time(void)
 {
-    return 0;
+    return mock_time_us;
+}
+
+void test_esp_timer_set_time(int64_t us)
+{
+    mock_time_us = us;
+}
+
+void esp_rom_delay_us(uint32_t us)
+{
+    ++rom_delay_calls;
+    mock_time_us += us;
+}
+
+size_t test_rom_delay_calls(void)
+{
+    return rom_delay_calls;
+}
+
+static void panel_stop_scanout(void)
+{
+    if (atomic_exchange(&vsync_running, false)) {
+        pthread_join(vsync_thread, NULL);
+    }
+    pthread_mutex_lock(&completion_lock);
+    while (completions_in_flight > 0) {
+        pthread_cond_wait(&completion_cond, &completion_lock);
+    }
+    pthread_mutex_unlock(&completion_lock);
 }
 
 void test_reset_mocks(void)
 {
+    panel_stop_scanout();
+    mock_time_us = 0;
+    rom_delay_calls = 0;
+    panel_manual_vsync = false;
     memset(alloc_sequence, 0, sizeof(alloc_sequence));
     alloc_sequence_length = 0;
     alloc_sequence_index = 0;
@@ -104,15 +264,71 @@ void test_reset_mocks(void)
     ch422g_deinit_call_count = 0;
     panel_del_invoked = false;
     panel_disp_off_invoked = false;
+    panel_num_fbs = 0;
+    panel_started = false;
+    panel_start_calls = 0;
+    panel_bounce_px = 0;
+    memset(&panel_cbs, 0, sizeof(panel_cbs));
+    panel_cbs_ctx = NULL;
+    panel_draw_calls = 0;
+    panel_bytes_copied = 0;
+    panel_fb_swaps = 0;
+    panel_copy_time_us = 0;
+    panel_completion_delay_us = 0;
+    panel_frame_period_us = MOCK_FRAME_PERIOD_US;
+    dma_installed = false;
+    dma_fail = false;
+    dma_burst_size = 0;
+    dma_delay_us = 0;
+    dma_copies = 0;
+    dma_bytes = 0;
+    cache_msync_calls = 0;
+    cache_msync_errors = 0;
+    cache_msync_last_flags = 0;
+    heap_last_caps = 0;
+    memset(heap_blocks, 0, sizeof(heap_blocks));
+    heap_block_count = 0;
+    memset(lv_event_cbs, 0, sizeof(lv_event_cbs));
+    lv_event_cb_count = 0;
+    memset(&display_instance, 0, sizeof(display_instance));
+    lv_flush_cb = NULL;
+    lv_flush_wait_cb = NULL;
+    lv_flushing = false;
+    lv_flush_is_last = true;
+    lv_flush_ready_count = 0;
+    lv_render_mode = LV_DISPLAY_RENDER_MODE_PARTIAL;
+    memset(lv_buffers, 0, sizeof(lv_buffers));
+    lv_buffer_size = 0;
+    lv_display_created = false;
+    lv_refr_band_us = 0;
+    lv_refr_psram_ns_per_px = 0;
+    lv_refr_sram_ns_per_px = 0;
+    lv_refr_count = 0;
+    lv_invalidate_count = 0;
+    lv_refr_timer = (lv_timer_t){.period = 16};
+    memset(&lv_app_timer, 0, sizeof(lv_app_timer));
+    lv_app_timer_created = false;
+    lv_inactive_ms = 0;
+    lv_running_anims = 0;
+    mock_op_seq = 0;
+    lv_refr_period_seq = 0;
+    panel_pclk_seq = 0;
+    mock_panel_pclk_hz = 0;
+    panel_pclk_changes = 0;
     reset_lvgl_objects_state();
     styles_init_calls = 0;
     styles_deinit_calls = 0;
     header_init_result = ESP_OK;
     memset(style_pool, 0, sizeof(style_pool));
     content_container_ref = NULL;
+    content_load_result = ESP_OK;
+    content_loaded_locked = false;
+    lv_lock_depth = 0;
+    lv_lock_calls = 0;
     g_ui_menu_items_count = 0;
     g_ui_reptiles_count = 0;
     g_ui_alerts_count = 0;
+    g_ui_terrariums_count = 0;
     g_ui_settings_sections_count = 0;
 }
 
@@ -168,11 +384,272 @@ bool test_panel_disp_off_called(void)
     return panel_disp_off_invoked;
 }
 
+uint8_t test_panel_num_fbs(void)
+{
+    return panel_num_fbs;
+}
+
+size_t test_panel_bounce_buffer_px(void)
+{
+    return panel_bounce_px;
+}
+
+size_t test_panel_draw_calls(void)
+{
+    return panel_draw_calls;
+}
+
+size_t test_panel_bytes_copied(void)
+{
+    return panel_bytes_copied;
+}
+
+size_t test_panel_fb_swaps(void)
+{
+    return panel_fb_swaps;
+}
+
+void test_panel_set_copy_time_us(uint32_t us)
+{
+    panel_copy_time_us = us;
+}
+
+void test_panel_set_completion_delay_us(uint32_t us)
+{
+    panel_completion_delay_us = us;
+}
+
+void test_panel_set_frame_period_us(uint32_t us)
+{
+    panel_frame_period_us = us;
+}
+
+void test_panel_set_manual_vsync(bool manual)
+{
+    atomic_store(&panel_manual_vsync, manual);
+}
+
+bool test_panel_fire_vsync(void)
+{
+    if (!panel_cbs.on_vsync) {
+        return false;
+    }
+    panel_cbs.on_vsync(&panel_instance, NULL, panel_cbs_ctx);
+    return true;
+}
+
+void *test_panel_frame_buffer(void)
+{
+    return panel_fbs[0];
+}
+
+void test_dma_set_delay_us(uint32_t us)
+{
+    dma_delay_us = us;
+}
+
+void test_dma_set_fail(bool fail)
+{
+    dma_fail = fail;
+}
+
+size_t test_dma_burst_size(void)
+{
+    return dma_burst_size;
+}
+
+bool test_dma_installed(void)
+{
+    return dma_installed;
+}
+
+size_t test_dma_copy_count(void)
+{
+    return dma_copies;
+}
+
+size_t test_dma_bytes(void)
+{
+    return dma_bytes;
+}
+
+size_t test_cache_msync_count(void)
+{
+    return cache_msync_calls;
+}
+
+size_t test_cache_msync_error_count(void)
+{
+    return cache_msync_errors;
+}
+
+int test_cache_msync_last_flags(void)
+{
+    return cache_msync_last_flags;
+}
+
+uint32_t test_heap_caps_last_caps(void)
+{
+    return heap_last_caps;
+}
+
+bool test_panel_is_frame_buffer(const void *ptr)
+{
+    const uint8_t *p = ptr;
+    for (uint8_t i = 0; i < panel_num_fbs && i < 2; ++i) {
+        const uint8_t *fb = (const uint8_t *)panel_fbs[i];
+        if (p >= fb && p < fb + sizeof(panel_fbs[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+lv_display_flush_cb_t test_lvgl_flush_cb(void)
+{
+    return lv_flush_cb;
+}
+
+void test_lvgl_set_flush_is_last(bool last)
+{
+    lv_flush_is_last = last;
+}
+
+size_t test_lvgl_flush_ready_count(void)
+{
+    return lv_flush_ready_count;
+}
+
+bool test_lvgl_has_flush_wait_cb(void)
+{
+    return lv_flush_wait_cb != NULL;
+}
+
+/* Équivalent de wait_for_flushing() de lv_refr.c */
+void test_lvgl_wait_flushing(void)
+{
+    if (lv_flush_wait_cb) {
+        if (lv_flushing) {
+            lv_flush_wait_cb(&display_instance);
+        }
+        lv_flushing = false;
+    } else {
+        while (lv_flushing) {
+            sched_yield();
+        }
+    }
+}
+
+/* Équivalent de draw_buf_flush() de lv_refr.c avec deux tampons */
+void test_lvgl_flush(const lv_area_t *area, uint8_t *px_map)
+{
+    test_lvgl_wait_flushing();
+    lv_flushing = true;
+    lv_flush_cb(&display_instance, area, px_map);
+}
+
+static void mock_lvgl_send_event(lv_event_code_t code, void *param)
+{
+    for (size_t i = 0; i < lv_event_cb_count; ++i) {
+        if (lv_event_cbs[i].filter == LV_EVENT_ALL || lv_event_cbs[i].filter == code) {
+            lv_event_t e = {.param = param};
+            lv_event_cbs[i].cb(&e);
+        }
+    }
+}
+
+void test_lvgl_invalidate(lv_area_t *area)
+{
+    mock_lvgl_send_event(LV_EVENT_INVALIDATE_AREA, area);
+}
+
+lv_display_t *test_lvgl_display(void)
+{
+    return &display_instance;
+}
+
+void test_lvgl_render_start(void)
+{
+    mock_lvgl_send_event(LV_EVENT_RENDER_START, NULL);
+}
+
+lv_display_render_mode_t test_lvgl_render_mode(void)
+{
+    return lv_render_mode;
+}
+
+void *test_lvgl_buffer(int index)
+{
+    return (index == 0 || index == 1) ? lv_buffers[index] : NULL;
+}
+
+size_t test_lvgl_buffer_size(void)
+{
+    return lv_buffer_size;
+}
+
+uint32_t test_heap_caps_of(const void *ptr)
+{
+    for (size_t i = heap_block_count; i-- > 0;) {
+        if (heap_blocks[i].ptr == ptr) {
+            return heap_blocks[i].caps;
+        }
+    }
+    return 0;
+}
+
+void test_lvgl_set_refr_cost(uint32_t band_us, uint32_t psram_ns_per_px, uint32_t sram_ns_per_px)
+{
+    lv_refr_band_us = band_us;
+    lv_refr_psram_ns_per_px = psram_ns_per_px;
+    lv_refr_sram_ns_per_px = sram_ns_per_px;
+}
+
+size_t test_lvgl_refr_count(void)
+{
+    return lv_refr_count;
+}
+
+size_t test_lvgl_invalidate_count(void)
+{
+    return lv_invalidate_count;
+}
+
+/*
+ * Rafraîchissement plein écran : l'écran est découpé en bandes de la hauteur
+ * des tampons et chaque bande est flushée comme dans lv_refr.c. Le temps
+ * simulé avance d'un surcoût fixe par bande plus un coût par pixel qui
+ * dépend de l'emplacement du tampon de rendu.
+ */
+void lv_refr_now(lv_display_t *display)
+{
+    (void)display;
+    ++lv_refr_count;
+    if (!lv_flush_cb || !lv_buffer_size) {
+        return;
+    }
+    mock_lvgl_send_event(LV_EVENT_RENDER_START, NULL);
+    int32_t lines = (int32_t)(lv_buffer_size / (ST7701_RGB_H_RES * sizeof(lv_color_t)));
+    uint32_t ns_per_px = (test_heap_caps_of(lv_buffers[0]) & MALLOC_CAP_SPIRAM) ?
+                         lv_refr_psram_ns_per_px : lv_refr_sram_ns_per_px;
+    int band = 0;
+    for (int32_t y = 0; y < ST7701_RGB_V_RES; y += lines, ++band) {
+        int32_t y2 = y + lines - 1 < ST7701_RGB_V_RES ? y + lines - 1 : ST7701_RGB_V_RES - 1;
+        lv_area_t area = {0, y, ST7701_RGB_H_RES - 1, y2};
+        mock_time_us += lv_refr_band_us + (int64_t)lv_area_get_size(&area) * ns_per_px / 1000;
+        test_lvgl_set_flush_is_last(y2 == ST7701_RGB_V_RES - 1);
+        test_lvgl_flush(&area, lv_buffers[band % 2]);
+    }
+}
+
 static void reset_lvgl_objects_state(void)
 {
     memset(lv_obj_pool, 0, sizeof(lv_obj_pool));
     lv_obj_active_count = 0;
     lv_active_screen = NULL;
+    lv_snapshot_count = 0;
+    lv_snapshot_fail = false;
+    lv_image_cache_drops = 0;
 }
 
 void test_lvgl_reset_objects(void)
@@ -188,13 +665,20 @@ size_t test_lvgl_active_object_count(void)
 void *heap_caps_malloc(size_t size, uint32_t caps)
 {
     (void)size;
-    (void)caps;
+    heap_last_caps = caps;
     void *ptr = NULL;
     if (alloc_sequence_index < alloc_sequence_length) {
         ptr = alloc_sequence[alloc_sequence_index++];
     }
     if (ptr) {
         ++active_allocations;
+        if (heap_block_count == MAX_TRACKED_PTRS) {
+            memmove(heap_blocks, heap_blocks + 1, sizeof(heap_blocks[0]) * (MAX_TRACKED_PTRS - 1));
+            --heap_block_count;
+        }
+        heap_blocks[heap_block_count].ptr = ptr;
+        heap_blocks[heap_block_count].caps = caps;
+        ++heap_block_count;
     }
     return ptr;
 }
@@ -237,26 +721,253 @@ void ch422g_deinit(void)
     ++ch422g_deinit_call_count;
 }
 
+static void *vsync_thread_fn(void *arg)
+{
+    (void)arg;
+    while (atomic_load(&vsync_running)) {
+        usleep(panel_frame_period_us);
+        if (panel_cbs.on_vsync && !atomic_load(&panel_manual_vsync)) {
+            panel_cbs.on_vsync(&panel_instance, NULL, panel_cbs_ctx);
+        }
+    }
+    return NULL;
+}
+
+static void *completion_thread_fn(void *arg)
+{
+    (void)arg;
+    usleep(panel_completion_delay_us);
+    if (panel_cbs.on_color_trans_done) {
+        panel_cbs.on_color_trans_done(&panel_instance, NULL, panel_cbs_ctx);
+    }
+    pthread_mutex_lock(&completion_lock);
+    --completions_in_flight;
+    pthread_cond_broadcast(&completion_cond);
+    pthread_mutex_unlock(&completion_lock);
+    return NULL;
+}
+
+static void mock_dma_finish(mock_dma_job_t *job)
+{
+    memcpy(job->dst, job->src, job->n);
+    if (job->cb) {
+        async_memcpy_event_t event = {0};
+        job->cb(&dma_instance, &event, job->cb_args);
+    }
+}
+
+static void *dma_thread_fn(void *arg)
+{
+    mock_dma_job_t *job = arg;
+    usleep(dma_delay_us);
+    mock_dma_finish(job);
+    free(job);
+    pthread_mutex_lock(&completion_lock);
+    --completions_in_flight;
+    pthread_cond_broadcast(&completion_cond);
+    pthread_mutex_unlock(&completion_lock);
+    return NULL;
+}
+
+esp_err_t esp_async_memcpy_install(const async_memcpy_config_t *config, async_memcpy_handle_t *mcp)
+{
+    if (!config || !mcp) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    dma_installed = true;
+    dma_burst_size = config->dma_burst_size;
+    *mcp = &dma_instance;
+    return ESP_OK;
+}
+
+esp_err_t esp_async_memcpy_uninstall(async_memcpy_handle_t mcp)
+{
+    (void)mcp;
+    /* Attend les transferts encore en vol, comme le driver réel */
+    pthread_mutex_lock(&completion_lock);
+    while (completions_in_flight > 0) {
+        pthread_cond_wait(&completion_cond, &completion_lock);
+    }
+    pthread_mutex_unlock(&completion_lock);
+    dma_installed = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_async_memcpy(async_memcpy_handle_t mcp, void *dst, void *src, size_t n,
+                           async_memcpy_isr_cb_t cb_isr, void *cb_args)
+{
+    if (!mcp || !dst || !src || !n) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (dma_fail) {
+        return ESP_FAIL;
+    }
+    /* Le driver réel refuse une destination hors rafale et une source non alignée sur le mot */
+    if ((dma_burst_size && ((uintptr_t)dst % dma_burst_size || n % dma_burst_size)) ||
+        (uintptr_t)src % 4) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    ++dma_copies;
+    dma_bytes += n;
+    mock_dma_job_t job = {dst, src, n, cb_isr, cb_args};
+    if (!dma_delay_us) {
+        mock_dma_finish(&job);
+        return ESP_OK;
+    }
+    mock_dma_job_t *late = malloc(sizeof(*late));
+    if (!late) {
+        return ESP_ERR_NO_MEM;
+    }
+    *late = job;
+    pthread_t thread;
+    pthread_mutex_lock(&completion_lock);
+    ++completions_in_flight;
+    pthread_mutex_unlock(&completion_lock);
+    pthread_create(&thread, NULL, dma_thread_fn, late);
+    pthread_detach(thread);
+    return ESP_OK;
+}
+
+esp_err_t esp_cache_msync(void *addr, size_t size, int flags)
+{
+    ++cache_msync_calls;
+    cache_msync_last_flags = flags;
+    if (!(flags & ESP_CACHE_MSYNC_FLAG_UNALIGNED) &&
+        (((uintptr_t)addr % MOCK_CACHE_LINE) != 0 || (size % MOCK_CACHE_LINE) != 0)) {
+        ++cache_msync_errors;
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
 esp_err_t st7701_rgb_new_panel(esp_lcd_panel_handle_t *handle)
 {
-    if (!handle) {
+    const st7701_rgb_config_t config = ST7701_RGB_DEFAULT_CONFIG();
+    return st7701_rgb_new_panel_with_config(&config, handle);
+}
+
+esp_err_t st7701_rgb_new_panel_with_config(const st7701_rgb_config_t *config,
+                                           esp_lcd_panel_handle_t *handle)
+{
+    if (!config || !handle || config->num_fbs < 1 || config->num_fbs > 2) {
         return ESP_ERR_INVALID_ARG;
     }
+    panel_num_fbs = config->num_fbs;
+    panel_bounce_px = config->bounce_buffer_size_px;
+    mock_panel_pclk_hz = config->pclk_hz;
+    panel_started = !config->defer_init;
     *handle = &panel_instance;
+    panel_stop_scanout();
+    atomic_store(&vsync_running, true);
+    pthread_create(&vsync_thread, NULL, vsync_thread_fn, NULL);
+    return ESP_OK;
+}
+
+esp_err_t st7701_rgb_panel_start(esp_lcd_panel_handle_t panel)
+{
+    if (panel != &panel_instance) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    ++panel_start_calls;
+    panel_started = true;
     return ESP_OK;
 }
 
+bool test_panel_started(void)
+{
+    return panel_started;
+}
+
+size_t test_panel_start_calls(void)
+{
+    return panel_start_calls;
+}
+
+esp_err_t esp_lcd_rgb_panel_get_frame_buffer(esp_lcd_panel_handle_t panel, uint32_t fb_num,
+                                             void **fb0, ...)
+{
+    (void)panel;
+    if (fb_num == 0 || fb_num > panel_num_fbs || !fb0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *fb0 = panel_fbs[0];
+    va_list args;
+    va_start(args, fb0);
+    for (uint32_t i = 1; i < fb_num; ++i) {
+        void **fb = va_arg(args, void **);
+        *fb = panel_fbs[i];
+    }
+    va_end(args);
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_rgb_panel_register_event_callbacks(esp_lcd_panel_handle_t panel,
+                                                     const esp_lcd_rgb_panel_event_callbacks_t *callbacks,
+                                                     void *user_ctx)
+{
+    (void)panel;
+    if (!callbacks) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    panel_cbs = *callbacks;
+    panel_cbs_ctx = user_ctx;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_rgb_panel_set_pclk(esp_lcd_panel_handle_t panel, uint32_t freq_hz)
+{
+    (void)panel;
+    mock_panel_pclk_hz = freq_hz;
+    ++panel_pclk_changes;
+    panel_pclk_seq = ++mock_op_seq;
+    return ESP_OK;
+}
+
+uint32_t test_panel_pclk_hz(void)
+{
+    return mock_panel_pclk_hz;
+}
+
+size_t test_panel_pclk_changes(void)
+{
+    return panel_pclk_changes;
+}
+
+uint32_t test_panel_pclk_seq(void)
+{
+    return panel_pclk_seq;
+}
+
 esp_err_t esp_lcd_panel_draw_bitmap(esp_lcd_panel_handle_t handle,
                                     int x_start, int y_start,
                                     int x_end, int y_end,
                                     const void *color_data)
 {
-    (void)handle;
-    (void)x_start;
-    (void)y_start;
-    (void)x_end;
-    (void)y_end;
-    (void)color_data;
+    ++panel_draw_calls;
+    if (test_panel_is_frame_buffer(color_data)) {
+        /* Bascule de framebuffer : appliquée au prochain VSYNC du balayage simulé */
+        ++panel_fb_swaps;
+        return ESP_OK;
+    }
+    /* Copie CPU dans le framebuffer, dans le contexte de l'appelant */
+    if (panel_copy_time_us) {
+        usleep(panel_copy_time_us);
+    }
+    panel_bytes_copied += (size_t)(x_end - x_start) * (size_t)(y_end - y_start) * sizeof(uint16_t);
+    if (!panel_cbs.on_color_trans_done) {
+        return ESP_OK;
+    }
+    if (!panel_completion_delay_us) {
+        panel_cbs.on_color_trans_done(handle, NULL, panel_cbs_ctx);
+        return ESP_OK;
+    }
+    /* Complétion tardive, signalée depuis un autre contexte */
+    pthread_t thread;
+    pthread_mutex_lock(&completion_lock);
+    ++completions_in_flight;
+    pthread_mutex_unlock(&completion_lock);
+    pthread_create(&thread, NULL, completion_thread_fn, NULL);
+    pthread_detach(thread);
     return ESP_OK;
 }
 
@@ -272,6 +983,7 @@ esp_err_t esp_lcd_panel_disp_on_off(esp_lcd_panel_handle_t handle, bool on)
 esp_err_t esp_lcd_panel_del(esp_lcd_panel_handle_t handle)
 {
     (void)handle;
+    panel_stop_scanout();
     panel_del_invoked = true;
     return ESP_OK;
 }
@@ -283,22 +995,115 @@ esp_err_t esp_lcd_panel_disp_sleep(esp_lcd_panel_handle_t handle, bool sleep)
     return ESP_OK;
 }
 
-struct lv_display_t {
-    int dummy;
-};
-
-static lv_display_t display_instance;
-
 lv_display_t *lv_display_create(int32_t hor_res, int32_t ver_res)
 {
     (void)hor_res;
     (void)ver_res;
+    lv_display_created = true;
     return &display_instance;
 }
 
 void lv_display_delete(lv_display_t *display)
 {
     (void)display;
+    lv_display_created = false;
+}
+
+lv_display_t *lv_display_get_default(void)
+{
+    return lv_display_created ? &display_instance : NULL;
+}
+
+lv_timer_t *lv_display_get_refr_timer(lv_display_t *display)
+{
+    (void)display;
+    return &lv_refr_timer;
+}
+
+uint32_t lv_display_get_inactive_time(const lv_display_t *display)
+{
+    (void)display;
+    return lv_inactive_ms;
+}
+
+uint32_t lv_anim_count_running(void)
+{
+    return lv_running_anims;
+}
+
+lv_timer_t *lv_timer_create(lv_timer_cb_t cb, uint32_t period, void *user_data)
+{
+    if (lv_app_timer_created) {
+        return NULL;
+    }
+    lv_app_timer = (lv_timer_t){.cb = cb, .period = period, .user_data = user_data};
+    lv_app_timer_created = true;
+    return &lv_app_timer;
+}
+
+void lv_timer_delete(lv_timer_t *timer)
+{
+    assert(timer == &lv_app_timer && lv_app_timer_created);
+    lv_app_timer_created = false;
+}
+
+void lv_timer_set_period(lv_timer_t *timer, uint32_t period)
+{
+    timer->period = period;
+    if (timer == &lv_refr_timer) {
+        lv_refr_period_seq = ++mock_op_seq;
+    }
+}
+
+uint32_t lv_timer_get_period(const lv_timer_t *timer)
+{
+    return timer->period;
+}
+
+void lv_timer_ready(lv_timer_t *timer)
+{
+    timer->ready = true;
+}
+
+void test_lvgl_set_inactive_time(uint32_t ms)
+{
+    lv_inactive_ms = ms;
+}
+
+void test_lvgl_set_running_anims(uint32_t count)
+{
+    lv_running_anims = count;
+}
+
+bool test_lvgl_run_app_timer(void)
+{
+    if (!lv_app_timer_created) {
+        return false;
+    }
+    lv_app_timer.cb(&lv_app_timer);
+    return true;
+}
+
+bool test_lvgl_app_timer_created(void)
+{
+    return lv_app_timer_created;
+}
+
+lv_timer_t *test_lvgl_refr_timer(void)
+{
+    return &lv_refr_timer;
+}
+
+bool test_lvgl_refr_timer_take_ready(void)
+{
+    bool ready = lv_refr_timer.ready;
+    lv_refr_timer.ready = false;
+    return ready;
+}
+
+uint32_t test_lvgl_refr_period_seq(void)
+{
+    return lv_refr_period_seq;
 }
 
 void lv_display_set_default(lv_display_t *display)
@@ -309,22 +1114,76 @@ void lv_display_set_default(lv_display_t *display)
 void lv_display_set_flush_cb(lv_display_t *display, lv_display_flush_cb_t cb)
 {
     (void)display;
-    (void)cb;
+    lv_flush_cb = cb;
 }
 
 void lv_display_set_buffers(lv_display_t *display, void *buf1, void *buf2,
                             size_t size_in_bytes, lv_display_render_mode_t mode)
 {
     (void)display;
-    (void)buf1;
-    (void)buf2;
-    (void)size_in_bytes;
-    (void)mode;
+    lv_buffers[0] = buf1;
+    lv_buffers[1] = buf2;
+    lv_buffer_size = size_in_bytes;
+    lv_render_mode = mode;
+}
+
+void lv_display_set_flush_wait_cb(lv_display_t *display, lv_display_flush_wait_cb_t cb)
+{
+    (void)display;
+    lv_flush_wait_cb = cb;
+}
+
+void lv_display_add_event_cb(lv_display_t *display, lv_event_cb_t cb, lv_event_code_t filter,
+                             void *user_data)
+{
+    (void)display;
+    (void)user_data;
+    assert(lv_event_cb_count < MOCK_MAX_EVENT_CBS);
+    lv_event_cbs[lv_event_cb_count].cb = cb;
+    lv_event_cbs[lv_event_cb_count].filter = filter;
+    ++lv_event_cb_count;
+}
+
+uint32_t lv_display_remove_event_cb_with_user_data(lv_display_t *display, lv_event_cb_t cb,
+                                                   void *user_data)
+{
+    (void)display;
+    (void)user_data;
+    uint32_t removed = 0;
+    for (size_t i = 0; i < lv_event_cb_count;) {
+        if (lv_event_cbs[i].cb == cb) {
+            memmove(&lv_event_cbs[i], &lv_event_cbs[i + 1],
+                    sizeof(lv_event_cbs[0]) * (lv_event_cb_count - i - 1));
+            --lv_event_cb_count;
+            ++removed;
+        } else {
+            ++i;
+        }
+    }
+    return removed;
+}
+
+void test_lvgl_refr_start(void)
+{
+    mock_lvgl_send_event(LV_EVENT_REFR_START, NULL);
+}
+
+void *lv_event_get_param(lv_event_t *e)
+{
+    return e->param;
 }
 
 void lv_display_flush_ready(lv_display_t *display)
 {
     (void)display;
+    lv_flushing = false;
+    ++lv_flush_ready_count;
+}
+
+bool lv_display_flush_is_last(lv_display_t *display)
+{
+    (void)display;
+    return lv_flush_is_last;
 }
 
 lv_obj_t *lv_obj_create(lv_obj_t *parent)
@@ -332,7 +1191,8 @@ lv_obj_t *lv_obj_create(lv_obj_t *parent)
     for (size_t i = 0; i < MAX_LV_OBJECTS; ++i) {
         if (!lv_obj_pool[i].used) {
             lv_obj_pool[i].used = true;
-            lv_obj_pool[i].obj.parent = parent;
+            lv_obj_pool[i].in_snapshot = false;
+            lv_obj_pool[i].obj = (lv_obj_t){.parent = parent, .opa_layered = 255};
             ++lv_obj_active_count;
             return &lv_obj_pool[i].obj;
         }
@@ -432,6 +1292,17 @@ lv_obj_t *lv_scr_act(void)
     return lv_active_screen;
 }
 
+lv_obj_t *lv_screen_active(void)
+{
+    return lv_active_screen;
+}
+
+void lv_obj_invalidate(const lv_obj_t *obj)
+{
+    (void)obj;
+    ++lv_invalidate_count;
+}
+
 void lv_obj_clean(lv_obj_t *obj)
 {
     if (!obj) {
@@ -440,6 +1311,175 @@ void lv_obj_clean(lv_obj_t *obj)
     lv_delete_children(obj);
 }
 
+lv_obj_t *lv_obj_get_parent(const lv_obj_t *obj)
+{
+    return obj ? obj->parent : NULL;
+}
+
+lv_obj_t *lv_obj_get_child(const lv_obj_t *obj, int32_t idx)
+{
+    for (size_t i = 0; i < MAX_LV_OBJECTS; ++i) {
+        if (lv_obj_pool[i].used && lv_obj_pool[i].obj.parent == obj && idx-- == 0) {
+            return &lv_obj_pool[i].obj;
+        }
+    }
+    return NULL;
+}
+
+uint32_t lv_obj_get_child_count(const lv_obj_t *obj)
+{
+    uint32_t count = 0;
+    for (size_t i = 0; i < MAX_LV_OBJECTS; ++i) {
+        if (lv_obj_pool[i].used && lv_obj_pool[i].obj.parent == obj) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void lv_obj_update_layout(const lv_obj_t *obj)
+{
+    (void)obj;
+}
+
+int32_t lv_obj_get_width(const lv_obj_t *obj)
+{
+    return obj->w;
+}
+
+int32_t lv_obj_get_height(const lv_obj_t *obj)
+{
+    return obj->h;
+}
+
+int32_t lv_obj_get_ext_draw_size(const lv_obj_t *obj)
+{
+    return obj->ext_draw_size;
+}
+
+void lv_obj_set_style_opa_layered(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector)
+{
+    (void)selector;
+    obj->opa_layered = value;
+}
+
+void lv_obj_set_style_bg_image_src(lv_obj_t *obj, const void *value, lv_style_selector_t selector)
+{
+    (void)selector;
+    obj->bg_image_src = value;
+}
+
+bool lv_obj_remove_local_style_prop(lv_obj_t *obj, lv_style_prop_t prop,
+                                    lv_style_selector_t selector)
+{
+    (void)selector;
+    if (prop == LV_STYLE_BG_IMAGE_SRC) {
+        obj->bg_image_src = NULL;
+    } else if (prop == LV_STYLE_OPA_LAYERED) {
+        obj->opa_layered = 255;
+    }
+    return true;
+}
+
+uint32_t lv_draw_buf_width_to_stride(uint32_t w, lv_color_format_t color_format)
+{
+    (void)color_format;
+    return w * 2;
+}
+
+lv_result_t lv_draw_buf_init(lv_draw_buf_t *draw_buf, uint32_t w, uint32_t h,
+                             lv_color_format_t cf, uint32_t stride, void *data, uint32_t data_size)
+{
+    if (!draw_buf || !data || data_size < stride * h) {
+        return LV_RESULT_INVALID;
+    }
+    *draw_buf = (lv_draw_buf_t){
+        .header = {.cf = cf, .w = w, .h = h, .stride = stride},
+        .data_size = data_size,
+        .data = data,
+    };
+    return LV_RESULT_OK;
+}
+
+static bool lv_obj_drawn_in(const lv_obj_t *obj, const lv_obj_t *root)
+{
+    for (; obj && obj != root; obj = obj->parent) {
+        if (obj->opa_layered == 0) {
+            return false;
+        }
+    }
+    return obj == root;
+}
+
+/*
+ * Instantané simulé : vérifie la taille du tampon (objet + zone étendue) et
+ * note quels descendants auraient été dessinés (opa_layered non nul).
+ */
+lv_result_t lv_snapshot_take_to_draw_buf(lv_obj_t *obj, lv_color_format_t cf,
+                                         lv_draw_buf_t *draw_buf)
+{
+    (void)cf;
+    uint32_t w = (uint32_t)(obj->w + 2 * obj->ext_draw_size);
+    uint32_t h = (uint32_t)(obj->h + 2 * obj->ext_draw_size);
+    if (lv_snapshot_fail || draw_buf->data_size < w * 2 * h) {
+        return LV_RESULT_INVALID;
+    }
+    draw_buf->header.w = w;
+    draw_buf->header.h = h;
+    for (size_t i = 0; i < MAX_LV_OBJECTS; ++i) {
+        if (lv_obj_pool[i].used) {
+            lv_obj_pool[i].in_snapshot = &lv_obj_pool[i].obj != obj &&
+                                         lv_obj_drawn_in(&lv_obj_pool[i].obj, obj);
+        }
+    }
+    ++lv_snapshot_count;
+    return LV_RESULT_OK;
+}
+
+void lv_image_cache_drop(const void *src)
+{
+    (void)src;
+    ++lv_image_cache_drops;
+}
+
+void test_lvgl_obj_set_size(lv_obj_t *obj, int32_t w, int32_t h, int32_t ext_draw_size)
+{
+    obj->w = w;
+    obj->h = h;
+    obj->ext_draw_size = ext_draw_size;
+}
+
+size_t test_lvgl_snapshot_count(void)
+{
+    return lv_snapshot_count;
+}
+
+void test_lvgl_set_snapshot_fail(bool fail)
+{
+    lv_snapshot_fail = fail;
+}
+
+bool test_lvgl_obj_in_last_snapshot(const lv_obj_t *obj)
+{
+    for (size_t i = 0; i < MAX_LV_OBJECTS; ++i) {
+        if (lv_obj_pool[i].used && &lv_obj_pool[i].obj == obj) {
+            return lv_obj_pool[i].in_snapshot;
+        }
+    }
+    return false;
+}
+
+/* Objet rendu à l'écran : visible jusqu'à la racine (opa_layered non nul) */
+bool test_lvgl_obj_drawn(const lv_obj_t *obj)
+{
+    return lv_obj_drawn_in(obj, NULL);
+}
+
+size_t test_lvgl_image_cache_drops(void)
+{
+    return lv_image_cache_drops;
+}
+
 size_t test_ui_styles_init_call_count(void)
 {
     return styles_init_calls;
@@ -450,6 +1490,38 @@ size_t test_ui_styles_deinit_call_count(void)
     return styles_deinit_calls;
 }
 
+void test_ui_set_content_load_result(esp_err_t result)
+{
+    content_load_result = result;
+}
+
+bool test_ui_content_loaded_locked(void)
+{
+    return content_loaded_locked;
+}
+
+int test_lvgl_lock_depth(void)
+{
+    return lv_lock_depth;
+}
+
+size_t test_lvgl_lock_count(void)
+{
+    return lv_lock_calls;
+}
+
+void lv_lock(void)
+{
+    ++lv_lock_depth;
+    ++lv_lock_calls;
+}
+
+void lv_unlock(void)
+{
+    assert(lv_lock_depth > 0);
+    --lv_lock_depth;
+}
+
 void test_ui_set_header_init_result(esp_err_t result)
 {
     header_init_result = result;
@@ -576,6 +1648,7 @@ void ui_data_load_defaults(void)
     g_ui_menu_items_count = 0;
     g_ui_reptiles_count = 0;
     g_ui_alerts_count = 0;
+    g_ui_terrariums_count = 0;
     g_ui_settings_sections_count = 0;
 }
 
@@ -642,7 +1715,8 @@ esp_err_t ui_content_init(lv_obj_t *parent)
 esp_err_t ui_content_load_screen(nova_screen_t screen_type)
 {
     (void)screen_type;
-    return ESP_OK;
+    content_loaded_locked = lv_lock_depth > 0;
+    return content_load_result;
 }
 
 void ui_content_update_realtime_data(void)
@@ -0,0 +1,225 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+/*
+ * Implémentation minimale de FreeRTOS sur pthreads : assez pour exécuter les
+ * drivers sur l'hôte avec de vraies tâches concurrentes (tick = 1 ms).
+ */
+
+struct mock_semaphore {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    UBaseType_t count;
+    UBaseType_t max_count;
+    bool recursive;
+    pthread_t owner;
+    UBaseType_t depth;
+};
+
+struct mock_task {
+    pthread_t thread;
+    TaskFunction_t fn;
+    void *arg;
+};
+
+static void deadline_from_ticks(struct timespec *ts, TickType_t ticks)
+{
+    clock_gettime(CLOCK_REALTIME, ts);
+    uint64_t ns = (uint64_t)ts->tv_nsec + (uint64_t)ticks * (1000000000ull / configTICK_RATE_HZ);
+    ts->tv_sec += (time_t)(ns / 1000000000ull);
+    ts->tv_nsec = (long)(ns % 1000000000ull);
+}
+
+static SemaphoreHandle_t semaphore_create(UBaseType_t max_count, UBaseType_t initial, bool recursive)
+{
+    SemaphoreHandle_t sem = calloc(1, sizeof(*sem));
+    if (!sem) {
+        return NULL;
+    }
+    pthread_mutex_init(&sem->lock, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->count = initial;
+    sem->max_count = max_count;
+    sem->recursive = recursive;
+    return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return semaphore_create(1, 0, false);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count)
+{
+    return semaphore_create(max_count, initial_count, false);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return semaphore_create(1, 1, false);
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void)
+{
+    return semaphore_create(1, 1, true);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    if (!sem) {
+        return pdFALSE;
+    }
+    struct timespec deadline;
+    if (ticks != portMAX_DELAY) {
+        deadline_from_ticks(&deadline, ticks);
+    }
+    pthread_mutex_lock(&sem->lock);
+    while (sem->count == 0) {
+        if (ticks == 0) {
+            break;
+        }
+        int rc = ticks == portMAX_DELAY ? pthread_cond_wait(&sem->cond, &sem->lock)
+                                        : pthread_cond_timedwait(&sem->cond, &sem->lock, &deadline);
+        if (rc == ETIMEDOUT) {
+            break;
+        }
+    }
+    BaseType_t taken = pdFALSE;
+    if (sem->count > 0) {
+        --sem->count;
+        taken = pdTRUE;
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return taken;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    if (!sem) {
+        return pdFALSE;
+    }
+    BaseType_t given = pdFALSE;
+    pthread_mutex_lock(&sem->lock);
+    if (sem->count < sem->max_count) {
+        ++sem->count;
+        given = pdTRUE;
+        pthread_cond_signal(&sem->cond);
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return given;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *higher_prio_woken)
+{
+    if (higher_prio_woken) {
+        *higher_prio_woken = pdFALSE;
+    }
+    return xSemaphoreGive(sem);
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    if (!sem) {
+        return pdFALSE;
+    }
+    pthread_mutex_lock(&sem->lock);
+    if (sem->depth > 0 && pthread_equal(sem->owner, pthread_self())) {
+        ++sem->depth;
+        pthread_mutex_unlock(&sem->lock);
+        return pdTRUE;
+    }
+    pthread_mutex_unlock(&sem->lock);
+
+    if (xSemaphoreTake(sem, ticks) != pdTRUE) {
+        return pdFALSE;
+    }
+    pthread_mutex_lock(&sem->lock);
+    sem->owner = pthread_self();
+    sem->depth = 1;
+    pthread_mutex_unlock(&sem->lock);
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem)
+{
+    if (!sem) {
+        return pdFALSE;
+    }
+    pthread_mutex_lock(&sem->lock);
+    if (sem->depth == 0 || !pthread_equal(sem->owner, pthread_self())) {
+        pthread_mutex_unlock(&sem->lock);
+        return pdFALSE;
+    }
+    bool release = --sem->depth == 0;
+    pthread_mutex_unlock(&sem->lock);
+    return release ? xSemaphoreGive(sem) : pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    if (!sem) {
+        return;
+    }
+    pthread_cond_destroy(&sem->cond);
+    pthread_mutex_destroy(&sem->lock);
+    free(sem);
+}
+
+static void *task_trampoline(void *arg)
+{
+    struct mock_task *task = arg;
+    task->fn(task->arg);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                                   void *arg, UBaseType_t priority, TaskHandle_t *handle,
+                                   BaseType_t core_id)
+{
+    (void)name;
+    (void)stack_depth;
+    (void)priority;
+    (void)core_id;
+    struct mock_task *task = calloc(1, sizeof(*task));
+    if (!task) {
+        return pdFAIL;
+    }
+    task->fn = fn;
+    task->arg = arg;
+    if (pthread_create(&task->thread, NULL, task_trampoline, task) != 0) {
+        free(task);
+        return pdFAIL;
+    }
+    pthread_detach(task->thread);
+    if (handle) {
+        *handle = task;
+    }
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    /* Seule l'auto-suppression (task == NULL) est supportée */
+    (void)task;
+    pthread_exit(NULL);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    usleep((useconds_t)ticks * (1000000u / configTICK_RATE_HZ));
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (TickType_t)((uint64_t)now.tv_sec * configTICK_RATE_HZ +
+                        (uint64_t)now.tv_nsec / (1000000000ull / configTICK_RATE_HZ));
+}
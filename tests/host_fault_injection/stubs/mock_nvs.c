@@ -0,0 +1,147 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include "nvs.h"
+#include "mock_support.h"
+
+#define MOCK_NVS_MAX_ENTRIES 8
+#define MOCK_NVS_MAX_NAME    16
+#define MOCK_NVS_MAX_BLOB    64
+
+/* Stockage NVS en mémoire : un seul handle ouvert à la fois suffit aux tests */
+typedef struct {
+    bool used;
+    char ns[MOCK_NVS_MAX_NAME];
+    char key[MOCK_NVS_MAX_NAME];
+    uint8_t data[MOCK_NVS_MAX_BLOB];
+    size_t length;
+} mock_nvs_entry_t;
+
+static mock_nvs_entry_t nvs_entries[MOCK_NVS_MAX_ENTRIES];
+static char nvs_open_ns[MOCK_NVS_MAX_NAME];
+static bool nvs_open_rw;
+static bool nvs_is_open;
+static size_t nvs_commits;
+
+void test_nvs_reset(void)
+{
+    memset(nvs_entries, 0, sizeof(nvs_entries));
+    nvs_open_ns[0] = '\0';
+    nvs_is_open = false;
+    nvs_commits = 0;
+}
+
+size_t test_nvs_commit_count(void)
+{
+    return nvs_commits;
+}
+
+bool test_nvs_is_open(void)
+{
+    return nvs_is_open;
+}
+
+static mock_nvs_entry_t *nvs_find(const char *ns, const char *key)
+{
+    for (size_t i = 0; i < MOCK_NVS_MAX_ENTRIES; ++i) {
+        mock_nvs_entry_t *e = &nvs_entries[i];
+        if (e->used && strcmp(e->ns, ns) == 0 && (!key || strcmp(e->key, key) == 0)) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+esp_err_t test_nvs_write_blob(const char *ns, const char *key, const void *value, size_t length)
+{
+    assert(strlen(ns) < MOCK_NVS_MAX_NAME && strlen(key) < MOCK_NVS_MAX_NAME);
+    if (length > MOCK_NVS_MAX_BLOB) {
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    mock_nvs_entry_t *e = nvs_find(ns, key);
+    for (size_t i = 0; !e && i < MOCK_NVS_MAX_ENTRIES; ++i) {
+        if (!nvs_entries[i].used) {
+            e = &nvs_entries[i];
+        }
+    }
+    if (!e) {
+        return ESP_ERR_NO_MEM;
+    }
+    e->used = true;
+    strcpy(e->ns, ns);
+    strcpy(e->key, key);
+    memcpy(e->data, value, length);
+    e->length = length;
+    return ESP_OK;
+}
+
+esp_err_t nvs_open(const char *namespace_name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle)
+{
+    assert(!nvs_is_open);
+    /* Comme l'IDF : un espace de noms inexistant ne s'ouvre qu'en écriture */
+    if (open_mode == NVS_READONLY && !nvs_find(namespace_name, NULL)) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    strncpy(nvs_open_ns, namespace_name, MOCK_NVS_MAX_NAME - 1);
+    nvs_open_rw = open_mode == NVS_READWRITE;
+    nvs_is_open = true;
+    *out_handle = 1;
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle)
+{
+    assert(handle == 1 && nvs_is_open);
+    nvs_is_open = false;
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length)
+{
+    if (handle != 1 || !nvs_is_open) {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    mock_nvs_entry_t *e = nvs_find(nvs_open_ns, key);
+    if (!e) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    if (!out_value) {
+        *length = e->length;
+        return ESP_OK;
+    }
+    if (*length < e->length) {
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    memcpy(out_value, e->data, e->length);
+    *length = e->length;
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length)
+{
+    if (handle != 1 || !nvs_is_open || !nvs_open_rw) {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    return test_nvs_write_blob(nvs_open_ns, key, value, length);
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char *key)
+{
+    if (handle != 1 || !nvs_is_open || !nvs_open_rw) {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    mock_nvs_entry_t *e = nvs_find(nvs_open_ns, key);
+    if (!e) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    memset(e, 0, sizeof(*e));
+    return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    if (handle != 1 || !nvs_is_open) {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    ++nvs_commits;
+    return ESP_OK;
+}
@@ -4,6 +4,7 @@
 #include <stdbool.h>
 #include "esp_err.h"
 #include "ch422g.h"
+#include "lvgl.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -14,20 +15,116 @@ void test_reset_mocks(void);
 void test_heap_caps_set_sequence(void *const *sequence, size_t length);
 size_t test_heap_caps_active_allocations(void);
 bool test_heap_caps_pointer_freed(const void *ptr);
+uint32_t test_heap_caps_last_caps(void);
+/* Capacités de la dernière allocation ayant rendu ptr (0 si inconnu) */
+uint32_t test_heap_caps_of(const void *ptr);
+
+/* NVS en mémoire (mock_nvs.c) */
+void test_nvs_reset(void);
+size_t test_nvs_commit_count(void);
+bool test_nvs_is_open(void);
+esp_err_t test_nvs_write_blob(const char *ns, const char *key, const void *value, size_t length);
 
 size_t test_backlight_call_count(void);
 bool test_backlight_last_level(void);
 size_t test_ch422g_deinit_call_count(void);
 
+void test_esp_timer_set_time(int64_t us);
+/* Appels à esp_rom_delay_us() (chacun avance l'horloge simulée) */
+size_t test_rom_delay_calls(void);
+
 bool test_panel_del_called(void);
 bool test_panel_disp_off_called(void);
+uint8_t test_panel_num_fbs(void);
+/* Séquence de commandes ST7701 envoyée, appels à st7701_rgb_panel_start() */
+bool test_panel_started(void);
+size_t test_panel_start_calls(void);
+size_t test_panel_bounce_buffer_px(void);
+size_t test_panel_draw_calls(void);
+size_t test_panel_bytes_copied(void);
+size_t test_panel_fb_swaps(void);
+bool test_panel_is_frame_buffer(const void *ptr);
+/* Durée de la copie CPU dans draw_bitmap (0 = instantanée) */
+void test_panel_set_copy_time_us(uint32_t us);
+/* Retard de on_color_trans_done après draw_bitmap (0 = synchrone) */
+void test_panel_set_completion_delay_us(uint32_t us);
+void test_panel_set_frame_period_us(uint32_t us);
+/* VSYNC à la demande : le balayage simulé cesse d'appeler on_vsync */
+void test_panel_set_manual_vsync(bool manual);
+/* Appelle on_vsync comme l'ISR du panneau, false s'il n'est pas enregistré */
+bool test_panel_fire_vsync(void);
+void *test_panel_frame_buffer(void);
+/* Horloge pixel demandée au panneau et nombre de changements */
+uint32_t test_panel_pclk_hz(void);
+size_t test_panel_pclk_changes(void);
+
+/* Moteur async memcpy : retard de complétion (0 = synchrone), échec forcé */
+void test_dma_set_delay_us(uint32_t us);
+void test_dma_set_fail(bool fail);
+bool test_dma_installed(void);
+size_t test_dma_burst_size(void);
+size_t test_dma_copy_count(void);
+size_t test_dma_bytes(void);
+size_t test_cache_msync_count(void);
+size_t test_cache_msync_error_count(void);
+int test_cache_msync_last_flags(void);
+
+lv_display_flush_cb_t test_lvgl_flush_cb(void);
+void test_lvgl_set_flush_is_last(bool last);
+size_t test_lvgl_flush_ready_count(void);
+bool test_lvgl_has_flush_wait_cb(void);
+/* Reproduisent l'attente et le flush double tampon de lv_refr.c */
+void test_lvgl_wait_flushing(void);
+void test_lvgl_flush(const lv_area_t *area, uint8_t *px_map);
+/* Émet LV_EVENT_INVALIDATE_AREA vers le callback enregistré par le driver */
+void test_lvgl_invalidate(lv_area_t *area);
+/* Affichage LVGL simulé (champs inv_areas de lvgl_private.h) */
+lv_display_t *test_lvgl_display(void);
+/* Émet LV_EVENT_RENDER_START, comme refr_invalid_areas() avant le rendu */
+void test_lvgl_render_start(void);
+/* Émet LV_EVENT_REFR_START, comme lv_display_refr_timer() avant la mise en page */
+void test_lvgl_refr_start(void);
+lv_display_render_mode_t test_lvgl_render_mode(void);
+void *test_lvgl_buffer(int index);
+size_t test_lvgl_buffer_size(void);
+/* Modèle de coût de lv_refr_now() : par bande, par pixel en PSRAM / SRAM interne */
+void test_lvgl_set_refr_cost(uint32_t band_us, uint32_t psram_ns_per_px, uint32_t sram_ns_per_px);
+size_t test_lvgl_refr_count(void);
+size_t test_lvgl_invalidate_count(void);
+/* Activité vue par LVGL : inactivité des entrées, animations en cours */
+void test_lvgl_set_inactive_time(uint32_t ms);
+void test_lvgl_set_running_anims(uint32_t count);
+/* Timer applicatif (un seul) : exécute son callback, false s'il n'existe pas */
+bool test_lvgl_run_app_timer(void);
+bool test_lvgl_app_timer_created(void);
+lv_timer_t *test_lvgl_refr_timer(void);
+/* Rafraîchissement anticipé demandé par lv_timer_ready(), remis à zéro à la lecture */
+bool test_lvgl_refr_timer_take_ready(void);
+/* Numéros de séquence du dernier changement de période / d'horloge pixel */
+uint32_t test_lvgl_refr_period_seq(void);
+uint32_t test_panel_pclk_seq(void);
+
+/* Verrou global LVGL : profondeur courante et nombre de prises */
+int test_lvgl_lock_depth(void);
+size_t test_lvgl_lock_count(void);
 
 void test_lvgl_reset_objects(void);
 size_t test_lvgl_active_object_count(void);
+/* Géométrie d'un objet simulé : taille et zone de dessin étendue (ombre) */
+void test_lvgl_obj_set_size(lv_obj_t *obj, int32_t w, int32_t h, int32_t ext_draw_size);
+/* lv_snapshot_take_to_draw_buf() : nombre d'appels, échec forcé, objets dessinés */
+size_t test_lvgl_snapshot_count(void);
+void test_lvgl_set_snapshot_fail(bool fail);
+bool test_lvgl_obj_in_last_snapshot(const lv_obj_t *obj);
+/* Objet dessiné à l'écran (aucun ancêtre en opa_layered nul) */
+bool test_lvgl_obj_drawn(const lv_obj_t *obj);
+size_t test_lvgl_image_cache_drops(void);
 
 void test_ui_set_header_init_result(esp_err_t result);
 size_t test_ui_styles_init_call_count(void);
 size_t test_ui_styles_deinit_call_count(void);
+void test_ui_set_content_load_result(esp_err_t result);
+bool test_ui_content_loaded_locked(void);
 
 #ifdef __cplusplus
 }
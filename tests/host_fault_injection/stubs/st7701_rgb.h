@@ -1,6 +1,37 @@
 #pragma once
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include "esp_err.h"
 #include "esp_lcd_panel_ops.h"
 
+#define ST7701_RGB_H_RES          1024
+#define ST7701_RGB_V_RES           600
+#define ST7701_RGB_PCLK_HZ_DEFAULT (30 * 1000 * 1000)
+#define ST7701_RGB_HSYNC_PULSE_WIDTH  10
+#define ST7701_RGB_HSYNC_BACK_PORCH  160
+#define ST7701_RGB_HSYNC_FRONT_PORCH 160
+#define ST7701_RGB_VSYNC_PULSE_WIDTH   1
+#define ST7701_RGB_VSYNC_BACK_PORCH   23
+#define ST7701_RGB_VSYNC_FRONT_PORCH  12
+#define ST7701_RGB_FRAME_CLOCKS    ((uint32_t)(1024 + 10 + 160 + 160) * (600 + 1 + 23 + 12))
+
+typedef struct {
+    uint32_t pclk_hz;
+    uint8_t num_fbs;
+    size_t bounce_buffer_size_px;
+    bool defer_init;
+} st7701_rgb_config_t;
+
+#define ST7701_RGB_DEFAULT_CONFIG() {          \
+    .pclk_hz = ST7701_RGB_PCLK_HZ_DEFAULT,     \
+    .num_fbs = 1,                              \
+    .bounce_buffer_size_px = 0,                \
+    .defer_init = false,                       \
+}
+
 esp_err_t st7701_rgb_new_panel(esp_lcd_panel_handle_t *handle);
+esp_err_t st7701_rgb_new_panel_with_config(const st7701_rgb_config_t *config,
+                                           esp_lcd_panel_handle_t *handle);
+esp_err_t st7701_rgb_panel_start(esp_lcd_panel_handle_t panel);
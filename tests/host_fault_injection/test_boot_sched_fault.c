@@ -0,0 +1,184 @@
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include "boot_sched.h"
+#include "freertos/semphr.h"
+#include "mock_support.h"
+
+/* Stage behaviour: fake clock at the end of the stage, forced result. */
+typedef struct {
+    int64_t end_us;
+    esp_err_t result;
+    bool expect_lvgl_lock;
+} fake_stage_t;
+
+static char run_log[16];
+static atomic_size_t run_count;
+static char undo_log[16];
+static size_t undo_count;
+
+static esp_err_t fake_run(void *arg)
+{
+    const fake_stage_t *fake = arg;
+    if (fake->expect_lvgl_lock) {
+        assert(test_lvgl_lock_depth() == 1);
+    }
+    if (fake->end_us) {
+        test_esp_timer_set_time(fake->end_us);
+    }
+    return fake->result;
+}
+
+static fake_stage_t fakes[4];
+
+static esp_err_t logged_run(void *arg)
+{
+    size_t index = (size_t)((fake_stage_t *)arg - fakes);
+    run_log[atomic_fetch_add(&run_count, 1)] = (char)('a' + index);
+    return fake_run(arg);
+}
+
+static void logged_undo(void *arg)
+{
+    undo_log[undo_count++] = (char)('a' + ((fake_stage_t *)arg - fakes));
+}
+
+/* Two stages meeting halfway: only completes if both run at once. */
+static SemaphoreHandle_t panel_ready;
+static SemaphoreHandle_t touch_ready;
+
+static esp_err_t panel_run(void *arg)
+{
+    (void)arg;
+    xSemaphoreGive(panel_ready);
+    return xSemaphoreTake(touch_ready, pdMS_TO_TICKS(500)) == pdTRUE ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+static esp_err_t touch_run(void *arg)
+{
+    (void)arg;
+    xSemaphoreGive(touch_ready);
+    return xSemaphoreTake(panel_ready, pdMS_TO_TICKS(500)) == pdTRUE ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+static esp_err_t ok_run(void *arg)
+{
+    (void)arg;
+    return ESP_OK;
+}
+
+static void reset_logs(void)
+{
+    memset(run_log, 0, sizeof(run_log));
+    memset(undo_log, 0, sizeof(undo_log));
+    atomic_store(&run_count, 0);
+    undo_count = 0;
+}
+
+int main(void)
+{
+    test_reset_mocks();
+    boot_sched_report_t report;
+
+    /* Graph checks: a stage may only depend on earlier ones. */
+    boot_stage_t bad[] = {
+        {.name = "a", .run = ok_run},
+        {.name = "b", .run = ok_run, .deps = BOOT_STAGE_DEP(1)},
+    };
+    assert(boot_sched_validate(bad, 2) == ESP_ERR_INVALID_ARG);
+    bad[1].deps = BOOT_STAGE_DEP(2);
+    assert(boot_sched_validate(bad, 2) == ESP_ERR_INVALID_ARG);
+    bad[1].deps = BOOT_STAGE_DEP(0);
+    bad[0].run = NULL;
+    assert(boot_sched_validate(bad, 2) == ESP_ERR_INVALID_ARG);
+    bad[0].run = ok_run;
+    assert(boot_sched_validate(bad, 2) == ESP_OK);
+    assert(boot_sched_validate(bad, 0) == ESP_ERR_INVALID_ARG);
+    assert(boot_sched_validate(bad, BOOT_SCHED_MAX_STAGES + 1) == ESP_ERR_INVALID_ARG);
+    assert(boot_sched_run(bad, 2, 0, &report) == ESP_ERR_INVALID_ARG);
+    assert(boot_sched_run(bad, 2, BOOT_SCHED_MAX_WORKERS + 1, &report) == ESP_ERR_INVALID_ARG);
+
+    /*
+     * One worker: declaration order among ready stages, exact timings.
+     * a -> b, c, (b, c) -> d
+     */
+    fakes[0] = (fake_stage_t){.end_us = 10000};
+    fakes[1] = (fake_stage_t){.end_us = 130000, .expect_lvgl_lock = true};
+    fakes[2] = (fake_stage_t){.end_us = 140000};
+    fakes[3] = (fake_stage_t){.end_us = 150000};
+    boot_stage_t graph[] = {
+        {.name = "a", .run = logged_run, .undo = logged_undo, .arg = &fakes[0]},
+        {.name = "b", .run = logged_run, .undo = logged_undo, .arg = &fakes[1],
+         .deps = BOOT_STAGE_DEP(0), .lvgl_lock = true},
+        {.name = "c", .run = logged_run, .arg = &fakes[2]},
+        {.name = "d", .run = logged_run, .undo = logged_undo, .arg = &fakes[3],
+         .deps = BOOT_STAGE_DEP(1) | BOOT_STAGE_DEP(2)},
+    };
+    reset_logs();
+    test_esp_timer_set_time(0);
+    assert(boot_sched_run(graph, 4, 1, &report) == ESP_OK);
+    assert(strcmp(run_log, "abcd") == 0);
+    assert(undo_count == 0);
+    assert(test_lvgl_lock_depth() == 0 && test_lvgl_lock_count() == 1);
+    assert(report.count == 4 && report.workers == 1);
+    assert(report.stages[1].ready_us == 10000 && report.stages[1].start_us == 10000);
+    assert(report.stages[1].end_us == 130000);
+    assert(report.stages[3].ready_us == 140000 && report.stages[3].start_us == 140000);
+    for (size_t i = 0; i < 4; ++i) {
+        assert(report.stages[i].status == BOOT_STAGE_DONE && report.stages[i].worker == 0);
+    }
+    assert(report.total_us == 150000 && report.serial_us == 150000);
+    boot_sched_log_report(graph, &report);
+
+    /* Failure: nothing new starts, finished stages are undone in reverse. */
+    fakes[2].result = ESP_ERR_NOT_FOUND;
+    reset_logs();
+    test_esp_timer_set_time(0);
+    assert(boot_sched_run(graph, 4, 1, &report) == ESP_ERR_NOT_FOUND);
+    assert(strcmp(run_log, "abc") == 0);
+    assert(strcmp(undo_log, "ba") == 0);
+    assert(test_lvgl_lock_depth() == 0);
+    assert(report.stages[0].status == BOOT_STAGE_UNDONE);
+    assert(report.stages[1].status == BOOT_STAGE_UNDONE);
+    assert(report.stages[2].status == BOOT_STAGE_FAILED);
+    assert(report.stages[2].result == ESP_ERR_NOT_FOUND);
+    assert(report.stages[3].status == BOOT_STAGE_PENDING);
+    boot_sched_log_report(graph, &report);
+    fakes[2].result = ESP_OK;
+
+    /* A stage without undo stays done. */
+    fakes[3].result = ESP_FAIL;
+    reset_logs();
+    assert(boot_sched_run(graph, 4, 1, &report) == ESP_FAIL);
+    assert(strcmp(run_log, "abcd") == 0 && strcmp(undo_log, "ba") == 0);
+    assert(report.stages[2].status == BOOT_STAGE_DONE);
+    fakes[3].result = ESP_OK;
+
+    /* Two workers: stages sharing a dependency overlap. */
+    panel_ready = xSemaphoreCreateBinary();
+    touch_ready = xSemaphoreCreateBinary();
+    boot_stage_t parallel[] = {
+        {.name = "display", .run = ok_run},
+        {.name = "panel", .run = panel_run, .deps = BOOT_STAGE_DEP(0)},
+        {.name = "touch", .run = touch_run, .deps = BOOT_STAGE_DEP(0)},
+        {.name = "ui", .run = ok_run, .deps = BOOT_STAGE_DEP(1) | BOOT_STAGE_DEP(2)},
+    };
+    test_esp_timer_set_time(0);
+    assert(boot_sched_run(parallel, 4, 2, &report) == ESP_OK);
+    assert(report.workers == 2);
+    assert(report.stages[1].worker != report.stages[2].worker);
+    for (size_t i = 0; i < 4; ++i) {
+        assert(report.stages[i].status == BOOT_STAGE_DONE);
+    }
+
+    /* The same graph on a single worker cannot meet: panel times out. */
+    assert(boot_sched_run(parallel, 4, 1, &report) == ESP_ERR_TIMEOUT);
+    assert(report.stages[1].status == BOOT_STAGE_FAILED);
+    assert(report.stages[2].status == BOOT_STAGE_PENDING);
+    vSemaphoreDelete(panel_ready);
+    vSemaphoreDelete(touch_ready);
+
+    puts("Boot scheduler test passed");
+    return 0;
+}
@@ -0,0 +1,182 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "display_buf_tuner.h"
+#include "display_driver.h"
+#include "mock_support.h"
+
+/* Simulated render cost: per stripe overhead, per pixel cost by placement */
+#define BAND_US         800
+#define PSRAM_NS_PER_PX 40
+#define SRAM_NS_PER_PX  25
+
+#define MAX_LINES 150
+#define FRAMES_PER_CANDIDATE (DISPLAY_BUF_TUNER_WARMUP_FRAMES + DISPLAY_BUF_TUNER_FRAMES)
+
+static lv_color_t pool_a[MAX_LINES * DISPLAY_WIDTH];
+static lv_color_t pool_b[MAX_LINES * DISPLAY_WIDTH];
+static lv_color_t pool_c[MAX_LINES * DISPLAY_WIDTH];
+static lv_color_t pool_d[MAX_LINES * DISPLAY_WIDTH];
+
+static uint32_t scene_frames;
+
+static void scene(uint32_t frame, void *ctx)
+{
+    assert(ctx == &scene_frames);
+    assert(test_lvgl_lock_depth() > 0);
+    (void)frame;
+    ++scene_frames;
+}
+
+static size_t current_lines(void)
+{
+    return test_lvgl_buffer_size() / (DISPLAY_WIDTH * sizeof(lv_color_t));
+}
+
+static bool current_in_psram(void)
+{
+    return (test_heap_caps_of(test_lvgl_buffer(0)) & MALLOC_CAP_SPIRAM) != 0;
+}
+
+int main(void)
+{
+    display_buf_tuner_result_t best;
+    display_driver_config_t config = DISPLAY_DRIVER_DEFAULT_CONFIG();
+
+    /* Nothing to tune before the driver is up, nothing stored yet. */
+    test_reset_mocks();
+    test_nvs_reset();
+    assert(display_buf_tuner_run(NULL, NULL, &best) == ESP_ERR_INVALID_STATE);
+    assert(display_buf_tuner_run(NULL, NULL, NULL) == ESP_ERR_INVALID_ARG);
+    assert(display_buf_tuner_load(&config) == ESP_ERR_NOT_FOUND);
+    assert(config.draw_buf_lines == DISPLAY_BUF_LINES && config.draw_buf_psram);
+    assert(display_driver_set_draw_buffers(20, false) == ESP_ERR_INVALID_STATE);
+
+    /*
+     * Every candidate allocates fine: internal 40-line stripes win, the
+     * stripe overhead of shorter ones outweighs the faster SRAM.
+     */
+    void *boot_then_all[] = {
+        pool_a, pool_b,                  /* boot: 100 lines, PSRAM */
+        pool_c, pool_d, pool_a, pool_b,  /* PSRAM 150, 100 */
+        pool_c, pool_d, pool_a, pool_b,  /* PSRAM 60, 30 */
+        pool_c, pool_d, pool_a, pool_b,  /* SRAM 40, 20 */
+        pool_c, pool_d,                  /* SRAM 10 */
+        pool_a, pool_b,                  /* winner */
+    };
+    test_heap_caps_set_sequence(boot_then_all, sizeof(boot_then_all) / sizeof(boot_then_all[0]));
+    test_lvgl_set_refr_cost(BAND_US, PSRAM_NS_PER_PX, SRAM_NS_PER_PX);
+    assert(display_driver_init() == ESP_OK);
+    assert(current_lines() == DISPLAY_BUF_LINES && current_in_psram());
+
+    assert(display_driver_set_draw_buffers(0, true) == ESP_ERR_INVALID_ARG);
+    assert(display_driver_set_draw_buffers(DISPLAY_HEIGHT + 1, true) == ESP_ERR_INVALID_ARG);
+    /* Same buffers again: no reallocation */
+    assert(display_driver_set_draw_buffers(DISPLAY_BUF_LINES, true) == ESP_OK);
+    assert(test_heap_caps_active_allocations() == 2);
+
+    scene_frames = 0;
+    assert(display_buf_tuner_run(scene, &scene_frames, &best) == ESP_OK);
+    assert(best.lines == 40 && !best.psram);
+    assert(best.frame_us == 15 * BAND_US + DISPLAY_WIDTH * DISPLAY_HEIGHT * SRAM_NS_PER_PX / 1000);
+    assert(scene_frames == 7 * FRAMES_PER_CANDIDATE);
+    assert(test_lvgl_refr_count() == 7 * FRAMES_PER_CANDIDATE);
+    assert(test_lvgl_invalidate_count() == 7 * FRAMES_PER_CANDIDATE);
+    assert(test_lvgl_lock_depth() == 0);
+    /* The winner is live and every candidate buffer was released */
+    assert(current_lines() == 40 && !current_in_psram());
+    assert(test_lvgl_buffer(0) == pool_a && test_lvgl_buffer(1) == pool_b);
+    assert(test_heap_caps_active_allocations() == 2);
+    uint16_t lines = 0;
+    bool psram = true;
+    assert(display_driver_get_draw_buffers(&lines, &psram) == ESP_OK);
+    assert(lines == 40 && !psram);
+    assert(test_nvs_commit_count() == 1 && !test_nvs_is_open());
+    display_driver_deinit();
+
+    /* Next boot: the stored choice is used straight away. */
+    test_reset_mocks();
+    config = (display_driver_config_t)DISPLAY_DRIVER_DEFAULT_CONFIG();
+    assert(display_buf_tuner_load(&config) == ESP_OK);
+    assert(config.draw_buf_lines == 40 && !config.draw_buf_psram);
+    void *boot[] = {pool_a, pool_b};
+    test_heap_caps_set_sequence(boot, 2);
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    assert(current_lines() == 40 && !current_in_psram());
+    assert(test_heap_caps_last_caps() == (MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA));
+    display_driver_deinit();
+
+    /* Stored choice no longer fits at boot: default PSRAM buffers instead. */
+    test_reset_mocks();
+    void *sram_short[] = {NULL, NULL, pool_a, pool_b};
+    test_heap_caps_set_sequence(sram_short, 4);
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    assert(current_lines() == DISPLAY_BUF_LINES && current_in_psram());
+    assert(test_heap_caps_active_allocations() == 2);
+    display_driver_deinit();
+
+    /*
+     * Internal SRAM exhausted during calibration (async flush): SRAM
+     * candidates are skipped, the fastest PSRAM one is kept and stored.
+     */
+    test_reset_mocks();
+    config = (display_driver_config_t)DISPLAY_DRIVER_DEFAULT_CONFIG();
+    config.async_flush = true;
+    void *no_sram[] = {
+        pool_a, pool_b,
+        pool_c, pool_d, pool_a, pool_b,
+        pool_c, pool_d, pool_a, pool_b,
+        NULL, NULL, NULL, NULL, NULL, NULL,
+        pool_c, pool_d,
+    };
+    test_heap_caps_set_sequence(no_sram, sizeof(no_sram) / sizeof(no_sram[0]));
+    test_lvgl_set_refr_cost(BAND_US, PSRAM_NS_PER_PX, SRAM_NS_PER_PX);
+    test_panel_set_completion_delay_us(200);
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    scene_frames = 0;
+    assert(display_buf_tuner_run(scene, &scene_frames, &best) == ESP_OK);
+    assert(best.lines == 150 && best.psram);
+    assert(scene_frames == 4 * FRAMES_PER_CANDIDATE);
+    assert(current_lines() == 150 && current_in_psram());
+    assert(test_heap_caps_active_allocations() == 2);
+    /* Every flush of the last frame completed before the buffers were swapped */
+    assert(test_lvgl_flush_ready_count() == test_panel_draw_calls());
+    display_driver_deinit();
+
+    config = (display_driver_config_t)DISPLAY_DRIVER_DEFAULT_CONFIG();
+    assert(display_buf_tuner_load(&config) == ESP_OK);
+    assert(config.draw_buf_lines == 150 && config.draw_buf_psram);
+
+    /* Only the boot buffers fit: they are kept and stored as the winner. */
+    test_reset_mocks();
+    void *boot_only[] = {pool_a, pool_b};
+    test_heap_caps_set_sequence(boot_only, 2);
+    assert(display_driver_init() == ESP_OK);
+    size_t commits = test_nvs_commit_count();
+    /* The boot configuration is also a candidate and needs no allocation */
+    assert(display_buf_tuner_run(NULL, NULL, &best) == ESP_OK);
+    assert(best.lines == DISPLAY_BUF_LINES && best.psram);
+    assert(test_lvgl_buffer(0) == pool_a && test_lvgl_buffer(1) == pool_b);
+    assert(test_nvs_commit_count() == commits + 1);
+    display_driver_deinit();
+
+    /* Erased or stale records are ignored. */
+    assert(display_buf_tuner_erase() == ESP_OK);
+    config = (display_driver_config_t)DISPLAY_DRIVER_DEFAULT_CONFIG();
+    assert(display_buf_tuner_load(&config) == ESP_ERR_NOT_FOUND);
+    assert(display_buf_tuner_erase() == ESP_OK);
+    const struct {
+        uint8_t version;
+        uint8_t psram;
+        uint16_t lines;
+        uint32_t frame_us;
+    } stale = {DISPLAY_BUF_TUNER_RECORD_VERSION + 1, 0, 20, 1000};
+    assert(test_nvs_write_blob(DISPLAY_BUF_TUNER_NVS_NAMESPACE, DISPLAY_BUF_TUNER_NVS_KEY,
+                               &stale, sizeof(stale)) == ESP_OK);
+    assert(display_buf_tuner_load(&config) == ESP_ERR_NOT_FOUND);
+    assert(config.draw_buf_lines == DISPLAY_BUF_LINES && config.draw_buf_psram);
+
+    puts("Draw buffer tuner test passed");
+    return 0;
+}
@@ -1,7 +1,11 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <unistd.h>
 #include "display_driver.h"
+#include "esp_cache.h"
+#include "esp_timer.h"
+#include "lvgl_private.h"
 #include "mock_support.h"
 
 int main(void)
@@ -41,6 +45,254 @@ int main(void)
     assert(test_panel_disp_off_called());
     assert(test_panel_del_called());
 
+    /* Bounce buffer height must divide the panel height. */
+    test_reset_mocks();
+    display_driver_config_t config = DISPLAY_DRIVER_DEFAULT_CONFIG();
+    config.bounce_buffer_lines = 7;
+    assert(display_driver_init_with_config(&config) == ESP_ERR_INVALID_ARG);
+    assert(test_panel_num_fbs() == 0);
+
+    static lv_color_t draw_buf1[DISPLAY_BUF_SIZE];
+    static lv_color_t draw_buf2[DISPLAY_BUF_SIZE];
+    void *psram_bufs[] = {draw_buf1, draw_buf2};
+    test_heap_caps_set_sequence(psram_bufs, 2);
+    config.bounce_buffer_lines = 10;
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    assert(test_panel_bounce_buffer_px() == 10 * DISPLAY_WIDTH);
+
+    /* Budget: 30 MHz x 16 bpp scan-out plus render traffic over one second. */
+    const lv_area_t band = {0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT / 4 - 1};
+    test_lvgl_flush_cb()(NULL, &band, (uint8_t *)draw_buf1);
+    test_esp_timer_set_time(1000000);
+    psram_budget_t budget;
+    assert(display_driver_get_psram_budget(&budget) == ESP_OK);
+    const uint64_t band_bytes = (uint64_t)DISPLAY_WIDTH * (DISPLAY_HEIGHT / 4) * 2;
+    assert(budget.scanout_bps == 60000000ull);
+    /* Draw buffers in PSRAM: render write + read back + framebuffer write. */
+    assert(budget.render_bps == 3 * band_bytes);
+    assert(budget.headroom_bps == (int64_t)budget.budget_bps - 60000000ll - (int64_t)(3 * band_bytes));
+    display_driver_deinit();
+    assert(display_driver_get_psram_budget(&budget) == ESP_ERR_INVALID_STATE);
+
+    /* Async flush: LVGL is released by on_color_trans_done, even when late. */
+    test_reset_mocks();
+    test_heap_caps_set_sequence(psram_bufs, 2);
+    config = (display_driver_config_t)DISPLAY_DRIVER_DEFAULT_CONFIG();
+    config.async_flush = true;
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    assert(test_lvgl_has_flush_wait_cb());
+    test_panel_set_completion_delay_us(50000);
+    test_lvgl_flush(&band, (uint8_t *)draw_buf1);
+    assert(test_lvgl_flush_ready_count() == 0);
+    /* The second flush must wait for the first completion. */
+    test_lvgl_flush(&band, (uint8_t *)draw_buf2);
+    assert(test_lvgl_flush_ready_count() >= 1);
+    test_lvgl_wait_flushing();
+    assert(test_lvgl_flush_ready_count() == 2);
+    /* The completion callback does not call into LVGL: the waiter releases the flush. */
+    test_lvgl_flush(&band, (uint8_t *)draw_buf1);
+    usleep(80 * 1000);
+    assert(test_lvgl_flush_ready_count() == 2);
+    test_lvgl_wait_flushing();
+    assert(test_lvgl_flush_ready_count() == 3);
+    assert(test_panel_draw_calls() == 3);
+
+    /*
+     * A completion later than the wait timeout: LVGL moves on, and the late
+     * completion must not release the flush submitted after it.
+     */
+    test_panel_set_completion_delay_us((DISPLAY_FLUSH_TIMEOUT_MS + 50) * 1000);
+    test_lvgl_flush(&band, (uint8_t *)draw_buf1);
+    test_lvgl_flush(&band, (uint8_t *)draw_buf2);
+    assert(test_lvgl_flush_ready_count() == 3);
+    usleep(80 * 1000);
+    assert(test_lvgl_flush_ready_count() == 3);
+    test_lvgl_wait_flushing();
+    assert(test_lvgl_flush_ready_count() == 4);
+    display_driver_deinit();
+
+    /* Sync flush: flush-ready is signalled before the callback returns. */
+    test_reset_mocks();
+    test_heap_caps_set_sequence(psram_bufs, 2);
+    config.async_flush = false;
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    assert(!test_lvgl_has_flush_wait_cb());
+    test_lvgl_flush(&band, (uint8_t *)draw_buf1);
+    assert(test_lvgl_flush_ready_count() == 1);
+    display_driver_deinit();
+
+    /* Scanline sync: a copy the beam would cross waits for it to pass. */
+    test_reset_mocks();
+    test_heap_caps_set_sequence(psram_bufs, 2);
+    config.scanline_sync = true;
+    test_panel_set_manual_vsync(true);
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    display_scanline_stats_t stats;
+    assert(display_driver_get_scanline_stats(&stats) == ESP_OK);
+    assert(stats.frame_us == 28704 && stats.copy_ns_per_px == DISPLAY_SCANLINE_COPY_NS_PER_PX);
+    const lv_area_t top = {0, 0, DISPLAY_WIDTH - 1, 149};
+    /* No VSYNC seen yet: copied at once */
+    test_lvgl_flush(&top, (uint8_t *)draw_buf1);
+    assert(test_rom_delay_calls() == 0);
+    /* Beam on line 140 (24 blanking lines, 45.133 us per line) */
+    const int64_t vsync_us = 1000000;
+    test_esp_timer_set_time(vsync_us);
+    assert(test_panel_fire_vsync());
+    test_esp_timer_set_time(vsync_us + (24 + 140) * 45133 / 1000);
+    test_lvgl_flush(&top, (uint8_t *)draw_buf1);
+    assert(test_lvgl_flush_ready_count() == 2 && test_panel_draw_calls() == 2);
+    int64_t line = (esp_timer_get_time() - vsync_us) * 1000 / 45133 - 24;
+    assert(line >= 149 + DISPLAY_SCANLINE_GUARD_LINES && line < 149 + DISPLAY_SCANLINE_GUARD_LINES + 2);
+    /* Beam already below the area: no delay */
+    test_esp_timer_set_time(2 * vsync_us);
+    assert(test_panel_fire_vsync());
+    test_esp_timer_set_time(2 * vsync_us + (24 + 200) * 45133 / 1000);
+    test_lvgl_flush(&top, (uint8_t *)draw_buf1);
+    assert(esp_timer_get_time() == 2 * vsync_us + (24 + 200) * 45133 / 1000);
+    assert(display_driver_get_scanline_stats(&stats) == ESP_OK);
+    assert(stats.areas == 3 && stats.delayed == 1 && stats.unavoidable == 0 && stats.frames == 3);
+    assert(stats.total_wait_us > 0 && stats.max_frame_wait_us == stats.total_wait_us);
+    assert(stats.mean_frame_wait_us == stats.total_wait_us / 3);
+    display_driver_reset_scanline_stats();
+    assert(display_driver_get_scanline_stats(&stats) == ESP_OK && stats.areas == 0);
+    display_driver_deinit();
+    assert(display_driver_get_scanline_stats(&stats) == ESP_ERR_INVALID_STATE);
+
+    /* Direct mode swaps on VSYNC already: the option is ignored. */
+    test_reset_mocks();
+    config.render_mode = DISPLAY_RENDER_MODE_DIRECT;
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    assert(display_driver_get_scanline_stats(&stats) == ESP_ERR_INVALID_STATE);
+    display_driver_deinit();
+    config.render_mode = DISPLAY_RENDER_MODE_PARTIAL;
+    config.scanline_sync = false;
+
+    /* Deferred start: LVGL display ready, panel dark until started. */
+    test_reset_mocks();
+    assert(display_driver_start_panel() == ESP_ERR_INVALID_STATE);
+    test_heap_caps_set_sequence(psram_bufs, 2);
+    config.defer_panel_start = true;
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    assert(test_lvgl_display() != NULL);
+    assert(!test_panel_started() && test_backlight_call_count() == 0);
+    assert(display_driver_start_panel() == ESP_OK);
+    assert(test_panel_started() && test_panel_start_calls() == 1);
+    assert(test_backlight_last_level());
+    display_driver_deinit();
+    config.defer_panel_start = false;
+
+    /* Area merge at render start: footer labels join, the last slot stays last. */
+    test_reset_mocks();
+    test_heap_caps_set_sequence(psram_bufs, 2);
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    lv_display_t *disp = test_lvgl_display();
+    const lv_area_t clock = {839, 28, 893, 51};
+    const lv_area_t datetime = {602, 564, 756, 579};
+    const lv_area_t sysinfo = {776, 564, 1013, 579};
+    disp->inv_areas[0] = clock;
+    disp->inv_areas[2] = datetime;
+    disp->inv_areas[3] = sysinfo;
+    disp->inv_area_joined[1] = 1;
+    disp->inv_area_joined[4] = 1;
+    disp->inv_p = 5;
+    test_lvgl_render_start();
+    assert(!disp->inv_area_joined[0] && !disp->inv_area_joined[3]);
+    assert(disp->inv_area_joined[1] && disp->inv_area_joined[2] && disp->inv_area_joined[4]);
+    assert(disp->inv_areas[0].x1 == clock.x1 && disp->inv_areas[0].y2 == clock.y2);
+    assert(disp->inv_areas[3].x1 == datetime.x1 && disp->inv_areas[3].x2 == sysinfo.x2 &&
+           disp->inv_areas[3].y1 == 564 && disp->inv_areas[3].y2 == 579);
+    display_driver_deinit();
+
+    /* A zero call cost disables the stage. */
+    test_reset_mocks();
+    test_heap_caps_set_sequence(psram_bufs, 2);
+    config.area_merge_call_cost_px = 0;
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    disp = test_lvgl_display();
+    disp->inv_areas[0] = datetime;
+    disp->inv_areas[1] = sysinfo;
+    disp->inv_p = 2;
+    test_lvgl_render_start();
+    assert(!disp->inv_area_joined[0] && !disp->inv_area_joined[1]);
+    assert(disp->inv_areas[1].x1 == sysinfo.x1);
+    display_driver_deinit();
+    config.area_merge_call_cost_px = DISPLAY_AREA_MERGE_CALL_COST_PX;
+
+    /* GDMA path: full-width stripes in internal SRAM copied into the framebuffer. */
+    test_reset_mocks();
+    static lv_color_t stripe1[20 * DISPLAY_WIDTH];
+    static lv_color_t stripe2[20 * DISPLAY_WIDTH];
+    void *stripes[] = {stripe1, stripe2};
+    test_heap_caps_set_sequence(stripes, 2);
+    config = (display_driver_config_t)DISPLAY_DRIVER_DEFAULT_CONFIG();
+    config.render_mode = DISPLAY_RENDER_MODE_PARTIAL_DMA;
+    config.async_flush = true;
+    config.dma_stripe_lines = 20;
+    config.bounce_buffer_lines = 0;
+    assert(display_driver_init_with_config(&config) == ESP_OK);
+    assert(test_dma_installed());
+    assert(test_dma_burst_size() == DISPLAY_DMA_BURST_BYTES);
+    assert(test_heap_caps_last_caps() == (MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA));
+    assert(test_lvgl_buffer(0) == (void *)stripe1);
+    assert(test_lvgl_buffer_size() == sizeof(stripe1));
+
+    /* Invalidated areas are widened to the full screen width. */
+    lv_area_t dirty = {874, 28, 929, 51};
+    test_lvgl_invalidate(&dirty);
+    assert(dirty.x1 == 0 && dirty.x2 == DISPLAY_WIDTH - 1 && dirty.y1 == 28 && dirty.y2 == 51);
+
+    /* Stripe N+1 is rendered while stripe N is still in flight. */
+    test_dma_set_delay_us(30000);
+    for (size_t i = 0; i < sizeof(stripe1) / sizeof(stripe1[0]); ++i) {
+        stripe1[i] = 0x1234;
+    }
+    const lv_area_t s1 = {0, 40, DISPLAY_WIDTH - 1, 59};
+    test_lvgl_flush(&s1, (uint8_t *)stripe1);
+    assert(test_lvgl_flush_ready_count() == 0);
+    for (size_t i = 0; i < sizeof(stripe2) / sizeof(stripe2[0]); ++i) {
+        stripe2[i] = 0xabcd;
+    }
+    const lv_area_t s2 = {0, 60, DISPLAY_WIDTH - 1, 79};
+    test_lvgl_flush(&s2, (uint8_t *)stripe2);
+    test_lvgl_wait_flushing();
+    assert(test_lvgl_flush_ready_count() == 2);
+    assert(test_dma_copy_count() == 2);
+    assert(test_dma_bytes() == 2 * sizeof(stripe1));
+    assert(test_panel_draw_calls() == 0);
+
+    /* Destination lines are written back and invalidated, cache-line aligned. */
+    assert(test_cache_msync_count() == 2);
+    assert(test_cache_msync_error_count() == 0);
+    assert(test_cache_msync_last_flags() == (ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_INVALIDATE));
+    const uint16_t *fb = test_panel_frame_buffer();
+    assert(fb[39 * DISPLAY_WIDTH + DISPLAY_WIDTH - 1] == 0);
+    assert(fb[40 * DISPLAY_WIDTH] == 0x1234);
+    assert(fb[59 * DISPLAY_WIDTH + DISPLAY_WIDTH - 1] == 0x1234);
+    assert(fb[60 * DISPLAY_WIDTH] == 0xabcd);
+    assert(fb[79 * DISPLAY_WIDTH + DISPLAY_WIDTH - 1] == 0xabcd);
+
+    /* A rejected DMA request falls back to a CPU copy and releases LVGL. */
+    test_dma_set_fail(true);
+    test_lvgl_flush(&s1, (uint8_t *)stripe1);
+    test_lvgl_wait_flushing();
+    assert(test_lvgl_flush_ready_count() == 3);
+    assert(test_panel_draw_calls() == 1);
+
+    /* A source the GDMA cannot read is copied by the CPU, without DMA request. */
+    test_dma_set_fail(false);
+    test_lvgl_flush(&s1, (uint8_t *)stripe1 + 2);
+    test_lvgl_wait_flushing();
+    assert(test_lvgl_flush_ready_count() == 4);
+    assert(test_panel_draw_calls() == 2);
+    assert(test_dma_copy_count() == 2 && test_cache_msync_count() == 3);
+    display_driver_deinit();
+    assert(!test_dma_installed());
+
+    /* Bounce buffers read the framebuffer through the cache: rejected. */
+    test_reset_mocks();
+    config.bounce_buffer_lines = 10;
+    assert(display_driver_init_with_config(&config) == ESP_ERR_INVALID_ARG);
+
     puts("Fault injection test passed");
     return 0;
 }
@@ -0,0 +1,156 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "display_driver.h"
+#include "display_governor.h"
+#include "mock_support.h"
+#include "st7701_rgb.h"
+
+#define IDLE_PCLK_HZ (20 * 1000 * 1000)
+
+/* The governor decides at the start of each refresh cycle */
+static void refresh(void)
+{
+    test_lvgl_refr_start();
+}
+
+int main(void)
+{
+    /* Pure decision: any activity wins, idle only past the threshold. */
+    assert(display_governor_decide(0, 0, 3000) == DISPLAY_GOVERNOR_ACTIVE);
+    assert(display_governor_decide(2999, 0, 3000) == DISPLAY_GOVERNOR_ACTIVE);
+    assert(display_governor_decide(3000, 0, 3000) == DISPLAY_GOVERNOR_IDLE);
+    assert(display_governor_decide(600000, 1, 3000) == DISPLAY_GOVERNOR_ACTIVE);
+
+    display_governor_state_t state;
+    test_reset_mocks();
+    assert(display_governor_get_state(&state) == ESP_ERR_INVALID_STATE);
+    /* No display yet */
+    assert(display_governor_start(NULL) == ESP_ERR_INVALID_STATE);
+    assert(display_driver_set_pclk(IDLE_PCLK_HZ) == ESP_ERR_INVALID_STATE);
+
+    static lv_color_t draw_buf1[DISPLAY_BUF_SIZE];
+    static lv_color_t draw_buf2[DISPLAY_BUF_SIZE];
+    void *bufs[] = {draw_buf1, draw_buf2};
+    test_heap_caps_set_sequence(bufs, 2);
+    assert(display_driver_init() == ESP_OK);
+    assert(display_driver_get_pclk() == ST7701_RGB_PCLK_HZ_DEFAULT);
+
+    /* Pixel clock bounds: never above nominal, never under the VSYNC timeout. */
+    assert(display_driver_set_pclk(DISPLAY_PCLK_MIN_HZ - 1) == ESP_ERR_INVALID_ARG);
+    assert(display_driver_set_pclk(ST7701_RGB_PCLK_HZ_DEFAULT + 1) == ESP_ERR_INVALID_ARG);
+    assert((uint64_t)ST7701_RGB_FRAME_CLOCKS * 1000 / DISPLAY_PCLK_MIN_HZ < DISPLAY_FLUSH_TIMEOUT_MS);
+    assert(display_driver_set_pclk(ST7701_RGB_PCLK_HZ_DEFAULT) == ESP_OK);
+    assert(test_panel_pclk_changes() == 0);
+
+    display_governor_config_t config = DISPLAY_GOVERNOR_DEFAULT_CONFIG();
+    config.idle_pclk_hz = DISPLAY_PCLK_MIN_HZ - 1;
+    assert(display_governor_start(&config) == ESP_ERR_INVALID_ARG);
+    config.idle_pclk_hz = 0;
+    config.idle_refr_ms = 0;
+    assert(display_governor_start(&config) == ESP_ERR_INVALID_ARG);
+
+    /* Refresh period only: the pixel clock is left alone. */
+    config = (display_governor_config_t)DISPLAY_GOVERNOR_DEFAULT_CONFIG();
+    assert(config.idle_pclk_hz == 0);
+    test_esp_timer_set_time(1000000);
+    assert(display_governor_start(&config) == ESP_OK);
+    assert(display_governor_start(&config) == ESP_ERR_INVALID_STATE);
+    assert(test_lvgl_lock_depth() == 0);
+    /* No timer of its own: LVGL may sleep until its next due timer */
+    assert(!test_lvgl_app_timer_created());
+    assert(display_governor_get_state(&state) == ESP_OK);
+    assert(state.level == DISPLAY_GOVERNOR_ACTIVE && state.refr_period_ms == 16);
+    assert(state.pclk_hz == ST7701_RGB_PCLK_HZ_DEFAULT && state.transitions == 0);
+
+    test_lvgl_set_inactive_time(config.idle_after_ms - 1);
+    refresh();
+    assert(lv_timer_get_period(test_lvgl_refr_timer()) == 16);
+    test_lvgl_set_inactive_time(config.idle_after_ms);
+    test_esp_timer_set_time(4000000);
+    refresh();
+    assert(lv_timer_get_period(test_lvgl_refr_timer()) == config.idle_refr_ms);
+    assert(test_panel_pclk_changes() == 0);
+    assert(display_governor_get_state(&state) == ESP_OK);
+    assert(state.level == DISPLAY_GOVERNOR_IDLE && state.transitions == 1);
+    assert(state.residency_us[DISPLAY_GOVERNOR_ACTIVE] == 3000000);
+    assert(state.residency_us[DISPLAY_GOVERNOR_IDLE] == 0);
+
+    /* A touch wakes it up and the pending frame is rendered at once. */
+    test_lvgl_set_inactive_time(0);
+    test_esp_timer_set_time(9000000);
+    display_governor_notify_activity();
+    assert(lv_timer_get_period(test_lvgl_refr_timer()) == 16);
+    assert(test_lvgl_refr_timer_take_ready());
+    assert(display_governor_get_state(&state) == ESP_OK);
+    assert(state.level == DISPLAY_GOVERNOR_ACTIVE && state.transitions == 2);
+    assert(state.residency_us[DISPLAY_GOVERNOR_IDLE] == 5000000);
+
+    /* Scroll momentum or animations keep the nominal rate without input. */
+    test_lvgl_set_inactive_time(60000);
+    test_lvgl_set_running_anims(1);
+    refresh();
+    assert(display_governor_get_state(&state) == ESP_OK);
+    assert(state.level == DISPLAY_GOVERNOR_ACTIVE && state.transitions == 2);
+    test_lvgl_set_running_anims(0);
+    refresh();
+    assert(lv_timer_get_period(test_lvgl_refr_timer()) == config.idle_refr_ms);
+    /* Refreshing again while idle changes nothing */
+    refresh();
+    assert(display_governor_get_state(&state) == ESP_OK);
+    assert(state.transitions == 3);
+
+    /* A second wake-up signal while active is not a transition */
+    test_lvgl_set_inactive_time(0);
+    display_governor_notify_activity();
+    display_governor_notify_activity();
+    assert(display_governor_get_state(&state) == ESP_OK);
+    assert(state.level == DISPLAY_GOVERNOR_ACTIVE && state.transitions == 4);
+    test_lvgl_set_inactive_time(config.idle_after_ms);
+    refresh();
+    assert(lv_timer_get_period(test_lvgl_refr_timer()) == config.idle_refr_ms);
+
+    /* Stopping restores the nominal period and unhooks the refresh cycle. */
+    display_governor_stop();
+    refresh();
+    assert(lv_timer_get_period(test_lvgl_refr_timer()) == 16);
+    assert(display_governor_get_state(&state) == ESP_ERR_INVALID_STATE);
+    assert(test_lvgl_lock_depth() == 0);
+
+    /*
+     * With pixel clock lowering: the clock drops after the refresh period
+     * going idle, and comes back before it on wake-up.
+     */
+    config.idle_pclk_hz = IDLE_PCLK_HZ;
+    test_lvgl_set_inactive_time(0);
+    assert(display_governor_start(&config) == ESP_OK);
+    test_lvgl_set_inactive_time(config.idle_after_ms);
+    refresh();
+    assert(test_panel_pclk_hz() == IDLE_PCLK_HZ);
+    assert(display_driver_get_pclk() == IDLE_PCLK_HZ);
+    assert(test_panel_pclk_seq() > test_lvgl_refr_period_seq());
+    assert(display_governor_get_state(&state) == ESP_OK);
+    assert(state.pclk_hz == IDLE_PCLK_HZ);
+
+    /* The PSRAM budget follows the scan-out clock */
+    psram_budget_t budget;
+    assert(display_driver_get_psram_budget(&budget) == ESP_OK);
+    assert(budget.scanout_bps == (uint64_t)IDLE_PCLK_HZ * 2);
+
+    test_lvgl_set_inactive_time(5);
+    refresh();
+    assert(test_panel_pclk_hz() == ST7701_RGB_PCLK_HZ_DEFAULT);
+    assert(test_panel_pclk_seq() < test_lvgl_refr_period_seq());
+    assert(test_panel_pclk_changes() == 2);
+
+    /* Stopping while idle brings both back */
+    test_lvgl_set_inactive_time(config.idle_after_ms);
+    refresh();
+    display_governor_stop();
+    assert(test_panel_pclk_hz() == ST7701_RGB_PCLK_HZ_DEFAULT);
+    assert(lv_timer_get_period(test_lvgl_refr_timer()) == 16);
+    display_driver_deinit();
+
+    puts("Display governor test passed");
+    return 0;
+}
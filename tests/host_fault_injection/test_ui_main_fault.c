@@ -22,6 +22,32 @@ int main(void)
     assert(ui->content_container == NULL);
     assert(ui->footer_container == NULL);
 
+    /* Locking model: screen changes run under the LVGL lock, even on failure. */
+    test_reset_mocks();
+    assert(ui_main_init() == ESP_OK);
+    assert(test_lvgl_lock_depth() == 0);
+    size_t locks = test_lvgl_lock_count();
+    assert(ui_main_set_screen(SCREEN_REPTILES) == ESP_OK);
+    assert(test_ui_content_loaded_locked());
+    assert(test_lvgl_lock_count() > locks);
+    assert(test_lvgl_lock_depth() == 0);
+
+    test_ui_set_content_load_result(ESP_FAIL);
+    assert(ui_main_set_screen(SCREEN_ALERTS) == ESP_FAIL);
+    assert(test_lvgl_lock_depth() == 0);
+    test_ui_set_content_load_result(ESP_OK);
+
+    locks = test_lvgl_lock_count();
+    assert(ui_main_set_screen(SCREEN_COUNT) == ESP_ERR_INVALID_ARG);
+    assert(test_lvgl_lock_count() == locks);
+
+    assert(ui_main_reload_data() == ESP_OK);
+    assert(test_ui_content_loaded_locked());
+    assert(test_lvgl_lock_depth() == 0);
+    ui_main_update_realtime_data();
+    assert(test_lvgl_lock_depth() == 0);
+    ui_main_deinit();
+
     puts("UI main fault injection test passed");
     return 0;
 }
@@ -0,0 +1,167 @@
+#include <assert.h>
+#include <stdio.h>
+#include "esp_heap_caps.h"
+#include "ui_static_layer.h"
+#include "mock_support.h"
+
+#define REGION_W 64
+#define REGION_H 8
+#define SHADOW   2
+#define SNAPSHOT_BYTES ((REGION_W + 2 * SHADOW) * 2 * (REGION_H + 2 * SHADOW))
+
+static uint8_t pixels_a[4 * SNAPSHOT_BYTES];
+static uint8_t pixels_b[4 * SNAPSHOT_BYTES];
+static uint8_t pixels_c[4 * SNAPSHOT_BYTES];
+
+static ui_static_layer_stats_t stats_of(ui_static_layer_id_t id)
+{
+    ui_static_layer_stats_t stats;
+    assert(ui_static_layer_get_stats(id, &stats) == ESP_OK);
+    return stats;
+}
+
+int main(void)
+{
+    test_reset_mocks();
+    lv_obj_t *screen = lv_obj_create(NULL);
+    lv_obj_t *header = lv_obj_create(screen);
+    lv_obj_t *title = lv_obj_create(header);
+    lv_obj_t *clock = lv_obj_create(header);
+    lv_obj_t *button = lv_obj_create(header);
+    lv_obj_t *footer = lv_obj_create(screen);
+    lv_obj_t *wifi = lv_obj_create(footer);
+    lv_obj_t *wifi_icon = lv_obj_create(wifi);
+    lv_obj_t *wifi_text = lv_obj_create(wifi);
+    lv_obj_t *version = lv_obj_create(footer);
+    test_lvgl_obj_set_size(header, REGION_W, REGION_H, SHADOW);
+    test_lvgl_obj_set_size(footer, REGION_W, REGION_H, SHADOW);
+
+    /* Needs a display to hook the refresh start. */
+    assert(ui_static_layer_attach(UI_STATIC_LAYER_HEADER, header) == ESP_ERR_INVALID_STATE);
+    assert(lv_display_create(1024, 600) != NULL);
+    assert(ui_static_layer_attach(UI_STATIC_LAYER_COUNT, header) == ESP_ERR_INVALID_ARG);
+    assert(ui_static_layer_attach(UI_STATIC_LAYER_HEADER, NULL) == ESP_ERR_INVALID_ARG);
+    assert(ui_static_layer_attach(UI_STATIC_LAYER_HEADER, header) == ESP_OK);
+    assert(ui_static_layer_attach(UI_STATIC_LAYER_HEADER, header) == ESP_ERR_INVALID_STATE);
+    assert(ui_static_layer_attach(UI_STATIC_LAYER_FOOTER, footer) == ESP_OK);
+
+    ui_static_layer_stats_t stats;
+    assert(ui_static_layer_get_stats(UI_STATIC_LAYER_SIDEBAR, &stats) == ESP_ERR_INVALID_STATE);
+    assert(ui_static_layer_set_dynamic(NULL, true) == ESP_ERR_INVALID_ARG);
+    assert(ui_static_layer_set_dynamic(screen, true) == ESP_ERR_NOT_FOUND);
+    assert(ui_static_layer_set_dynamic(header, true) == ESP_ERR_NOT_FOUND);
+    assert(ui_static_layer_set_dynamic(clock, true) == ESP_OK);
+    assert(ui_static_layer_set_dynamic(clock, true) == ESP_OK);
+    /* A nested dynamic widget keeps its whole top-level group live */
+    assert(ui_static_layer_set_dynamic(wifi_icon, true) == ESP_OK);
+    assert(!stats_of(UI_STATIC_LAYER_HEADER).cached);
+    assert(test_lvgl_lock_depth() == 0);
+
+    /* First refresh: one PSRAM snapshot per region, dynamic widgets left out. */
+    void *bufs[] = {pixels_a, pixels_b};
+    test_heap_caps_set_sequence(bufs, 2);
+    test_lvgl_refr_start();
+    assert(test_lvgl_snapshot_count() == 2);
+    assert(test_heap_caps_active_allocations() == 2);
+    assert(test_heap_caps_last_caps() == MALLOC_CAP_SPIRAM);
+    assert(header->bg_image_src != NULL && footer->bg_image_src != NULL);
+    const lv_draw_buf_t *snapshot = header->bg_image_src;
+    assert(snapshot->data == (uint8_t *)pixels_a);
+    assert(snapshot->header.w == REGION_W + 2 * SHADOW);
+    assert(snapshot->header.h == REGION_H + 2 * SHADOW);
+
+    stats = stats_of(UI_STATIC_LAYER_HEADER);
+    assert(stats.cached && stats.builds == 1);
+    assert(stats.cached_children == 2 && stats.live_children == 1);
+    assert(stats.bytes == SNAPSHOT_BYTES);
+    stats = stats_of(UI_STATIC_LAYER_FOOTER);
+    assert(stats.cached_children == 1 && stats.live_children == 1);
+
+    /* Static widgets are skipped by the renderer, dynamic ones drawn on top */
+    assert(!test_lvgl_obj_drawn(title) && !test_lvgl_obj_drawn(button));
+    assert(test_lvgl_obj_drawn(clock));
+    assert(test_lvgl_obj_drawn(wifi_icon) && test_lvgl_obj_drawn(wifi_text));
+    assert(!test_lvgl_obj_drawn(version));
+
+    /* Nothing stale: later frames reuse the snapshots. */
+    test_lvgl_refr_start();
+    assert(test_lvgl_snapshot_count() == 2);
+
+    /* The pressed button goes live at once, the header is retaken in place. */
+    assert(ui_static_layer_set_dynamic(button, true) == ESP_OK);
+    assert(test_lvgl_obj_drawn(button));
+    size_t drops = test_lvgl_image_cache_drops();
+    test_lvgl_refr_start();
+    assert(test_lvgl_snapshot_count() == 3);
+    assert(!test_lvgl_obj_in_last_snapshot(button) && test_lvgl_obj_in_last_snapshot(title));
+    assert(test_lvgl_image_cache_drops() == drops + 1);
+    assert(test_heap_caps_active_allocations() == 2);
+    assert(stats_of(UI_STATIC_LAYER_HEADER).builds == 2);
+
+    assert(ui_static_layer_set_dynamic(button, false) == ESP_OK);
+    test_lvgl_refr_start();
+    assert(test_lvgl_obj_in_last_snapshot(button) && !test_lvgl_obj_drawn(button));
+
+    /* Data or theme reload: every region is retaken on the next refresh. */
+    ui_static_layer_invalidate_all();
+    test_lvgl_refr_start();
+    assert(test_lvgl_snapshot_count() == 6);
+
+    /* A taller region needs a new buffer, the old one is released. */
+    test_lvgl_obj_set_size(header, REGION_W, 4 * REGION_H, SHADOW);
+    void *bigger[] = {pixels_c};
+    test_heap_caps_set_sequence(bigger, 1);
+    ui_static_layer_invalidate(UI_STATIC_LAYER_HEADER);
+    test_lvgl_refr_start();
+    assert(test_heap_caps_pointer_freed(pixels_a));
+    assert(((const lv_draw_buf_t *)header->bg_image_src)->data == (uint8_t *)pixels_c);
+    assert(test_heap_caps_active_allocations() == 2);
+
+    /* Snapshot failure: the region is rendered normally again. */
+    test_lvgl_set_snapshot_fail(true);
+    ui_static_layer_invalidate(UI_STATIC_LAYER_HEADER);
+    test_lvgl_refr_start();
+    stats = stats_of(UI_STATIC_LAYER_HEADER);
+    assert(!stats.cached && stats.live_children == 3);
+    assert(header->bg_image_src == NULL);
+    assert(test_lvgl_obj_drawn(title) && test_lvgl_obj_drawn(button));
+    test_lvgl_set_snapshot_fail(false);
+
+    /* PSRAM exhausted for a larger snapshot: same fallback. */
+    test_lvgl_obj_set_size(header, REGION_W, 16 * REGION_H, SHADOW);
+    test_heap_caps_set_sequence(NULL, 0);
+    ui_static_layer_invalidate(UI_STATIC_LAYER_HEADER);
+    test_lvgl_refr_start();
+    assert(!stats_of(UI_STATIC_LAYER_HEADER).cached);
+    assert(stats_of(UI_STATIC_LAYER_HEADER).bytes == 0);
+    assert(test_lvgl_obj_drawn(title));
+    assert(test_heap_caps_active_allocations() == 1);
+
+    /* Children about to be deleted are forgotten. */
+    ui_static_layer_reset(UI_STATIC_LAYER_FOOTER);
+    test_lvgl_refr_start();
+    assert(!test_lvgl_obj_drawn(wifi_icon));
+    assert(stats_of(UI_STATIC_LAYER_FOOTER).live_children == 0);
+
+    /* Too many dynamic widgets: the region falls back to direct rendering. */
+    lv_obj_t *extra[UI_STATIC_LAYER_MAX_DYNAMIC];
+    for (size_t i = 0; i < UI_STATIC_LAYER_MAX_DYNAMIC; ++i) {
+        extra[i] = lv_obj_create(wifi);
+        assert(ui_static_layer_set_dynamic(extra[i], true) == ESP_OK);
+    }
+    assert(ui_static_layer_set_dynamic(version, true) == ESP_ERR_NO_MEM);
+    assert(ui_static_layer_get_stats(UI_STATIC_LAYER_FOOTER, &stats) == ESP_ERR_INVALID_STATE);
+    assert(footer->bg_image_src == NULL && test_lvgl_obj_drawn(version));
+    assert(test_heap_caps_active_allocations() == 0);
+
+    /* Deinit detaches everything and unhooks the display. */
+    ui_static_layer_deinit();
+    assert(ui_static_layer_get_stats(UI_STATIC_LAYER_HEADER, &stats) == ESP_ERR_INVALID_STATE);
+    size_t snapshots = test_lvgl_snapshot_count();
+    test_lvgl_refr_start();
+    assert(test_lvgl_snapshot_count() == snapshots);
+    assert(test_lvgl_lock_depth() == 0);
+
+    puts("UI static layer test passed");
+    return 0;
+}
@@ -0,0 +1,367 @@
+/**
+ * @file bench_data_scale.c
+ * @brief Coût de construction des écrans de collections selon leur taille
+ * @author NovaReptileElevage Team
+ *
+ * Remplit reptiles, alertes et terrariums avec N entrées synthétiques
+ * (N = 10 à 5000 par défaut) puis, pour chaque écran de collection :
+ *  - build   : ui_content_load_screen() seul (création de l'arbre) ;
+ *  - layout  : premier rafraîchissement (mise en page et rendu) ;
+ *  - objects : objets LVGL de l'écran ;
+ *  - heap    : tas LVGL conservé par l'écran et pic pendant construction
+ *              et premier rendu ;
+ *  - scroll  : rafraîchissement après un défilement de SCALE_SCROLL_STEP
+ *              pixels de la zone défilante de l'écran, sur SCALE_SCROLL_FRAMES
+ *              trames (absent si l'écran tient sans défiler) ;
+ *  - update  : terrariums seulement, nouvelles mesures pour les N entrées
+ *              (ui_data_update_terrarium()) puis rafraîchissement : durée
+ *              des mises à jour et pixels envoyés, qui ne doivent dépendre
+ *              que des cartes visibles.
+ * Le coût par entrée (build_ns_per_item) reste plat tant que la
+ * construction est linéaire.
+ *
+ * Usage : nova_scale_bench [--sizes 10,100,…] [--repeat N] [--budget FICHIER] [--json FICHIER]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lvgl.h"
+#include "ui_content.h"
+#include "ui_data.h"
+#include "ui_main.h"
+#include "sim_bench.h"
+#include "sim_display.h"
+#include "sim_heap.h"
+#include "sim_touch.h"
+
+#define SCALE_MAX_SIZES     16
+#define SCALE_SCROLL_FRAMES 60
+#define SCALE_SCROLL_STEP   40
+
+static const size_t default_sizes[] = {10, 50, 100, 250, 500, 1000, 2500, 5000};
+
+static const struct {
+    nova_screen_t screen;
+    const char *name;
+} scale_screens[] = {
+    {SCREEN_REPTILES, "reptiles"},
+    {SCREEN_ALERTS, "alerts"},
+    {SCREEN_TERRARIUMS, "terrariums"},
+};
+
+#define SCALE_SCREEN_COUNT (sizeof(scale_screens) / sizeof(scale_screens[0]))
+
+/* Collections synthétiques, conservées pendant leur affichage */
+static char (*reptile_names)[32];
+static const char **reptiles;
+static ui_alert_item_t *alerts;
+static char (*terrarium_names)[32];
+static ui_terrarium_item_t *terrariums;
+
+static uint32_t sim_tick_ms(void)
+{
+    return (uint32_t)(sim_bench_now_us() / 1000);
+}
+
+static void scale_free_data(void)
+{
+    free(reptile_names);
+    free(reptiles);
+    free(alerts);
+    free(terrarium_names);
+    free(terrariums);
+    reptile_names = NULL;
+    reptiles = NULL;
+    alerts = NULL;
+    terrarium_names = NULL;
+    terrariums = NULL;
+}
+
+static int scale_fill_data(size_t n)
+{
+    static const char *const species[] = {
+        "Python Royal", "Iguane Vert", "Gecko Léopard", "Boa Constrictor", "Caméléon",
+    };
+    static const ui_alert_item_t alert_kinds[] = {
+        {"CRITIQUE", "Température terrarium élevée", "28.5°C (Max: 26°C)"},
+        {"ATTENTION", "Humidité terrarium faible", "45% (Min: 50%)"},
+        {"INFO", "Maintenance programmée", "Nettoyage système filtration"},
+    };
+
+    scale_free_data();
+    reptile_names = calloc(n, sizeof(*reptile_names));
+    reptiles = calloc(n, sizeof(*reptiles));
+    alerts = calloc(n, sizeof(*alerts));
+    terrarium_names = calloc(n, sizeof(*terrarium_names));
+    terrariums = calloc(n, sizeof(*terrariums));
+    if (!reptile_names || !reptiles || !alerts || !terrarium_names || !terrariums) {
+        scale_free_data();
+        return -1;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        snprintf(reptile_names[i], sizeof(reptile_names[i]), "%s %u",
+                 species[i % (sizeof(species) / sizeof(species[0]))], (unsigned)(i + 1));
+        reptiles[i] = reptile_names[i];
+        alerts[i] = alert_kinds[i % (sizeof(alert_kinds) / sizeof(alert_kinds[0]))];
+        snprintf(terrarium_names[i], sizeof(terrarium_names[i]), "Terrarium #%u", (unsigned)(i + 1));
+        terrariums[i].name = terrarium_names[i];
+        terrariums[i].temperature = 22.0f + (float)(i % 50) / 10.0f;
+        terrariums[i].humidity = (uint8_t)(50 + i % 30);
+    }
+    ui_data_set_reptiles(reptiles, n);
+    ui_data_set_alerts(alerts, n);
+    ui_data_set_terrariums(terrariums, n);
+    return 0;
+}
+
+static uint32_t count_objects(lv_obj_t *obj)
+{
+    uint32_t count = 1;
+    uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; ++i) {
+        count += count_objects(lv_obj_get_child(obj, (int32_t)i));
+    }
+    return count;
+}
+
+/**
+ * @brief Premier objet défilant verticalement dont le contenu déborde
+ */
+static lv_obj_t *find_scrollable(lv_obj_t *obj)
+{
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_SCROLLABLE) && lv_obj_get_scroll_bottom(obj) > 0) {
+        return obj;
+    }
+    uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; ++i) {
+        lv_obj_t *found = find_scrollable(lv_obj_get_child(obj, (int32_t)i));
+        if (found) {
+            return found;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Défile vers le bas trame après trame ; ajoute scroll_p50_us / scroll_p99_us
+ */
+static void scale_measure_scroll(lv_display_t *disp, lv_obj_t *screen, sim_bench_record_t *rec)
+{
+    uint32_t samples[SCALE_SCROLL_FRAMES];
+    lv_obj_t *scrollable = find_scrollable(screen);
+    if (!scrollable) {
+        return;
+    }
+    for (uint32_t i = 0; i < SCALE_SCROLL_FRAMES; ++i) {
+        int64_t start = sim_bench_now_us();
+        lv_obj_scroll_by_bounded(scrollable, 0, -SCALE_SCROLL_STEP, LV_ANIM_OFF);
+        lv_refr_now(disp);
+        samples[i] = (uint32_t)(sim_bench_now_us() - start);
+    }
+    sim_bench_record_add_percentiles(rec, "scroll", samples, SCALE_SCROLL_FRAMES);
+}
+
+/**
+ * @brief Nouvelles mesures pour tous les terrariums ; ajoute update_all_us et update_pixels
+ */
+static int scale_measure_updates(lv_display_t *disp, size_t n, sim_bench_record_t *rec)
+{
+    sim_display_stats_t stats;
+    lv_refr_now(disp);
+    sim_display_reset_stats();
+    int64_t start = sim_bench_now_us();
+    for (size_t i = 0; i < n; ++i) {
+        if (ui_data_update_terrarium(i, 30.0f + (float)(i % 20) / 10.0f, (uint8_t)(40 + i % 20)) != ESP_OK) {
+            return -1;
+        }
+    }
+    sim_bench_record_add(rec, "update_all_us", (uint64_t)(sim_bench_now_us() - start));
+    lv_refr_now(disp);
+    sim_display_get_stats(&stats);
+    sim_bench_record_add(rec, "update_pixels", stats.flush_pixels);
+    return 0;
+}
+
+static int scale_measure(lv_display_t *disp, nova_screen_t screen, const char *name, size_t n,
+                         uint32_t repeat, uint32_t *build, uint32_t *layout,
+                         sim_bench_record_t *rec)
+{
+    char case_name[SIM_BENCH_NAME_LEN];
+    snprintf(case_name, sizeof(case_name), "%s_%u", name, (unsigned)n);
+    sim_bench_record_init(rec, case_name);
+
+    sim_heap_stats_t before = {0};
+    sim_heap_stats_t after = {0};
+    for (uint32_t r = 0; r < repeat; ++r) {
+        /*
+         * Écran léger seul en place : cache vidé, la suppression de l'écran
+         * mesuré n'est pas comptée et aucune éviction ne fausse le tas.
+         */
+        if (ui_content_load_screen(SCREEN_SETTINGS) != ESP_OK) {
+            return -1;
+        }
+        ui_content_invalidate_screen(SCREEN_COUNT);
+        lv_refr_now(disp);
+        sim_heap_get_stats(&before);
+        sim_heap_reset_peak();
+
+        int64_t start = sim_bench_now_us();
+        if (ui_content_load_screen(screen) != ESP_OK) {
+            return -1;
+        }
+        int64_t built = sim_bench_now_us();
+        lv_refr_now(disp);
+        build[r] = (uint32_t)(built - start);
+        layout[r] = (uint32_t)(sim_bench_now_us() - built);
+        sim_heap_get_stats(&after);
+    }
+
+    uint32_t build_p50 = sim_bench_percentile(build, repeat, 50);
+    sim_bench_record_add(rec, "n", n);
+    sim_bench_record_add(rec, "build_p50_us", build_p50);
+    sim_bench_record_add(rec, "build_ns_per_item", (uint64_t)build_p50 * 1000 / n);
+    sim_bench_record_add(rec, "layout_p50_us", sim_bench_percentile(layout, repeat, 50));
+    /* Écran chargé : premier enfant visible du conteneur de contenu */
+    lv_obj_t *loaded = NULL;
+    lv_obj_t *container = ui_content_get_container();
+    for (uint32_t i = 0; i < lv_obj_get_child_count(container) && !loaded; ++i) {
+        lv_obj_t *child = lv_obj_get_child(container, (int32_t)i);
+        loaded = lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN) ? NULL : child;
+    }
+    if (!loaded) {
+        return -1;
+    }
+    sim_bench_record_add(rec, "objects", count_objects(loaded));
+    sim_bench_record_add(rec, "heap_retained", after.used - before.used);
+    sim_bench_record_add(rec, "heap_peak", after.peak - before.used);
+    scale_measure_scroll(disp, loaded, rec);
+    if (screen == SCREEN_TERRARIUMS) {
+        return scale_measure_updates(disp, n, rec);
+    }
+    return 0;
+}
+
+static size_t parse_sizes(const char *arg, size_t *sizes)
+{
+    size_t count = 0;
+    while (*arg && count < SCALE_MAX_SIZES) {
+        char *end;
+        unsigned long n = strtoul(arg, &end, 10);
+        if (end == arg || n == 0) {
+            return 0;
+        }
+        sizes[count++] = n;
+        arg = *end == ',' ? end + 1 : end;
+    }
+    return count;
+}
+
+int main(int argc, char **argv)
+{
+    size_t sizes[SCALE_MAX_SIZES];
+    size_t size_count = sizeof(default_sizes) / sizeof(default_sizes[0]);
+    uint32_t repeat = 3;
+    const char *budget_path = NULL;
+    const char *json_path = NULL;
+    sim_bench_budgets_t budgets;
+
+    memcpy(sizes, default_sizes, sizeof(default_sizes));
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--sizes") == 0 && i + 1 < argc) {
+            size_count = parse_sizes(argv[++i], sizes);
+        } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--budget") == 0 && i + 1 < argc) {
+            budget_path = argv[++i];
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else {
+            size_count = 0;
+            break;
+        }
+    }
+    if (size_count == 0) {
+        fprintf(stderr, "usage: %s [--sizes N,N,...] [--repeat N] [--budget FILE] [--json FILE]\n",
+                argv[0]);
+        return 2;
+    }
+    if (repeat == 0) {
+        repeat = 1;
+    }
+    if (budget_path && sim_bench_budgets_load(&budgets, budget_path) != 0) {
+        fprintf(stderr, "cannot read budgets from %s\n", budget_path);
+        return 2;
+    }
+
+    uint32_t *build = calloc(repeat, sizeof(uint32_t));
+    uint32_t *layout = calloc(repeat, sizeof(uint32_t));
+    sim_bench_record_t *records = calloc(size_count * SCALE_SCREEN_COUNT, sizeof(*records));
+    lv_init();
+    lv_tick_set_cb(sim_tick_ms);
+    lv_display_t *disp = sim_display_create(0);
+    if (!build || !layout || !records || !disp || !sim_touch_create()) {
+        fprintf(stderr, "setup failed\n");
+        return 1;
+    }
+
+    lv_lock();
+    if (ui_main_init() != ESP_OK) {
+        lv_unlock();
+        fprintf(stderr, "ui_main_init failed\n");
+        return 1;
+    }
+
+    int status = 0;
+    uint32_t overruns = 0;
+    size_t n_records = 0;
+    for (size_t s = 0; s < size_count && status == 0; ++s) {
+        if (scale_fill_data(sizes[s]) != 0) {
+            fprintf(stderr, "cannot allocate %u entries\n", (unsigned)sizes[s]);
+            status = 1;
+            break;
+        }
+        for (size_t k = 0; k < SCALE_SCREEN_COUNT; ++k) {
+            sim_bench_record_t *rec = &records[n_records];
+            if (scale_measure(disp, scale_screens[k].screen, scale_screens[k].name, sizes[s],
+                              repeat, build, layout, rec) != 0) {
+                fprintf(stderr, "%s with %u entries failed to load\n", scale_screens[k].name,
+                        (unsigned)sizes[s]);
+                status = 1;
+                break;
+            }
+            overruns += sim_bench_check(budget_path ? &budgets : NULL, rec, stderr);
+            n_records++;
+        }
+    }
+    /* Retour aux données par défaut avant de libérer les collections synthétiques */
+    ui_content_load_screen(SCREEN_SETTINGS);
+    ui_data_load_defaults();
+    ui_main_deinit();
+    lv_unlock();
+    scale_free_data();
+
+    sim_bench_record_t params;
+    sim_bench_record_init(&params, "params");
+    sim_bench_record_add(&params, "repeat", repeat);
+    sim_bench_record_add(&params, "draw_units", LV_DRAW_SW_DRAW_UNIT_CNT);
+
+    FILE *out = json_path ? fopen(json_path, "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "cannot write %s\n", json_path);
+        status = 1;
+    } else {
+        sim_bench_json_write(out, "data_scale", &params, records, n_records);
+        if (out != stdout) {
+            fclose(out);
+        }
+    }
+
+    sim_touch_delete();
+    sim_display_delete();
+    lv_deinit();
+    free(records);
+    free(layout);
+    free(build);
+    return status ? status : (overruns ? 1 : 0);
+}
@@ -0,0 +1,225 @@
+/**
+ * @file bench_nav_prebuild.c
+ * @brief Rejeu d'une trace d'appuis sur le menu, avec et sans pré-construction
+ * @author NovaReptileElevage Team
+ *
+ * La trace est rejouée en temps réel pendant les appuis : LVGL tourne
+ * normalement entre l'appui et le relâcher, comme sur la cible. Les
+ * intervalles entre deux appuis sont raccourcis (rien ne s'y passe).
+ * Latence mesurée : de l'instant de relâcher prévu par la trace à la fin
+ * du rendu qui affiche le nouvel écran.
+ *
+ * Par défaut le cache est vidé avant chaque appui (chaque navigation
+ * construit son écran) ; --warm le conserve. Le résultat est la latence
+ * avant / après (p50, p99) ; seul un écran préparé jamais ni affiché ni
+ * abandonné fait échouer l'exécution.
+ *
+ * Usage : nova_nav_bench --trace FICHIER [--warm] [--json FICHIER]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "ui_content.h"
+#include "ui_main.h"
+#include "ui_sidebar.h"
+#include "sim_bench.h"
+#include "sim_display.h"
+#include "sim_touch.h"
+
+/* Pause de la boucle LVGL pendant un appui */
+#define NAV_BENCH_POLL_US 500
+/* Intervalle conservé entre deux appuis */
+#define NAV_BENCH_GAP_MS  20
+
+static uint32_t sim_tick_ms(void)
+{
+    return (uint32_t)(sim_bench_now_us() / 1000);
+}
+
+/**
+ * @brief Fait tourner LVGL jusqu'à l'instant donné
+ */
+static void run_until(int64_t deadline_us)
+{
+    while (sim_bench_now_us() < deadline_us) {
+        lv_timer_handler();
+        usleep(NAV_BENCH_POLL_US);
+    }
+}
+
+static int replay(lv_display_t *disp, const sim_touch_event_t *events, size_t count, bool prebuild,
+                  bool warm, uint32_t *samples, sim_bench_record_t *rec)
+{
+    lv_indev_t *indev = sim_touch_indev();
+    ui_screen_cache_stats_t before;
+    ui_screen_cache_stats_t after;
+    uint32_t taps = 0;
+    uint32_t late = 0;
+    size_t n = 0;
+
+    sim_bench_record_init(rec, prebuild ? "prebuild" : "no_prebuild");
+    ui_sidebar_set_prebuild(prebuild);
+    if (ui_main_set_screen(SCREEN_DASHBOARD) != ESP_OK) {
+        return -1;
+    }
+    ui_content_invalidate_screen(SCREEN_COUNT);
+    lv_refr_now(disp);
+    ui_content_get_cache_stats(&before);
+
+    /* Origine de la trace, décalée à chaque intervalle raccourci */
+    int64_t origin = sim_bench_now_us();
+    for (size_t i = 0; i < count; ++i) {
+        const sim_touch_event_t *ev = &events[i];
+        int64_t at = origin + (int64_t)ev->t_ms * 1000;
+        if (ev->kind == SIM_TOUCH_DOWN) {
+            /* Reconstruit l'écran affiché : fait avant l'intervalle conservé */
+            if (!warm) {
+                ui_content_invalidate_screen(SCREEN_COUNT);
+            }
+            int64_t now = sim_bench_now_us();
+            origin += now + NAV_BENCH_GAP_MS * 1000 - at;
+            at = now + NAV_BENCH_GAP_MS * 1000;
+            ++taps;
+        }
+        if (sim_bench_now_us() > at) {
+            /* Boucle LVGL encore occupée à l'instant de l'événement */
+            late += ev->kind == SIM_TOUCH_UP;
+        }
+        run_until(at);
+
+        nova_screen_t shown = ui_main_get_current_screen();
+        sim_touch_apply(ev);
+        lv_indev_read(indev);
+        if (ev->kind != SIM_TOUCH_UP) {
+            continue;
+        }
+        lv_refr_now(disp);
+        if (ui_main_get_current_screen() != shown && n < count) {
+            samples[n++] = (uint32_t)(sim_bench_now_us() - at);
+        }
+        /* Abandon différé éventuel */
+        lv_timer_handler();
+    }
+
+    ui_content_get_cache_stats(&after);
+    sim_bench_record_add(rec, "taps", taps);
+    sim_bench_record_add(rec, "navigations", n);
+    sim_bench_record_add(rec, "late_releases", late);
+    if (n) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            sum += samples[i];
+        }
+        sim_bench_record_add(rec, "latency_mean_us", sum / n);
+        sim_bench_record_add_percentiles(rec, "latency", samples, n);
+    }
+    sim_bench_record_add(rec, "prebuilds", after.prebuilds - before.prebuilds);
+    sim_bench_record_add(rec, "prebuilds_used", after.prebuilds_used - before.prebuilds_used);
+    sim_bench_record_add(rec, "prebuilds_discarded",
+                         after.prebuilds_discarded - before.prebuilds_discarded);
+    return 0;
+}
+
+static uint64_t record_value(const sim_bench_record_t *rec, const char *key)
+{
+    for (size_t i = 0; i < rec->count; ++i) {
+        if (strcmp(rec->metrics[i].key, key) == 0) {
+            return rec->metrics[i].value;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *trace_path = NULL;
+    const char *json_path = NULL;
+    bool warm = false;
+    sim_touch_event_t *events = NULL;
+    size_t count = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else if (strcmp(argv[i], "--warm") == 0) {
+            warm = true;
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s --trace FILE [--warm] [--json FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (!trace_path || sim_touch_trace_load(trace_path, &events, &count) != 0 || count == 0) {
+        fprintf(stderr, "cannot read touch trace %s\n", trace_path ? trace_path : "(none)");
+        return 2;
+    }
+
+    uint32_t *samples = calloc(count, sizeof(uint32_t));
+    lv_init();
+    lv_tick_set_cb(sim_tick_ms);
+    lv_display_t *disp = sim_display_create(0);
+    if (!samples || !disp || !sim_touch_create()) {
+        fprintf(stderr, "setup failed\n");
+        return 1;
+    }
+
+    lv_lock();
+    if (ui_main_init() != ESP_OK) {
+        lv_unlock();
+        fprintf(stderr, "ui_main_init failed\n");
+        return 1;
+    }
+
+    sim_bench_record_t records[2];
+    int status = 0;
+    if (replay(disp, events, count, false, warm, samples, &records[0]) != 0 ||
+        replay(disp, events, count, true, warm, samples, &records[1]) != 0) {
+        fprintf(stderr, "replay failed\n");
+        status = 1;
+    }
+    ui_main_deinit();
+    lv_unlock();
+
+    if (status == 0) {
+        /* Avant / après : latence sans puis avec pré-construction */
+        fprintf(stderr, "release-to-frame p50 %llu -> %llu us, p99 %llu -> %llu us\n",
+                (unsigned long long)record_value(&records[0], "latency_p50_us"),
+                (unsigned long long)record_value(&records[1], "latency_p50_us"),
+                (unsigned long long)record_value(&records[0], "latency_p99_us"),
+                (unsigned long long)record_value(&records[1], "latency_p99_us"));
+        if (record_value(&records[1], "prebuilds") !=
+            record_value(&records[1], "prebuilds_used") +
+            record_value(&records[1], "prebuilds_discarded")) {
+            fprintf(stderr, "prebuilt screens left behind after the replay\n");
+            status = 1;
+        }
+    }
+
+    sim_bench_record_t params;
+    sim_bench_record_init(&params, "params");
+    sim_bench_record_add(&params, "events", count);
+    sim_bench_record_add(&params, "warm", warm);
+    sim_bench_record_add(&params, "buf_lines", SIM_DISPLAY_BUF_LINES);
+
+    FILE *out = json_path ? fopen(json_path, "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "cannot write %s\n", json_path);
+        status = 1;
+    } else {
+        sim_bench_json_write(out, "nav_prebuild", &params, records, 2);
+        if (out != stdout) {
+            fclose(out);
+        }
+    }
+
+    sim_touch_delete();
+    sim_display_delete();
+    lv_deinit();
+    free(samples);
+    free(events);
+    return status;
+}
@@ -0,0 +1,265 @@
+/**
+ * @file bench_screens.c
+ * @brief Benchmark de rendu par écran avec budgets de temps de trame
+ * @author NovaReptileElevage Team
+ *
+ * Pour chaque nova_screen_t :
+ *  - load    : ui_content_invalidate_screen() de l'écran affiché, qui le
+ *              reconstruit (suppression et reconstruction de l'arbre, sans
+ *              mise en page) ;
+ *  - switch  : retour sur l'écran conservé par le cache depuis un autre
+ *              écran ; switch_rebuilds compte les retours non servis ;
+ *  - full    : rafraîchissement plein écran de l'arbre obtenu ;
+ *  - partial : rafraîchissement d'une zone de carte (240x80) en haut à
+ *              gauche du contenu, cas d'une valeur mise à jour.
+ * Médiane et p99 de chaque mesure, flush et pixels par rafraîchissement,
+ * tas LVGL occupé par l'interface avec cet écran et pic pendant la mesure.
+ *
+ * Usage : nova_render_bench [--iterations N] [--budget FICHIER] [--json FICHIER]
+ *                           [--write-budget FICHIER [--margin PCT]]
+ * Code de sortie 1 si un budget est dépassé. --write-budget écrit des budgets
+ * tirés de cette exécution (mesure majorée de PCT %, 50 par défaut), avec
+ * l'hôte et la configuration de compilation en en-tête.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/utsname.h>
+#include "lvgl.h"
+#include "ui_content.h"
+#include "ui_main.h"
+#include "sim_bench.h"
+#include "sim_display.h"
+#include "sim_heap.h"
+#include "sim_touch.h"
+
+static const char *const screen_names[SCREEN_COUNT] = {
+    "dashboard", "reptiles", "terrariums", "statistics", "alerts", "settings",
+};
+
+/* Zone de carte invalidée par la mesure partielle */
+static const lv_area_t partial_area = {
+    .x1 = SIDEBAR_WIDTH + 20,
+    .y1 = HEADER_HEIGHT + 20,
+    .x2 = SIDEBAR_WIDTH + 20 + 240 - 1,
+    .y2 = HEADER_HEIGHT + 20 + 80 - 1,
+};
+
+static uint32_t sim_tick_ms(void)
+{
+    return (uint32_t)(sim_bench_now_us() / 1000);
+}
+
+/**
+ * @brief Rafraîchit N fois après invalidation de la zone (NULL = plein écran)
+ */
+static void bench_refresh(lv_display_t *disp, const lv_area_t *area, uint32_t *samples,
+                          uint32_t iterations, sim_bench_record_t *rec, const char *prefix)
+{
+    char key[SIM_BENCH_NAME_LEN];
+    sim_display_reset_stats();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        if (area) {
+            lv_obj_invalidate_area(lv_screen_active(), area);
+        } else {
+            lv_obj_invalidate(lv_screen_active());
+        }
+        int64_t start = sim_bench_now_us();
+        lv_refr_now(disp);
+        samples[i] = (uint32_t)(sim_bench_now_us() - start);
+    }
+    sim_display_stats_t stats;
+    sim_display_get_stats(&stats);
+    sim_bench_record_add_percentiles(rec, prefix, samples, iterations);
+    snprintf(key, sizeof(key), "%s_flushes", prefix);
+    sim_bench_record_add(rec, key, stats.flush_calls / iterations);
+    snprintf(key, sizeof(key), "%s_pixels", prefix);
+    sim_bench_record_add(rec, key, stats.flush_pixels / iterations);
+}
+
+static int bench_screen(lv_display_t *disp, nova_screen_t screen, uint32_t iterations,
+                        uint32_t *samples, sim_bench_record_t *rec)
+{
+    sim_bench_record_init(rec, screen_names[screen]);
+    if (ui_main_set_screen(screen) != ESP_OK) {
+        return -1;
+    }
+    /* Cache vidé : le tas mesuré est celui de l'interface avec cet écran seul */
+    ui_content_invalidate_screen(SCREEN_COUNT);
+    lv_refr_now(disp);
+    sim_heap_reset_peak();
+
+    for (uint32_t i = 0; i < iterations; ++i) {
+        ui_screen_cache_stats_t before;
+        ui_screen_cache_stats_t after;
+        ui_content_get_cache_stats(&before);
+        int64_t start = sim_bench_now_us();
+        ui_content_invalidate_screen(screen);
+        samples[i] = (uint32_t)(sim_bench_now_us() - start);
+        ui_content_get_cache_stats(&after);
+        if (after.misses == before.misses || ui_main_get_current_screen() != screen) {
+            return -1;
+        }
+    }
+    sim_bench_record_add_percentiles(rec, "load", samples, iterations);
+
+    /* Mise en page et premier rendu hors mesure */
+    lv_refr_now(disp);
+    bench_refresh(disp, NULL, samples, iterations, rec, "full");
+    bench_refresh(disp, &partial_area, samples, iterations, rec, "partial");
+
+    sim_heap_stats_t heap;
+    sim_heap_get_stats(&heap);
+    sim_bench_record_add(rec, "heap_used", heap.used);
+    sim_bench_record_add(rec, "heap_peak", heap.peak);
+
+    nova_screen_t other = screen == SCREEN_SETTINGS ? SCREEN_DASHBOARD : SCREEN_SETTINGS;
+    uint32_t rebuilds = 0;
+    for (uint32_t i = 0; i < iterations; ++i) {
+        ui_screen_cache_stats_t before;
+        ui_screen_cache_stats_t after;
+        if (ui_content_load_screen(other) != ESP_OK) {
+            return -1;
+        }
+        ui_content_get_cache_stats(&before);
+        int64_t start = sim_bench_now_us();
+        esp_err_t ret = ui_content_load_screen(screen);
+        samples[i] = (uint32_t)(sim_bench_now_us() - start);
+        ui_content_get_cache_stats(&after);
+        if (ret != ESP_OK) {
+            return -1;
+        }
+        rebuilds += after.hits == before.hits;
+    }
+    sim_bench_record_add_percentiles(rec, "switch", samples, iterations);
+    sim_bench_record_add(rec, "switch_rebuilds", rebuilds);
+    return 0;
+}
+
+/**
+ * @brief En-tête d'un fichier de budgets : hôte, compilateur, configuration
+ */
+static void budget_header(char *buf, size_t size, uint32_t iterations)
+{
+    struct utsname host;
+    if (uname(&host) != 0) {
+        memset(&host, 0, sizeof(host));
+    }
+    snprintf(buf, size,
+             "# Budgets of nova_render_bench: <screen|*> <metric> <max>\n"
+             "# Generated by nova_render_bench --write-budget, times in us, heap in bytes\n"
+             "# host: %s %s %s %s\n"
+             "# compiler: %s\n"
+             "# build: %s\n"
+             "# LVGL %d.%d.%d, %d draw unit(s), %d-line buffer, %" PRIu32 " iterations\n",
+             host.sysname, host.nodename, host.release, host.machine,
+#ifdef __VERSION__
+             __VERSION__,
+#else
+             "unknown",
+#endif
+             NOVA_SIM_BUILD_CONFIG, LVGL_VERSION_MAJOR, LVGL_VERSION_MINOR, LVGL_VERSION_PATCH,
+             LV_DRAW_SW_DRAW_UNIT_CNT, SIM_DISPLAY_BUF_LINES, iterations);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t iterations = 50;
+    const char *budget_path = NULL;
+    const char *json_path = NULL;
+    const char *write_budget_path = NULL;
+    uint32_t margin_pct = 50;
+    sim_bench_budgets_t budgets;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--budget") == 0 && i + 1 < argc) {
+            budget_path = argv[++i];
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (strcmp(argv[i], "--write-budget") == 0 && i + 1 < argc) {
+            write_budget_path = argv[++i];
+        } else if (strcmp(argv[i], "--margin") == 0 && i + 1 < argc) {
+            margin_pct = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "usage: %s [--iterations N] [--budget FILE] [--json FILE]"
+                    " [--write-budget FILE [--margin PCT]]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (iterations == 0) {
+        iterations = 1;
+    }
+    if (budget_path && sim_bench_budgets_load(&budgets, budget_path) != 0) {
+        fprintf(stderr, "cannot read budgets from %s\n", budget_path);
+        return 2;
+    }
+
+    uint32_t *samples = calloc(iterations, sizeof(uint32_t));
+    lv_init();
+    lv_tick_set_cb(sim_tick_ms);
+    lv_display_t *disp = sim_display_create(0);
+    if (!samples || !disp || !sim_touch_create()) {
+        fprintf(stderr, "setup failed\n");
+        return 1;
+    }
+
+    lv_lock();
+    if (ui_main_init() != ESP_OK) {
+        lv_unlock();
+        fprintf(stderr, "ui_main_init failed\n");
+        return 1;
+    }
+
+    sim_bench_record_t records[SCREEN_COUNT];
+    uint32_t overruns = 0;
+    int status = 0;
+    for (int s = 0; s < SCREEN_COUNT; ++s) {
+        if (bench_screen(disp, (nova_screen_t)s, iterations, samples, &records[s]) != 0) {
+            fprintf(stderr, "screen %s failed to load\n", screen_names[s]);
+            status = 1;
+        }
+        overruns += sim_bench_check(budget_path ? &budgets : NULL, &records[s], stderr);
+    }
+    ui_main_deinit();
+    lv_unlock();
+
+    sim_bench_record_t params;
+    sim_bench_record_init(&params, "params");
+    sim_bench_record_add(&params, "iterations", iterations);
+    sim_bench_record_add(&params, "draw_units", LV_DRAW_SW_DRAW_UNIT_CNT);
+    sim_bench_record_add(&params, "buf_lines", SIM_DISPLAY_BUF_LINES);
+
+    FILE *out = json_path ? fopen(json_path, "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "cannot write %s\n", json_path);
+        status = 1;
+    } else {
+        sim_bench_json_write(out, "screens", &params, records, SCREEN_COUNT);
+        if (out != stdout) {
+            fclose(out);
+        }
+    }
+
+    if (status == 0 && write_budget_path) {
+        char header[512];
+        FILE *f = fopen(write_budget_path, "w");
+        if (!f) {
+            fprintf(stderr, "cannot write %s\n", write_budget_path);
+            status = 1;
+        } else {
+            budget_header(header, sizeof(header), iterations);
+            sim_bench_budgets_write(f, header, records, SCREEN_COUNT, margin_pct);
+            fclose(f);
+        }
+    }
+
+    sim_touch_delete();
+    sim_display_delete();
+    lv_deinit();
+    free(samples);
+    return status ? status : (overruns ? 1 : 0);
+}
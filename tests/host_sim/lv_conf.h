@@ -0,0 +1,96 @@
+/**
+ * @file lv_conf.h
+ * Configuration LVGL du simulateur hôte (noms LVGL 9)
+ *
+ * Reprend components/lvgl/lv_conf.h : même format, mêmes polices, même
+ * nombre d'unités de rendu. Seuls l'OS (pthread) et l'allocateur diffèrent :
+ * sim_heap.c compte les octets de LVGL au-dessus de malloc(), toujours
+ * lisible par valgrind.
+ */
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+// Paramètres de base
+#define LV_COLOR_DEPTH 16
+#define LV_USE_STDLIB_MALLOC LV_STDLIB_CUSTOM
+#define LV_USE_STDLIB_STRING LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF LV_STDLIB_CLIB
+
+// Système d'exploitation : rendu logiciel sur deux threads, comme les deux cœurs
+#define LV_USE_OS LV_OS_PTHREAD
+#ifndef LV_DRAW_SW_DRAW_UNIT_CNT
+#define LV_DRAW_SW_DRAW_UNIT_CNT 2
+#endif
+
+// Noyaux RGB565 de components/rgb565_simd (référence C hors ESP32-S3)
+#if NOVA_SIM_RGB565_KERNELS
+#define LV_USE_DRAW_SW_ASM LV_DRAW_SW_ASM_CUSTOM
+#define LV_DRAW_SW_ASM_CUSTOM_INCLUDE "lv_blend_rgb565_simd.h"
+#endif
+
+// Support HAL
+#define LV_DEF_REFR_PERIOD 16
+#define LV_DPI_DEF 130
+
+// Fonctionnalités activées
+#define LV_USE_PERF_MONITOR 0
+#define LV_USE_MEM_MONITOR 0
+#define LV_USE_REFR_DEBUG 0
+#define LV_USE_SNAPSHOT 1
+
+// Widgets activés
+#define LV_USE_ARC 1
+#define LV_USE_BAR 1
+#define LV_USE_BUTTON 1
+#define LV_USE_BUTTONMATRIX 1
+#define LV_USE_CANVAS 0
+#define LV_USE_CHECKBOX 1
+#define LV_USE_CHART 1
+#define LV_USE_DROPDOWN 1
+#define LV_USE_IMAGE 1
+#define LV_USE_LABEL 1
+#define LV_USE_LINE 1
+#define LV_USE_LIST 1
+#define LV_USE_MSGBOX 1
+#define LV_USE_ROLLER 1
+#define LV_USE_SCALE 1
+#define LV_USE_SLIDER 1
+#define LV_USE_SWITCH 1
+#define LV_USE_TEXTAREA 1
+#define LV_USE_TABLE 1
+
+// Thèmes
+#define LV_USE_THEME_DEFAULT 1
+
+// Layouts
+#define LV_USE_FLEX 1
+#define LV_USE_GRID 1
+
+// Polices par défaut
+#define LV_FONT_MONTSERRAT_12 1
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_MONTSERRAT_16 1
+#define LV_FONT_MONTSERRAT_18 1
+#define LV_FONT_MONTSERRAT_20 1
+#define LV_FONT_MONTSERRAT_22 1
+#define LV_FONT_MONTSERRAT_24 1
+#define LV_FONT_MONTSERRAT_26 1
+#define LV_FONT_MONTSERRAT_28 1
+#define LV_FONT_MONTSERRAT_30 1
+#define LV_FONT_DEFAULT &lv_font_montserrat_20
+
+// Logging
+#define LV_USE_LOG 1
+#if LV_USE_LOG
+#define LV_LOG_LEVEL LV_LOG_LEVEL_WARN
+#define LV_LOG_PRINTF 1
+#endif
+
+// Assertions
+#define LV_USE_ASSERT_NULL 1
+#define LV_USE_ASSERT_MALLOC 1
+#define LV_USE_ASSERT_STYLE 0
+#define LV_USE_ASSERT_MEM_INTEGRITY 0
+#define LV_USE_ASSERT_OBJ 0
+
+#endif // LV_CONF_H
@@ -0,0 +1,11 @@
+#pragma once
+
+/* Allocation par capacités : tout vient du tas libc (visible par valgrind) */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_SPIRAM   (1u << 0)
+
+void *heap_caps_malloc(size_t size, uint32_t caps);
+void heap_caps_free(void *ptr);
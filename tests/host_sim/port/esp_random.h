@@ -0,0 +1,7 @@
+#pragma once
+
+/* Générateur pseudo-aléatoire reproductible d'une exécution à l'autre */
+
+#include <stdint.h>
+
+uint32_t esp_random(void);
@@ -0,0 +1,7 @@
+#pragma once
+
+/* Horloge monotone du poste (µs), en lieu et place de esp_timer */
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time(void);
@@ -0,0 +1,72 @@
+/**
+ * @file sim_port.c
+ * @brief Implémentations poste des services ESP-IDF utilisés par l'UI
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+
+static int64_t clock_us(clockid_t clock)
+{
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+const char *esp_err_to_name(esp_err_t err)
+{
+    switch (err) {
+    case ESP_OK:
+        return "ESP_OK";
+    case ESP_FAIL:
+        return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:
+        return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:
+        return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE:
+        return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:
+        return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:
+        return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED:
+        return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT:
+        return "ESP_ERR_TIMEOUT";
+    default:
+        return "ESP_ERR";
+    }
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return clock_us(CLOCK_MONOTONIC);
+}
+
+/* Même graine à chaque exécution : trames comparables d'un run à l'autre */
+static uint32_t random_state = 0x4e6f7661u;
+
+uint32_t esp_random(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    return malloc(size);
+}
+
+void heap_caps_free(void *ptr)
+{
+    free(ptr);
+}
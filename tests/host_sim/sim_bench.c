@@ -0,0 +1,181 @@
+/**
+ * @file sim_bench.c
+ * @brief Mesures, budgets et sortie JSON des benchmarks du simulateur hôte
+ * @author NovaReptileElevage Team
+ */
+
+#include "sim_bench.h"
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_timer.h"
+
+static int sim_bench_cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+uint32_t sim_bench_percentile(uint32_t *samples, size_t n, uint32_t pct)
+{
+    if (!samples || n == 0) {
+        return 0;
+    }
+    qsort(samples, n, sizeof(samples[0]), sim_bench_cmp_u32);
+    size_t rank = ((size_t)pct * n + 99) / 100;
+    return samples[rank ? rank - 1 : 0];
+}
+
+void sim_bench_record_init(sim_bench_record_t *rec, const char *name)
+{
+    memset(rec, 0, sizeof(*rec));
+    snprintf(rec->name, sizeof(rec->name), "%s", name);
+}
+
+void sim_bench_record_add(sim_bench_record_t *rec, const char *key, uint64_t value)
+{
+    if (rec->count >= SIM_BENCH_MAX_METRICS) {
+        return;
+    }
+    sim_bench_metric_t *m = &rec->metrics[rec->count++];
+    snprintf(m->key, sizeof(m->key), "%s", key);
+    m->value = value;
+}
+
+void sim_bench_record_add_percentiles(sim_bench_record_t *rec, const char *prefix,
+                                      uint32_t *samples, size_t n)
+{
+    char key[SIM_BENCH_NAME_LEN];
+    snprintf(key, sizeof(key), "%s_p50_us", prefix);
+    sim_bench_record_add(rec, key, sim_bench_percentile(samples, n, 50));
+    snprintf(key, sizeof(key), "%s_p99_us", prefix);
+    sim_bench_record_add(rec, key, sim_bench_percentile(samples, n, 99));
+}
+
+int sim_bench_budgets_load(sim_bench_budgets_t *budgets, const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        return -1;
+    }
+    memset(budgets, 0, sizeof(*budgets));
+    char line[256];
+    int ret = 0;
+    while (ret == 0 && fgets(line, sizeof(line), f)) {
+        char name[SIM_BENCH_NAME_LEN];
+        char key[SIM_BENCH_NAME_LEN];
+        unsigned long long limit;
+        char *p = line + strspn(line, " \t");
+        if (*p == '#' || *p == '\n' || *p == '\0') {
+            continue;
+        }
+        if (sscanf(p, "%31s %31s %llu", name, key, &limit) != 3 ||
+            budgets->count >= SIM_BENCH_MAX_BUDGETS) {
+            ret = -1;
+            break;
+        }
+        sim_bench_budget_t *b = &budgets->entries[budgets->count++];
+        memcpy(b->name, name, sizeof(b->name));
+        memcpy(b->key, key, sizeof(b->key));
+        b->limit = limit;
+    }
+    fclose(f);
+    return ret;
+}
+
+static bool sim_bench_ends_with(const char *s, const char *suffix)
+{
+    size_t len = strlen(s);
+    size_t suffix_len = strlen(suffix);
+    return len >= suffix_len && strcmp(s + len - suffix_len, suffix) == 0;
+}
+
+void sim_bench_budgets_write(FILE *out, const char *header, const sim_bench_record_t *records,
+                             size_t n, uint32_t margin_pct)
+{
+    fprintf(out, "%s", header);
+    fprintf(out, "# margin: +%" PRIu32 "%% over the measured value\n", margin_pct);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t m = 0; m < records[i].count; ++m) {
+            const sim_bench_metric_t *metric = &records[i].metrics[m];
+            if (!sim_bench_ends_with(metric->key, "_p99_us") &&
+                !sim_bench_ends_with(metric->key, "_flushes") &&
+                strcmp(metric->key, "heap_used") != 0) {
+                continue;
+            }
+            fprintf(out, "%-11s %-15s %" PRIu64 "\n", records[i].name, metric->key,
+                    metric->value * (100 + margin_pct) / 100);
+        }
+    }
+}
+
+/* Budget d'une métrique : celui du cas prime sur "*" */
+static const sim_bench_budget_t *sim_bench_find_budget(const sim_bench_budgets_t *budgets,
+                                                       const char *name, const char *key)
+{
+    const sim_bench_budget_t *wildcard = NULL;
+    for (size_t b = 0; b < budgets->count; ++b) {
+        const sim_bench_budget_t *budget = &budgets->entries[b];
+        if (strcmp(budget->key, key) != 0) {
+            continue;
+        }
+        if (strcmp(budget->name, name) == 0) {
+            return budget;
+        }
+        if (strcmp(budget->name, "*") == 0) {
+            wildcard = budget;
+        }
+    }
+    return wildcard;
+}
+
+uint32_t sim_bench_check(const sim_bench_budgets_t *budgets, sim_bench_record_t *rec, FILE *report)
+{
+    rec->overruns = 0;
+    if (!budgets) {
+        return 0;
+    }
+    for (size_t m = 0; m < rec->count; ++m) {
+        const sim_bench_metric_t *metric = &rec->metrics[m];
+        const sim_bench_budget_t *budget = sim_bench_find_budget(budgets, rec->name, metric->key);
+        if (budget && metric->value > budget->limit) {
+            rec->overruns++;
+            if (report) {
+                fprintf(report, "over budget: %s %s = %" PRIu64 " > %" PRIu64 "\n",
+                        rec->name, metric->key, metric->value, budget->limit);
+            }
+        }
+    }
+    return rec->overruns;
+}
+
+static void sim_bench_json_metrics(FILE *out, const sim_bench_record_t *rec)
+{
+    for (size_t m = 0; m < rec->count; ++m) {
+        fprintf(out, ", \"%s\": %" PRIu64, rec->metrics[m].key, rec->metrics[m].value);
+    }
+}
+
+void sim_bench_json_write(FILE *out, const char *suite, const sim_bench_record_t *params,
+                          const sim_bench_record_t *records, size_t n)
+{
+    fprintf(out, "{\"suite\": \"%s\"", suite);
+    if (params) {
+        sim_bench_json_metrics(out, params);
+    }
+    fprintf(out, ",\n \"cases\": [\n");
+    for (size_t i = 0; i < n; ++i) {
+        fprintf(out, "  {\"name\": \"%s\"", records[i].name);
+        sim_bench_json_metrics(out, &records[i]);
+        fprintf(out, ", \"over_budget\": %" PRIu32 "}%s\n", records[i].overruns,
+                i + 1 < n ? "," : "");
+    }
+    fprintf(out, " ]}\n");
+}
+
+int64_t sim_bench_now_us(void)
+{
+    return esp_timer_get_time();
+}
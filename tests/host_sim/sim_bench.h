@@ -0,0 +1,110 @@
+/**
+ * @file sim_bench.h
+ * @brief Mesures, budgets et sortie JSON des benchmarks du simulateur hôte
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef SIM_BENCH_H
+#define SIM_BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SIM_BENCH_NAME_LEN    32
+#define SIM_BENCH_MAX_METRICS 24
+#define SIM_BENCH_MAX_BUDGETS 64
+
+/**
+ * @brief Valeur nommée d'un enregistrement ("full_p99_us", "heap_used"…)
+ */
+typedef struct {
+    char key[SIM_BENCH_NAME_LEN];
+    uint64_t value;
+} sim_bench_metric_t;
+
+/**
+ * @brief Mesures d'un cas (un écran, une taille de jeu de données…)
+ */
+typedef struct {
+    char name[SIM_BENCH_NAME_LEN];
+    size_t count;
+    sim_bench_metric_t metrics[SIM_BENCH_MAX_METRICS];
+    uint32_t overruns;  /*!< Budgets dépassés, rempli par sim_bench_check() */
+} sim_bench_record_t;
+
+/**
+ * @brief Plafond d'une métrique ; cas "*" pour tous les cas, sauf budget propre au cas
+ */
+typedef struct {
+    char name[SIM_BENCH_NAME_LEN];
+    char key[SIM_BENCH_NAME_LEN];
+    uint64_t limit;
+} sim_bench_budget_t;
+
+typedef struct {
+    size_t count;
+    sim_bench_budget_t entries[SIM_BENCH_MAX_BUDGETS];
+} sim_bench_budgets_t;
+
+/**
+ * @brief Percentile par rang le plus proche ; trie les échantillons sur place
+ * @param pct Percentile 0..100 (50 = médiane)
+ */
+uint32_t sim_bench_percentile(uint32_t *samples, size_t n, uint32_t pct);
+
+void sim_bench_record_init(sim_bench_record_t *rec, const char *name);
+void sim_bench_record_add(sim_bench_record_t *rec, const char *key, uint64_t value);
+
+/**
+ * @brief Ajoute <prefix>_p50_us et <prefix>_p99_us
+ */
+void sim_bench_record_add_percentiles(sim_bench_record_t *rec, const char *prefix,
+                                      uint32_t *samples, size_t n);
+
+/**
+ * @brief Lit un fichier de budgets : une ligne "cas métrique plafond" par budget
+ *
+ * Les lignes vides et celles commençant par '#' sont ignorées.
+ * @return 0 en cas de succès, -1 si le fichier est illisible ou mal formé
+ */
+int sim_bench_budgets_load(sim_bench_budgets_t *budgets, const char *path);
+
+/**
+ * @brief Écrit un fichier de budgets à partir de mesures
+ *
+ * Un budget par cas pour chaque métrique *_p99_us, *_flushes et heap_used,
+ * fixé à la valeur mesurée majorée de margin_pct pour cent.
+ * @param header Lignes d'en-tête (hôte, configuration), chacune commençant par '#'
+ */
+void sim_bench_budgets_write(FILE *out, const char *header, const sim_bench_record_t *records,
+                             size_t n, uint32_t margin_pct);
+
+/**
+ * @brief Compare un enregistrement aux budgets et signale chaque dépassement
+ * @param report Flux des messages de dépassement (NULL = silencieux)
+ * @return Nombre de budgets dépassés
+ */
+uint32_t sim_bench_check(const sim_bench_budgets_t *budgets, sim_bench_record_t *rec, FILE *report);
+
+/**
+ * @brief Écrit {"suite": …, <params>, "cases": [ {…}, … ]}
+ * @param params Paramètres de l'exécution (itérations, unités de rendu…)
+ */
+void sim_bench_json_write(FILE *out, const char *suite, const sim_bench_record_t *params,
+                          const sim_bench_record_t *records, size_t n);
+
+/**
+ * @brief Horloge monotone en µs
+ */
+int64_t sim_bench_now_us(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_BENCH_H
@@ -0,0 +1,125 @@
+/**
+ * @file sim_display.c
+ * @brief Écran 1024x600 RGB565 en mémoire pour le simulateur hôte
+ * @author NovaReptileElevage Team
+ *
+ * Même chemin que display_driver en mode partiel : LVGL rend dans deux
+ * tampons de bande, le flush les recopie dans le framebuffer balayé.
+ */
+
+#include "sim_display.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static lv_display_t *sim_disp;
+static uint16_t *framebuffer;
+static uint8_t *draw_buf[2];
+static sim_display_stats_t stats;
+
+static void sim_display_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    const int32_t w = lv_area_get_width(area);
+    const uint16_t *src = (const uint16_t *)px_map;
+    for (int32_t y = area->y1; y <= area->y2; ++y) {
+        memcpy(&framebuffer[(size_t)y * SIM_DISPLAY_WIDTH + area->x1], src, (size_t)w * sizeof(uint16_t));
+        src += w;
+    }
+    stats.flush_calls++;
+    stats.flush_pixels += (uint64_t)lv_area_get_size(area);
+    lv_display_flush_ready(disp);
+}
+
+lv_display_t *sim_display_create(uint32_t buf_lines)
+{
+    if (sim_disp) {
+        return sim_disp;
+    }
+    if (buf_lines == 0 || buf_lines > SIM_DISPLAY_HEIGHT) {
+        buf_lines = SIM_DISPLAY_BUF_LINES;
+    }
+    const size_t buf_size = (size_t)SIM_DISPLAY_WIDTH * buf_lines * sizeof(uint16_t);
+
+    framebuffer = calloc((size_t)SIM_DISPLAY_WIDTH * SIM_DISPLAY_HEIGHT, sizeof(uint16_t));
+    draw_buf[0] = malloc(buf_size);
+    draw_buf[1] = malloc(buf_size);
+    if (!framebuffer || !draw_buf[0] || !draw_buf[1]) {
+        goto cleanup;
+    }
+
+    sim_disp = lv_display_create(SIM_DISPLAY_WIDTH, SIM_DISPLAY_HEIGHT);
+    if (!sim_disp) {
+        goto cleanup;
+    }
+    lv_display_set_color_format(sim_disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(sim_disp, draw_buf[0], draw_buf[1], (uint32_t)buf_size,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(sim_disp, sim_display_flush_cb);
+    memset(&stats, 0, sizeof(stats));
+    return sim_disp;
+
+cleanup:
+    sim_display_delete();
+    return NULL;
+}
+
+void sim_display_delete(void)
+{
+    if (sim_disp) {
+        lv_display_delete(sim_disp);
+        sim_disp = NULL;
+    }
+    free(draw_buf[0]);
+    free(draw_buf[1]);
+    free(framebuffer);
+    draw_buf[0] = NULL;
+    draw_buf[1] = NULL;
+    framebuffer = NULL;
+}
+
+const uint16_t *sim_display_framebuffer(void)
+{
+    return framebuffer;
+}
+
+void sim_display_get_stats(sim_display_stats_t *out)
+{
+    if (out) {
+        *out = stats;
+    }
+}
+
+void sim_display_reset_stats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+int sim_display_dump_ppm(const char *path)
+{
+    if (!framebuffer || !path) {
+        return -1;
+    }
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        return -1;
+    }
+    int ret = fprintf(f, "P6\n%d %d\n255\n", SIM_DISPLAY_WIDTH, SIM_DISPLAY_HEIGHT) > 0 ? 0 : -1;
+    uint8_t row[SIM_DISPLAY_WIDTH * 3];
+    for (int y = 0; y < SIM_DISPLAY_HEIGHT && ret == 0; ++y) {
+        const uint16_t *src = &framebuffer[(size_t)y * SIM_DISPLAY_WIDTH];
+        for (int x = 0; x < SIM_DISPLAY_WIDTH; ++x) {
+            uint16_t c = src[x];
+            /* Extension 5/6 bits vers 8 bits par réplication des bits forts */
+            row[x * 3 + 0] = (uint8_t)(((c >> 11) & 0x1F) << 3 | ((c >> 13) & 0x07));
+            row[x * 3 + 1] = (uint8_t)(((c >> 5) & 0x3F) << 2 | ((c >> 9) & 0x03));
+            row[x * 3 + 2] = (uint8_t)((c & 0x1F) << 3 | ((c >> 2) & 0x07));
+        }
+        if (fwrite(row, 1, sizeof(row), f) != sizeof(row)) {
+            ret = -1;
+        }
+    }
+    if (fclose(f) != 0) {
+        ret = -1;
+    }
+    return ret;
+}
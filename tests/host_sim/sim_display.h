@@ -0,0 +1,60 @@
+/**
+ * @file sim_display.h
+ * @brief Écran 1024x600 RGB565 en mémoire pour le simulateur hôte
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef SIM_DISPLAY_H
+#define SIM_DISPLAY_H
+
+#include <stdint.h>
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SIM_DISPLAY_WIDTH  1024
+#define SIM_DISPLAY_HEIGHT 600
+/** Hauteur des tampons de rendu, celle du mode partiel de display_driver */
+#define SIM_DISPLAY_BUF_LINES 150
+
+/**
+ * @brief Compteurs de flush depuis la création ou la dernière remise à zéro
+ */
+typedef struct {
+    uint32_t flush_calls;   /*!< Appels au flush */
+    uint64_t flush_pixels;  /*!< Pixels copiés dans le framebuffer */
+} sim_display_stats_t;
+
+/**
+ * @brief Crée l'écran LVGL par défaut, rendu en mode partiel vers un framebuffer
+ * @param buf_lines Hauteur des deux tampons de rendu (0 = SIM_DISPLAY_BUF_LINES)
+ * @return Écran créé, NULL si mémoire insuffisante
+ */
+lv_display_t *sim_display_create(uint32_t buf_lines);
+
+/**
+ * @brief Détruit l'écran et libère framebuffer et tampons
+ */
+void sim_display_delete(void);
+
+/**
+ * @brief Framebuffer courant (SIM_DISPLAY_WIDTH x SIM_DISPLAY_HEIGHT, RGB565)
+ */
+const uint16_t *sim_display_framebuffer(void);
+
+void sim_display_get_stats(sim_display_stats_t *out);
+void sim_display_reset_stats(void);
+
+/**
+ * @brief Écrit le framebuffer au format PPM binaire (P6, RGB888)
+ * @return 0 en cas de succès, -1 sinon
+ */
+int sim_display_dump_ppm(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_DISPLAY_H
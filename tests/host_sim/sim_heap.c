@@ -0,0 +1,133 @@
+/**
+ * @file sim_heap.c
+ * @brief Tas LVGL compté du simulateur hôte (LV_STDLIB_CUSTOM)
+ * @author NovaReptileElevage Team
+ *
+ * Chaque bloc vient de malloc() (valgrind voit toujours les allocations
+ * de LVGL) précédé d'un en-tête portant sa taille, ce qui permet de suivre
+ * l'occupation et le pic. Les unités de rendu allouent depuis leurs
+ * propres threads : les compteurs sont protégés par un mutex.
+ */
+
+#include "sim_heap.h"
+#include <pthread.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "lvgl.h"
+
+typedef union {
+    size_t size;
+    max_align_t align;
+} sim_heap_hdr_t;
+
+static pthread_mutex_t heap_lock = PTHREAD_MUTEX_INITIALIZER;
+static sim_heap_stats_t heap_stats;
+
+static void sim_heap_account(size_t freed, size_t allocated, int blocks)
+{
+    pthread_mutex_lock(&heap_lock);
+    heap_stats.used = heap_stats.used - freed + allocated;
+    heap_stats.blocks = (uint32_t)((int64_t)heap_stats.blocks + blocks);
+    if (allocated) {
+        heap_stats.allocs++;
+    }
+    if (heap_stats.used > heap_stats.peak) {
+        heap_stats.peak = heap_stats.used;
+    }
+    pthread_mutex_unlock(&heap_lock);
+}
+
+void lv_mem_init(void)
+{
+    pthread_mutex_lock(&heap_lock);
+    heap_stats = (sim_heap_stats_t){0};
+    pthread_mutex_unlock(&heap_lock);
+}
+
+void lv_mem_deinit(void)
+{
+}
+
+lv_mem_pool_t lv_mem_add_pool(void *mem, size_t bytes)
+{
+    (void)mem;
+    (void)bytes;
+    return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool)
+{
+    (void)pool;
+}
+
+void *lv_malloc_core(size_t size)
+{
+    sim_heap_hdr_t *hdr = malloc(sizeof(*hdr) + size);
+    if (!hdr) {
+        return NULL;
+    }
+    hdr->size = size;
+    sim_heap_account(0, size, 1);
+    return hdr + 1;
+}
+
+void *lv_realloc_core(void *p, size_t new_size)
+{
+    if (!p) {
+        return lv_malloc_core(new_size);
+    }
+    sim_heap_hdr_t *hdr = (sim_heap_hdr_t *)p - 1;
+    size_t old_size = hdr->size;
+    sim_heap_hdr_t *moved = realloc(hdr, sizeof(*moved) + new_size);
+    if (!moved) {
+        return NULL;
+    }
+    moved->size = new_size;
+    sim_heap_account(old_size, new_size, 0);
+    return moved + 1;
+}
+
+void lv_free_core(void *p)
+{
+    if (!p) {
+        return;
+    }
+    sim_heap_hdr_t *hdr = (sim_heap_hdr_t *)p - 1;
+    sim_heap_account(hdr->size, 0, -1);
+    free(hdr);
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t *mon_p)
+{
+    sim_heap_stats_t stats;
+    sim_heap_get_stats(&stats);
+    size_t total = stats.used > SIM_HEAP_CAPACITY ? stats.used : SIM_HEAP_CAPACITY;
+    mon_p->total_size = total;
+    mon_p->free_size = total - stats.used;
+    mon_p->free_biggest_size = mon_p->free_size;
+    mon_p->used_cnt = stats.blocks;
+    mon_p->max_used = stats.peak;
+    mon_p->used_pct = (uint8_t)(stats.used * 100 / total);
+}
+
+lv_result_t lv_mem_test_core(void)
+{
+    return LV_RESULT_OK;
+}
+
+void sim_heap_get_stats(sim_heap_stats_t *out)
+{
+    if (!out) {
+        return;
+    }
+    pthread_mutex_lock(&heap_lock);
+    *out = heap_stats;
+    pthread_mutex_unlock(&heap_lock);
+}
+
+void sim_heap_reset_peak(void)
+{
+    pthread_mutex_lock(&heap_lock);
+    heap_stats.peak = heap_stats.used;
+    pthread_mutex_unlock(&heap_lock);
+}
@@ -0,0 +1,47 @@
+/**
+ * @file sim_heap.h
+ * @brief Tas LVGL compté du simulateur hôte (LV_STDLIB_CUSTOM)
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef SIM_HEAP_H
+#define SIM_HEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Capacité annoncée par lv_mem_monitor(), celle du tas LVGL de la cible :
+ * la marge libre vue par le cache d'écrans est celle du matériel. Les
+ * allocations au-delà réussissent toujours.
+ */
+#ifndef SIM_HEAP_CAPACITY
+#define SIM_HEAP_CAPACITY (128u * 1024u)
+#endif
+
+/**
+ * @brief Occupation du tas LVGL
+ */
+typedef struct {
+    size_t used;        /*!< Octets alloués par LVGL en ce moment */
+    size_t peak;        /*!< Maximum depuis lv_init() ou sim_heap_reset_peak() */
+    uint32_t blocks;    /*!< Blocs alloués en ce moment */
+    uint64_t allocs;    /*!< Allocations cumulées (malloc et realloc) */
+} sim_heap_stats_t;
+
+void sim_heap_get_stats(sim_heap_stats_t *out);
+
+/**
+ * @brief Ramène le pic à l'occupation courante
+ */
+void sim_heap_reset_peak(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_HEAP_H
@@ -0,0 +1,137 @@
+/**
+ * @file sim_main.c
+ * @brief Simulateur hôte sans affichage de l'interface NovaReptileElevage
+ * @author NovaReptileElevage Team
+ *
+ * Compile main/ui contre LVGL réel, rend chaque écran dans un framebuffer
+ * en mémoire et mesure le temps de rafraîchissement plein écran. Pensé
+ * pour perf, valgrind et la comparaison d'images (PPM) entre versions.
+ *
+ * Usage : nova_sim [--screen NOM] [--frames N] [--buf-lines N] [--dump DOSSIER]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lvgl.h"
+#include "esp_timer.h"
+#include "ui_main.h"
+#include "sim_display.h"
+#include "sim_touch.h"
+
+static const char *const screen_names[SCREEN_COUNT] = {
+    "dashboard", "reptiles", "terrariums", "statistics", "alerts", "settings",
+};
+
+static uint32_t sim_tick_ms(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [--screen NAME] [--frames N] [--buf-lines N] [--dump DIR]\n", prog);
+}
+
+static int screen_from_name(const char *name)
+{
+    for (int s = 0; s < SCREEN_COUNT; ++s) {
+        if (strcmp(name, screen_names[s]) == 0) {
+            return s;
+        }
+    }
+    return -1;
+}
+
+int main(int argc, char **argv)
+{
+    int only_screen = -1;
+    uint32_t frames = 10;
+    uint32_t buf_lines = 0;
+    const char *dump_dir = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--screen") == 0 && i + 1 < argc) {
+            only_screen = screen_from_name(argv[++i]);
+            if (only_screen < 0) {
+                fprintf(stderr, "unknown screen '%s'\n", argv[i]);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--buf-lines") == 0 && i + 1 < argc) {
+            buf_lines = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--dump") == 0 && i + 1 < argc) {
+            dump_dir = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    lv_init();
+    lv_tick_set_cb(sim_tick_ms);
+    lv_display_t *disp = sim_display_create(buf_lines);
+    if (!disp || !sim_touch_create()) {
+        fprintf(stderr, "display/touch creation failed\n");
+        return 1;
+    }
+
+    lv_lock();
+    esp_err_t ret = ui_main_init();
+    lv_unlock();
+    if (ret != ESP_OK) {
+        fprintf(stderr, "ui_main_init failed: %d\n", ret);
+        return 1;
+    }
+
+    int status = 0;
+    printf("%-12s %10s %10s %12s\n", "screen", "frame_ms", "flushes", "pixels");
+    for (int s = 0; s < SCREEN_COUNT; ++s) {
+        if (only_screen >= 0 && s != only_screen) {
+            continue;
+        }
+        lv_lock();
+        if (ui_main_set_screen((nova_screen_t)s) != ESP_OK) {
+            lv_unlock();
+            fprintf(stderr, "ui_main_set_screen(%s) failed\n", screen_names[s]);
+            status = 1;
+            continue;
+        }
+        /* Mise en page et premier rendu hors mesure */
+        lv_refr_now(disp);
+        sim_display_reset_stats();
+
+        int64_t total_us = 0;
+        for (uint32_t f = 0; f < frames; ++f) {
+            lv_obj_invalidate(lv_screen_active());
+            int64_t start = esp_timer_get_time();
+            lv_refr_now(disp);
+            total_us += esp_timer_get_time() - start;
+        }
+        lv_unlock();
+
+        sim_display_stats_t stats;
+        sim_display_get_stats(&stats);
+        uint32_t n = frames ? frames : 1;
+        printf("%-12s %10.2f %10.1f %12llu\n", screen_names[s], total_us / 1000.0 / n,
+               (double)stats.flush_calls / n, (unsigned long long)(stats.flush_pixels / n));
+
+        if (dump_dir) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/%s.ppm", dump_dir, screen_names[s]);
+            if (sim_display_dump_ppm(path) != 0) {
+                fprintf(stderr, "cannot write %s\n", path);
+                status = 1;
+            }
+        }
+    }
+
+    lv_lock();
+    ui_main_deinit();
+    lv_unlock();
+    sim_touch_delete();
+    sim_display_delete();
+    lv_deinit();
+    return status;
+}
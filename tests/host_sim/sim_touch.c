@@ -0,0 +1,137 @@
+/**
+ * @file sim_touch.c
+ * @brief Dalle tactile scriptée du simulateur hôte
+ * @author NovaReptileElevage Team
+ */
+
+#include "sim_touch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static lv_indev_t *sim_indev;
+static lv_point_t touch_point;
+static bool touch_pressed;
+
+static void sim_touch_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    (void)indev;
+    data->point = touch_point;
+    data->state = touch_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+lv_indev_t *sim_touch_create(void)
+{
+    if (sim_indev) {
+        return sim_indev;
+    }
+    sim_indev = lv_indev_create();
+    if (!sim_indev) {
+        return NULL;
+    }
+    lv_indev_set_type(sim_indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(sim_indev, sim_touch_read_cb);
+    touch_pressed = false;
+    return sim_indev;
+}
+
+void sim_touch_delete(void)
+{
+    if (sim_indev) {
+        lv_indev_delete(sim_indev);
+        sim_indev = NULL;
+    }
+}
+
+void sim_touch_press(int32_t x, int32_t y)
+{
+    touch_point.x = x;
+    touch_point.y = y;
+    touch_pressed = true;
+}
+
+void sim_touch_release(void)
+{
+    touch_pressed = false;
+}
+
+void sim_touch_click(int32_t x, int32_t y)
+{
+    sim_touch_press(x, y);
+    lv_indev_read(sim_indev);
+    sim_touch_release();
+    lv_indev_read(sim_indev);
+}
+
+lv_indev_t *sim_touch_indev(void)
+{
+    return sim_indev;
+}
+
+void sim_touch_apply(const sim_touch_event_t *event)
+{
+    if (event->kind == SIM_TOUCH_UP) {
+        touch_point.x = event->x;
+        touch_point.y = event->y;
+        sim_touch_release();
+    } else {
+        sim_touch_press(event->x, event->y);
+    }
+}
+
+int sim_touch_trace_load(const char *path, sim_touch_event_t **events, size_t *count)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        return -1;
+    }
+    size_t capacity = 64;
+    size_t n = 0;
+    sim_touch_event_t *list = malloc(capacity * sizeof(*list));
+    char line[128];
+    int ret = list ? 0 : -1;
+    while (ret == 0 && fgets(line, sizeof(line), f)) {
+        char *p = line + strspn(line, " \t");
+        unsigned long t_ms;
+        char kind[8];
+        long x;
+        long y;
+        if (*p == '#' || *p == '\n' || *p == '\0') {
+            continue;
+        }
+        if (sscanf(p, "%lu %7s %ld %ld", &t_ms, kind, &x, &y) != 4 ||
+            (n > 0 && t_ms < list[n - 1].t_ms)) {
+            ret = -1;
+            break;
+        }
+        sim_touch_event_t ev = {.t_ms = (uint32_t)t_ms, .x = (int32_t)x, .y = (int32_t)y};
+        if (strcmp(kind, "down") == 0) {
+            ev.kind = SIM_TOUCH_DOWN;
+        } else if (strcmp(kind, "move") == 0) {
+            ev.kind = SIM_TOUCH_MOVE;
+        } else if (strcmp(kind, "up") == 0) {
+            ev.kind = SIM_TOUCH_UP;
+        } else {
+            ret = -1;
+            break;
+        }
+        if (n == capacity) {
+            sim_touch_event_t *grown = realloc(list, 2 * capacity * sizeof(*list));
+            if (!grown) {
+                ret = -1;
+                break;
+            }
+            list = grown;
+            capacity *= 2;
+        }
+        list[n++] = ev;
+    }
+    fclose(f);
+    if (ret != 0) {
+        free(list);
+        return -1;
+    }
+    *events = list;
+    *count = n;
+    return 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file sim_touch.h
+ * @brief Dalle tactile scriptée du simulateur hôte
+ * @author NovaReptileElevage Team
+ */
+
+#ifndef SIM_TOUCH_H
+#define SIM_TOUCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Événement d'une trace tactile
+ */
+typedef enum {
+    SIM_TOUCH_DOWN,
+    SIM_TOUCH_MOVE,
+    SIM_TOUCH_UP,
+} sim_touch_kind_t;
+
+typedef struct {
+    uint32_t t_ms;          /*!< Instant depuis le début de la trace */
+    sim_touch_kind_t kind;
+    int32_t x;
+    int32_t y;
+} sim_touch_event_t;
+
+/**
+ * @brief Crée le périphérique pointeur LVGL, relâché au départ
+ * @return Périphérique créé, NULL en cas d'échec
+ */
+lv_indev_t *sim_touch_create(void);
+
+void sim_touch_delete(void);
+
+/**
+ * @brief Pose ou déplace le doigt ; lu au prochain passage de LVGL
+ */
+void sim_touch_press(int32_t x, int32_t y);
+
+/**
+ * @brief Lève le doigt à sa dernière position
+ */
+void sim_touch_release(void);
+
+/**
+ * @brief Appui bref : pression, lecture par LVGL, relâchement, lecture
+ */
+void sim_touch_click(int32_t x, int32_t y);
+
+/**
+ * @brief Charge une trace : une ligne "t_ms down|move|up x y" par événement
+ *
+ * Lignes vides et commentaires ('#') ignorés ; instants croissants.
+ * @param[out] events Tableau alloué, à libérer avec free()
+ * @return 0 en cas de succès, -1 si le fichier est illisible ou mal formé
+ */
+int sim_touch_trace_load(const char *path, sim_touch_event_t **events, size_t *count);
+
+/**
+ * @brief Applique un événement de trace à la dalle (lu au prochain passage de LVGL)
+ */
+void sim_touch_apply(const sim_touch_event_t *event);
+
+/**
+ * @brief Périphérique créé par sim_touch_create()
+ */
+lv_indev_t *sim_touch_indev(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_TOUCH_H
@@ -0,0 +1,122 @@
+#pragma once
+
+/*
+ * Rafales 0x814E–0x8176 du GT911 (statut puis 5 emplacements de 8 octets :
+ * track id, X, Y, taille sur 16 bits little-endian, réservé), dans l'ordre
+ * d'une séance : appui, glissé, pincement, relâcher, cinq doigts. Surface
+ * brute 1024 x 600 comme sur la dalle du 7B.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "gt911_frame.h"
+
+typedef struct {
+    const char *name;
+    uint8_t raw[GT911_FRAME_LEN];
+    bool ready;     /* Bit 7 du statut */
+    uint8_t count;  /* Points attendus après décodage */
+} gt911_dump_t;
+
+static const gt911_dump_t gt911_dumps[] = {
+    {"Repos : tampon non prêt",
+        {
+            0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        },
+        false, 0},
+    {"Doigt posé sur une entrée du menu",
+        {
+            0x81,
+            0x00, 0x78, 0x00, 0xD4, 0x00, 0x18, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        },
+        true, 1},
+    {"Même contact, 8 px plus bas",
+        {
+            0x81,
+            0x00, 0x79, 0x00, 0xDC, 0x00, 0x1A, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        },
+        true, 1},
+    {"Second doigt (début de pincement)",
+        {
+            0x82,
+            0x00, 0x82, 0x00, 0xF0, 0x00, 0x1C, 0x00, 0x00,
+            0x01, 0x62, 0x02, 0x2C, 0x01, 0x1F, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        },
+        true, 2},
+    {"Premier doigt levé, le contact 1 reste",
+        {
+            0x81,
+            0x01, 0x56, 0x02, 0x28, 0x01, 0x1E, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        },
+        true, 1},
+    {"Balayage sans nouvelle donnée (bit 7 à 0)",
+        {
+            0x01,
+            0x01, 0x56, 0x02, 0x28, 0x01, 0x1E, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        },
+        false, 0},
+    {"Relâcher",
+        {
+            0x80,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        },
+        true, 0},
+    {"Cinq doigts : coins et centre de l'écran",
+        {
+            0x85,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00,
+            0x01, 0xFF, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x57, 0x02, 0x0C, 0x00, 0x00,
+            0x03, 0xFF, 0x03, 0x57, 0x02, 0x0C, 0x00, 0x00,
+            0x04, 0x00, 0x02, 0x2C, 0x01, 0x28, 0x00, 0x00,
+        },
+        true, 5},
+    {"Grande surface (bit 6), nombre de points hors limites",
+        {
+            0xCA,
+            0x00, 0x90, 0x01, 0xC8, 0x00, 0x2C, 0x01, 0x00,
+            0x01, 0x91, 0x01, 0xC9, 0x00, 0x2C, 0x01, 0x00,
+            0x02, 0x92, 0x01, 0xCA, 0x00, 0x2C, 0x01, 0x00,
+            0x03, 0x93, 0x01, 0xCB, 0x00, 0x2C, 0x01, 0x00,
+            0x04, 0x94, 0x01, 0xCC, 0x00, 0x2C, 0x01, 0x00,
+        },
+        true, 5},
+    {"Relâcher",
+        {
+            0x80,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        },
+        true, 0},
+};
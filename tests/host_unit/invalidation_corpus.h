@@ -0,0 +1,60 @@
+#pragma once
+
+/*
+ * Zones invalidées par trame relevées sur nos écrans (layout 1024x600 :
+ * header 80 px, sidebar 240 px, footer 56 px). Chaque motif correspond à une
+ * mise à jour réelle de l'interface ; max_calls est le nombre de flushs
+ * attendu au plus après fusion avec le coût d'appel par défaut.
+ */
+
+#include <stddef.h>
+#include "lvgl.h"
+
+#define CORPUS_MAX_AREAS 12
+
+typedef struct {
+    const char *name;
+    lv_area_t areas[CORPUS_MAX_AREAS];
+    size_t count;
+    size_t max_calls;
+} invalidation_pattern_t;
+
+static const invalidation_pattern_t invalidation_corpus[] = {
+    /* ui_header_set_time() : ancien et nouveau texte du label */
+    {"header clock", {{839, 28, 893, 51}, {843, 28, 893, 51}}, 2, 1},
+    /* Tic 1 Hz : heure du header, date/heure et infos système du footer */
+    {"status tick", {{839, 28, 893, 51}, {602, 564, 756, 579}, {776, 564, 1013, 579}}, 3, 2},
+    /* ui_footer_set_wifi_status() + indicateur de connexion du header */
+    {"wifi change", {{10, 564, 29, 579}, {34, 564, 150, 579}, {807, 34, 818, 45}}, 3, 2},
+    /* Nouvelle alerte : compteur du footer et carte "Alertes Actives" */
+    {"alert raised", {{463, 564, 582, 579}, {718, 174, 833, 203}}, 2, 2},
+    /* Rafraîchissement des 8 valeurs du tableau de bord (5 cartes par ligne) */
+    {"dashboard values",
+     {{268, 174, 383, 203}, {418, 174, 533, 203}, {568, 174, 683, 203}, {718, 174, 833, 203},
+      {868, 174, 983, 203}, {268, 264, 383, 293}, {418, 264, 533, 293}, {568, 264, 683, 293}},
+     8, 2},
+    /* Tableau de bord + tic 1 Hz dans la même trame */
+    {"dashboard + tick",
+     {{268, 174, 383, 203}, {418, 174, 533, 203}, {568, 174, 683, 203}, {718, 174, 833, 203},
+      {868, 174, 983, 203}, {268, 264, 383, 293}, {418, 264, 533, 293}, {568, 264, 683, 293},
+      {839, 28, 893, 51}, {602, 564, 756, 579}, {776, 564, 1013, 579}},
+     11, 4},
+    /* Navigation : deux entrées de sidebar et la zone de contenu */
+    {"sidebar navigation", {{12, 92, 227, 141}, {12, 152, 227, 201}, {240, 80, 1023, 543}}, 3, 3},
+    /* Défilement de 40 px de la liste : chaque carte à l'ancienne et à la nouvelle position */
+    {"list scroll",
+     {{256, 96, 1007, 167}, {256, 56, 1007, 127}, {256, 178, 1007, 249}, {256, 138, 1007, 209},
+      {256, 260, 1007, 331}, {256, 220, 1007, 291}},
+     6, 1},
+    /* Appui sur le bouton profil */
+    {"button press", {{914, 20, 953, 59}}, 1, 1},
+    /* Pastilles d'état de 6 terrariums (grille 3 colonnes) : trop éloignées pour être fusionnées */
+    {"terrarium status",
+     {{426, 156, 485, 180}, {680, 156, 739, 180}, {934, 156, 993, 180},
+      {426, 276, 485, 300}, {680, 276, 739, 300}, {934, 276, 993, 300}},
+     6, 6},
+    /* Chargement d'écran pendant un tic : tout est couvert par le plein écran */
+    {"screen load", {{0, 0, 1023, 599}, {839, 28, 893, 51}, {776, 564, 1013, 579}}, 3, 1},
+};
+
+#define INVALIDATION_CORPUS_COUNT (sizeof(invalidation_corpus) / sizeof(invalidation_corpus[0]))
@@ -0,0 +1,91 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "display_area_merge.h"
+#include "display_driver.h"
+#include "invalidation_corpus.h"
+
+static bool contains(const lv_area_t *outer, const lv_area_t *inner)
+{
+    return inner->x1 >= outer->x1 && inner->x2 <= outer->x2 &&
+           inner->y1 >= outer->y1 && inner->y2 <= outer->y2;
+}
+
+static uint64_t total_cost(const lv_area_t *areas, size_t count, uint32_t call_cost_px)
+{
+    uint64_t cost = 0;
+    for (size_t i = 0; i < count; ++i) {
+        cost += display_area_merge_cost(&areas[i], call_cost_px);
+    }
+    return cost;
+}
+
+static void check_pattern(const invalidation_pattern_t *p, uint32_t call_cost_px, bool report)
+{
+    lv_area_t areas[CORPUS_MAX_AREAS];
+    memcpy(areas, p->areas, p->count * sizeof(lv_area_t));
+    size_t count = display_area_merge(areas, p->count, call_cost_px);
+
+    assert(count >= 1 && count <= p->count);
+    /* Every invalidated area must still be flushed */
+    for (size_t i = 0; i < p->count; ++i) {
+        bool covered = false;
+        for (size_t j = 0; j < count && !covered; ++j) {
+            covered = contains(&areas[j], &p->areas[i]);
+        }
+        assert(covered);
+    }
+    /* Merging never makes the frame more expensive */
+    uint64_t before = total_cost(p->areas, p->count, call_cost_px);
+    uint64_t after = total_cost(areas, count, call_cost_px);
+    assert(after <= before);
+    /* The result is a fixed point */
+    lv_area_t again[CORPUS_MAX_AREAS];
+    memcpy(again, areas, count * sizeof(lv_area_t));
+    assert(display_area_merge(again, count, call_cost_px) == count);
+
+    if (report) {
+        assert(count <= p->max_calls);
+        printf("  %-20s calls %2zu -> %2zu  cost %7llu -> %7llu\n", p->name, p->count, count,
+               (unsigned long long)before, (unsigned long long)after);
+    }
+}
+
+int main(void)
+{
+    /* Far-apart areas stay separate, abutting ones join for any call overhead */
+    lv_area_t pair[2] = {{0, 0, 9, 9}, {500, 500, 509, 509}};
+    assert(display_area_merge(pair, 2, DISPLAY_AREA_MERGE_CALL_COST_PX) == 2);
+    lv_area_t adjacent[2] = {{0, 0, 99, 9}, {0, 10, 99, 19}};
+    assert(display_area_merge(adjacent, 2, 0) == 2);
+    assert(display_area_merge(adjacent, 2, 1) == 1);
+    assert(adjacent[0].x1 == 0 && adjacent[0].y1 == 0 && adjacent[0].x2 == 99 && adjacent[0].y2 == 19);
+
+    /* A merge that covers a third area absorbs it */
+    lv_area_t absorb[3] = {{0, 0, 79, 79}, {20, 20, 99, 99}, {85, 5, 95, 15}};
+    assert(display_area_merge(absorb, 3, DISPLAY_AREA_MERGE_CALL_COST_PX) == 1);
+
+    assert(display_area_merge(NULL, 3, 0) == 0);
+
+    printf("Area merge corpus (call cost %d px)\n", DISPLAY_AREA_MERGE_CALL_COST_PX);
+    size_t calls_before = 0;
+    size_t calls_after = 0;
+    for (size_t i = 0; i < INVALIDATION_CORPUS_COUNT; ++i) {
+        const invalidation_pattern_t *p = &invalidation_corpus[i];
+        check_pattern(p, DISPLAY_AREA_MERGE_CALL_COST_PX, true);
+        /* Invariants must hold for any cost setting */
+        check_pattern(p, 0, false);
+        check_pattern(p, 100000, false);
+
+        lv_area_t areas[CORPUS_MAX_AREAS];
+        memcpy(areas, p->areas, p->count * sizeof(lv_area_t));
+        calls_before += p->count;
+        calls_after += display_area_merge(areas, p->count, DISPLAY_AREA_MERGE_CALL_COST_PX);
+    }
+    printf("  total flush calls %zu -> %zu\n", calls_before, calls_after);
+    assert(calls_after < calls_before);
+
+    puts("Area merge test passed");
+    return 0;
+}
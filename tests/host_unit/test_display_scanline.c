@@ -0,0 +1,157 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "display_scanline.h"
+
+/* ST7701 timing of components/st7701_rgb at the nominal 30 MHz pixel clock */
+static const display_scanline_timing_t timing = {
+    .pclk_hz = 30 * 1000 * 1000,
+    .h_total = 1024 + 10 + 160 + 160,
+    .v_total = 600 + 1 + 23 + 12,
+    .v_active_start = 1 + 23,
+    .v_res = 600,
+};
+
+#define GUARD_LINES 4
+
+/* Time since VSYNC at which the beam starts active line y */
+static uint32_t at_line(int32_t y)
+{
+    uint64_t line_ns = (uint64_t)timing.h_total * 1000000000ull / timing.pclk_hz;
+    return (uint32_t)(((uint64_t)(timing.v_active_start + y) * line_ns + 999) / 1000);
+}
+
+/* Does the beam scan one of the rows y1..y2 during [start, start + copy_us]? */
+static bool beam_crosses(uint32_t start, uint32_t copy_us, int32_t y1, int32_t y2)
+{
+    for (uint32_t t = start; t <= start + copy_us; t += 10) {
+        int32_t line = display_scanline_position(&timing, t);
+        if (line >= y1 && line <= y2) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t rng_next(void)
+{
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+/*
+ * Scrolling the reptile list: rows 100..539 are re-rendered every frame in
+ * 150-line draw buffers, then copied into the scanned framebuffer.
+ */
+static void simulate_scroll(bool planned, uint32_t *tears, uint32_t *mean_wait, uint32_t *max_wait)
+{
+    const uint32_t frame_us = display_scanline_frame_us(&timing);
+    const uint32_t render_us_per_line = 20;
+    const uint32_t copy_ns_per_px = 50;
+    const int32_t list_y1 = 100;
+    const int32_t list_y2 = 539;
+    const int32_t band_lines = 150;
+    const uint32_t frames = 500;
+    uint64_t total_wait = 0;
+
+    *tears = 0;
+    *max_wait = 0;
+    for (uint32_t f = 0; f < frames; ++f) {
+        uint32_t now = rng_next() % frame_us;
+        uint32_t frame_wait = 0;
+        for (int32_t y1 = list_y1; y1 <= list_y2; y1 += band_lines) {
+            int32_t y2 = y1 + band_lines - 1 > list_y2 ? list_y2 : y1 + band_lines - 1;
+            uint32_t lines = (uint32_t)(y2 - y1 + 1);
+            uint32_t copy_us = (uint32_t)((uint64_t)lines * 1024 * copy_ns_per_px / 1000) + 1;
+            now += lines * render_us_per_line;
+            if (planned) {
+                display_scanline_plan_t plan;
+                display_scanline_plan(&timing, now, y1, y2, copy_us, GUARD_LINES, &plan);
+                assert(!plan.unavoidable);
+                now += plan.wait_us;
+                frame_wait += plan.wait_us;
+            }
+            *tears += beam_crosses(now, copy_us, y1, y2);
+            now += copy_us;
+        }
+        total_wait += frame_wait;
+        if (frame_wait > *max_wait) {
+            *max_wait = frame_wait;
+        }
+    }
+    *mean_wait = (uint32_t)(total_wait / frames);
+}
+
+int main(void)
+{
+    display_scanline_plan_t plan;
+    const uint32_t frame_us = display_scanline_frame_us(&timing);
+    /* 1354 clocks x 636 lines at 30 MHz */
+    assert(frame_us == 28704);
+
+    /* Beam position: back porch, first and last active lines, front porch */
+    assert(display_scanline_position(&timing, 0) == -timing.v_active_start);
+    assert(display_scanline_position(&timing, at_line(0)) == 0);
+    assert(display_scanline_position(&timing, at_line(599)) == 599);
+    assert(display_scanline_position(&timing, at_line(605)) == 605);
+    assert(display_scanline_position(&timing, frame_us + 1 + at_line(10)) == 10);
+
+    /* The beam stays clear of the area during the copy: no delay */
+    display_scanline_plan(&timing, at_line(100), 500, 559, 3000, GUARD_LINES, &plan);
+    assert(!plan.crossing && plan.wait_us == 0);
+    /* Area already scanned this frame, copy done before the next pass */
+    display_scanline_plan(&timing, at_line(300), 0, 59, 3000, GUARD_LINES, &plan);
+    assert(!plan.crossing && plan.wait_us == 0);
+
+    /* The beam would reach the area during the copy: start once it has passed */
+    display_scanline_plan(&timing, at_line(480), 500, 559, 3000, GUARD_LINES, &plan);
+    assert(plan.crossing && !plan.unavoidable);
+    assert(display_scanline_position(&timing, at_line(480) + plan.wait_us) == 559 + 1 + GUARD_LINES);
+    assert(!beam_crosses(at_line(480) + plan.wait_us, 3000, 500, 559));
+
+    /* Beam inside the area */
+    display_scanline_plan(&timing, at_line(520), 500, 559, 1000, GUARD_LINES, &plan);
+    assert(plan.crossing);
+    assert(display_scanline_position(&timing, at_line(520) + plan.wait_us) == 559 + 1 + GUARD_LINES);
+
+    /* Copy running into the next frame: wait for the next pass over the area */
+    display_scanline_plan(&timing, at_line(590), 0, 59, 3000, GUARD_LINES, &plan);
+    assert(plan.crossing && plan.wait_us > frame_us - at_line(590));
+    assert(display_scanline_position(&timing, at_line(590) + plan.wait_us) == 59 + 1 + GUARD_LINES);
+    assert(!beam_crosses(at_line(590) + plan.wait_us, 3000, 0, 59));
+
+    /* Full-screen copy longer than the blanking: no safe window, no delay */
+    display_scanline_plan(&timing, at_line(100), 0, 599, 12000, GUARD_LINES, &plan);
+    assert(plan.crossing && plan.unavoidable && plan.wait_us == 0);
+
+    /* Unknown timing: copy at once */
+    const display_scanline_timing_t none = {0};
+    display_scanline_plan(&none, 1000, 0, 59, 3000, GUARD_LINES, &plan);
+    assert(!plan.crossing && plan.wait_us == 0);
+    assert(display_scanline_frame_us(&none) == 0);
+
+    /* Scrolling list: tearing without the schedule, none with it */
+    uint32_t tears_free;
+    uint32_t tears_planned;
+    uint32_t mean_free;
+    uint32_t max_free;
+    uint32_t mean_wait;
+    uint32_t max_wait;
+    simulate_scroll(false, &tears_free, &mean_free, &max_free);
+    rng_state = 12345;
+    simulate_scroll(true, &tears_planned, &mean_wait, &max_wait);
+    assert(tears_free > 0);
+    assert(tears_planned == 0);
+    assert(max_wait < 2 * frame_us);
+
+    printf("scroll, 500 frames: %u torn copies unsynchronized, %u synchronized\n",
+           tears_free, tears_planned);
+    printf("added latency per frame: mean %u us, max %u us "
+           "(direct mode swap: mean %u us, max %u us)\n",
+           mean_wait, max_wait, frame_us / 2, frame_us);
+    puts("Scanline schedule test passed");
+    return 0;
+}
@@ -0,0 +1,157 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "gt911_dumps.h"
+#include "gt911_frame.h"
+
+#define DUMP_COUNT (sizeof(gt911_dumps) / sizeof(gt911_dumps[0]))
+
+/* Controller model: serves one dump per burst read, counts transactions */
+typedef struct {
+    const gt911_dump_t *dump;
+    uint32_t transactions;
+    uint32_t clears;
+    int fail_read;
+    int fail_write;
+} mock_gt911_t;
+
+static int mock_transmit_receive(void *ctx, const uint8_t *tx, size_t tx_len, uint8_t *rx, size_t rx_len)
+{
+    mock_gt911_t *m = ctx;
+    m->transactions++;
+    assert(tx_len == 2 && tx[0] == 0x81 && tx[1] == 0x4E);
+    assert(rx_len == GT911_FRAME_LEN);
+    if (m->fail_read) {
+        return m->fail_read;
+    }
+    memcpy(rx, m->dump->raw, rx_len);
+    return 0;
+}
+
+static int mock_transmit(void *ctx, const uint8_t *tx, size_t tx_len)
+{
+    mock_gt911_t *m = ctx;
+    m->transactions++;
+    assert(tx_len == GT911_FRAME_TX_LEN && tx[0] == 0x81 && tx[1] == 0x4E && tx[2] == 0);
+    m->clears++;
+    return m->fail_write;
+}
+
+/* Previous driver: status read, points read and status clear when touched */
+static uint32_t legacy_transactions(const gt911_dump_t *dump)
+{
+    uint8_t status = dump->raw[0];
+    return (status & 0x80) && (status & 0x0F) ? 3 : 1;
+}
+
+static void test_scale_exact(void)
+{
+    static const uint16_t maxima[] = {100, 599, 600, 777, 1023, 1024, 2048, 4095};
+    static const uint16_t sizes[] = {600, 1024};
+
+    for (size_t m = 0; m < sizeof(maxima) / sizeof(maxima[0]); ++m) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+            gt911_scale_t scale;
+            uint8_t raw[GT911_FRAME_LEN] = {0x81};
+            touch_frame_t frame;
+
+            gt911_scale_init(&scale, maxima[m], maxima[m], sizes[s], sizes[s]);
+            for (uint32_t x = 0; x < 4096; ++x) {
+                uint32_t expected = x * sizes[s] / maxima[m];
+                if (expected >= sizes[s]) {
+                    expected = sizes[s] - 1u;
+                }
+                raw[2] = (uint8_t)x;
+                raw[3] = (uint8_t)(x >> 8);
+                raw[4] = (uint8_t)x;
+                raw[5] = (uint8_t)(x >> 8);
+                assert(gt911_frame_decode(raw, &scale, &frame) && frame.count == 1);
+                assert(frame.points[0].x == expected && frame.points[0].y == expected);
+            }
+        }
+    }
+}
+
+static void test_replay(void)
+{
+    uint8_t rx[GT911_FRAME_LEN];
+    uint8_t tx[GT911_FRAME_TX_LEN];
+    mock_gt911_t mock = {0};
+    gt911_reader_t reader = {
+        .bus = {mock_transmit_receive, mock_transmit, &mock},
+        .rx = rx,
+        .tx = tx,
+    };
+    uint32_t frames = 0;
+    uint32_t transactions = 0;
+    uint32_t legacy = 0;
+
+    gt911_scale_init(&reader.scale, 1024, 600, 1024, 600);
+    for (size_t i = 0; i < DUMP_COUNT; ++i) {
+        const gt911_dump_t *dump = &gt911_dumps[i];
+        touch_frame_t frame;
+        bool ready;
+
+        mock.dump = dump;
+        mock.transactions = 0;
+        assert(gt911_frame_read(&reader, &frame, &ready) == 0);
+        assert(ready == dump->ready);
+        /* One burst; the clear only when there was a frame to acknowledge */
+        assert(mock.transactions == (dump->ready ? 2u : 1u));
+        if (!ready) {
+            continue;
+        }
+        assert(frame.count == dump->count);
+        for (uint8_t p = 0; p < frame.count; ++p) {
+            const uint8_t *slot = &dump->raw[1 + p * 8];
+            assert(frame.points[p].track_id == slot[0]);
+            assert(frame.points[p].x == (slot[1] | slot[2] << 8));
+            assert(frame.points[p].y == (slot[3] | slot[4] << 8));
+            uint16_t size = (uint16_t)(slot[5] | slot[6] << 8);
+            assert(frame.points[p].size == (size > 255 ? 255 : size));
+        }
+        if (frame.count) {
+            ++frames;
+            transactions += mock.transactions;
+            legacy += legacy_transactions(dump);
+        }
+    }
+    assert(mock.clears == 8);
+    printf("%u touch frames: %.2f bus transactions per frame (previously %.2f)\n", (unsigned)frames,
+           (double)transactions / frames, (double)legacy / frames);
+}
+
+static void test_bus_errors(void)
+{
+    uint8_t rx[GT911_FRAME_LEN];
+    uint8_t tx[GT911_FRAME_TX_LEN];
+    mock_gt911_t mock = {.dump = &gt911_dumps[1]};
+    gt911_reader_t reader = {
+        .bus = {mock_transmit_receive, mock_transmit, &mock},
+        .rx = rx,
+        .tx = tx,
+    };
+    touch_frame_t frame;
+    bool ready = true;
+
+    gt911_scale_init(&reader.scale, 0, 0, 1024, 600);
+    mock.fail_read = 0x107;
+    assert(gt911_frame_read(&reader, &frame, &ready) == 0x107 && !ready);
+    assert(mock.transactions == 1 && mock.clears == 0);
+
+    /* A failed acknowledge reports the error: the frame will be read again */
+    mock.fail_read = 0;
+    mock.fail_write = -1;
+    assert(gt911_frame_read(&reader, &frame, &ready) == -1 && !ready);
+}
+
+int main(void)
+{
+    test_scale_exact();
+    test_replay();
+    test_bus_errors();
+    puts("GT911 frame test passed");
+    return 0;
+}
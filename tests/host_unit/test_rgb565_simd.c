@@ -0,0 +1,65 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rgb565_simd.h"
+
+#define BUF_PX     (96 * 8 + 16)
+#define ITERATIONS 4000
+
+static uint16_t ref_buf[BUF_PX];
+static uint16_t opt_buf[BUF_PX];
+static uint16_t src_buf[BUF_PX];
+
+static uint16_t rand_color(void)
+{
+    /* Mostly a handful of UI colors so equal-pixel runs occur, like real screens */
+    static const uint16_t palette[] = {0x0000, 0xFFFF, 0x2945, 0x07E0, 0xF800, 0x001F};
+    if (rand() % 4) {
+        return palette[rand() % (int)(sizeof(palette) / sizeof(palette[0]))];
+    }
+    return (uint16_t)rand();
+}
+
+static void fill_background(void)
+{
+    for (size_t i = 0; i < BUF_PX; i++) {
+        ref_buf[i] = (i / 7) % 3 ? 0x2945 : rand_color();
+        src_buf[i] = rand_color();
+    }
+    memcpy(opt_buf, ref_buf, sizeof(ref_buf));
+}
+
+int main(void)
+{
+    srand(1234);
+    for (int it = 0; it < ITERATIONS; it++) {
+        int32_t w = rand() % 97;
+        int32_t h = 1 + rand() % 6;
+        int32_t stride = w + rand() % 9;
+        int32_t off = rand() % 8;
+        int32_t src_off = rand() % 8;
+        int32_t src_stride = w + rand() % 9;
+        uint16_t color = rand_color();
+        if ((off + (h - 1) * stride + w) > BUF_PX || (src_off + (h - 1) * src_stride + w) > BUF_PX) {
+            continue;
+        }
+
+        fill_background();
+        if (it % 2 == 0) {
+            rgb565_fill_ref(ref_buf + off, w, h, stride, color);
+            rgb565_fill(opt_buf + off, w, h, stride, color);
+        } else {
+            rgb565_copy_ref(ref_buf + off, stride, src_buf + src_off, src_stride, w, h);
+            rgb565_copy(opt_buf + off, stride, src_buf + src_off, src_stride, w, h);
+        }
+        /* Whole buffer compared: nothing outside the area may be touched either */
+        if (memcmp(ref_buf, opt_buf, sizeof(ref_buf)) != 0) {
+            fprintf(stderr, "kernel %d mismatch: w=%d h=%d stride=%d off=%d\n",
+                    it % 2, (int)w, (int)h, (int)stride, (int)off);
+            return 1;
+        }
+    }
+
+    puts("RGB565 kernel bit-exactness test passed");
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "st7701_cmd_stream.h"
+#include "st7701_init_cmds.h"
+
+#define MAX_WIRE 1024
+
+/* Bytes seen on the command bus, in order; bit 8 = DC level */
+static struct {
+    uint16_t wire[MAX_WIRE];
+    size_t wire_len;
+    uint16_t delays[8];
+    size_t delay_count;
+    size_t fail_at;     /* 1-based call failing with ESP_FAIL, 0 = never */
+    size_t calls;
+} bus;
+
+void vTaskDelay(TickType_t ticks)
+{
+    assert(bus.delay_count < sizeof(bus.delays) / sizeof(bus.delays[0]));
+    bus.delays[bus.delay_count++] = (uint16_t)ticks;
+}
+
+static void wire_out(uint16_t *wire, size_t *len, int dc, const uint8_t *bytes, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        assert(*len < MAX_WIRE);
+        wire[(*len)++] = (uint16_t)((dc << 8) | bytes[i]);
+    }
+}
+
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param,
+                                    size_t param_size)
+{
+    (void)io;
+    if (++bus.calls == bus.fail_at) {
+        return ESP_FAIL;
+    }
+    const uint8_t cmd = (uint8_t)lcd_cmd;
+    wire_out(bus.wire, &bus.wire_len, 0, &cmd, 1);
+    wire_out(bus.wire, &bus.wire_len, 1, param, param_size);
+    return ESP_OK;
+}
+
+static esp_lcd_panel_io_handle_t fake_io(void)
+{
+    static int io;
+    return (esp_lcd_panel_io_handle_t)&io;
+}
+
+int main(void)
+{
+    /* Expected bus content: every entry of the table, in order */
+    static uint16_t expected[MAX_WIRE];
+    size_t expected_len = 0;
+    uint16_t expected_delays[8];
+    size_t delays = 0;
+    for (size_t i = 0; i < ST7701_INIT_CMD_COUNT; ++i) {
+        const st7701_cmd_t *cmd = &st7701_init_cmds[i];
+        wire_out(expected, &expected_len, 0, &cmd->cmd, 1);
+        wire_out(expected, &expected_len, 1, cmd->data, cmd->data_bytes);
+        if (cmd->delay_ms) {
+            expected_delays[delays++] = (uint16_t)pdMS_TO_TICKS(cmd->delay_ms);
+        }
+    }
+
+    assert(st7701_cmd_stream_run(fake_io(), st7701_init_cmds, ST7701_INIT_CMD_COUNT) == ESP_OK);
+    assert(bus.calls == ST7701_INIT_CMD_COUNT);
+    assert(bus.wire_len == expected_len);
+    assert(memcmp(bus.wire, expected, sizeof(uint16_t) * expected_len) == 0);
+    /* SWRESET, 0xD0, SLPOUT and DISPON */
+    assert(bus.delay_count == delays && delays == 4);
+    assert(memcmp(bus.delays, expected_delays, sizeof(uint16_t) * delays) == 0);
+
+    /* An entry with parameters but no data is rejected before anything is sent. */
+    const st7701_cmd_t broken[] = {
+        ST7701_CMD(0xC0, 2, 0, 0x3B, 0x00),
+        {.cmd = 0xC1, .data = NULL, .data_bytes = 2},
+    };
+    memset(&bus, 0, sizeof(bus));
+    assert(st7701_cmd_stream_run(fake_io(), broken, 2) == ESP_ERR_INVALID_ARG);
+    assert(st7701_cmd_stream_run(fake_io(), st7701_init_cmds, 0) == ESP_ERR_INVALID_ARG);
+    assert(bus.calls == 0);
+
+    /* A bus error stops the table at once. */
+    memset(&bus, 0, sizeof(bus));
+    bus.fail_at = 5;
+    assert(st7701_cmd_stream_run(fake_io(), st7701_init_cmds, ST7701_INIT_CMD_COUNT) == ESP_FAIL);
+    assert(bus.calls == 5);
+
+    printf("%u commands, %u bytes on the bus, %u delays\n", (unsigned)ST7701_INIT_CMD_COUNT,
+           (unsigned)expected_len, (unsigned)delays);
+    puts("ST7701 command stream test passed");
+    return 0;
+}
@@ -0,0 +1,339 @@
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "touch_filter.h"
+#include "touch_traces.h"
+
+/* Interrupt to displayed frame, the prediction horizon under test */
+#define RENDER_LATENCY_US 20000
+/* Lag search window and step */
+#define LAG_MIN_US  (-30000)
+#define LAG_MAX_US  60000
+#define LAG_STEP_US 250
+
+#define MAX_SAMPLES 512
+
+enum { STAGE_RAW, STAGE_SMOOTH, STAGE_PREDICT, STAGE_COUNT };
+static const char *stage_names[STAGE_COUNT] = {"raw", "smooth", "predict"};
+static const char *filter_names[] = {"none", "1euro", "kalman"};
+
+typedef struct {
+    double lag_ms;     /* Behind the finger at display time, negative = ahead */
+    double error_px;   /* RMS distance to the finger at display time */
+    double jitter_px;  /* Frame-to-frame noise: RMS second difference / sqrt(6) */
+} metrics_t;
+
+typedef struct {
+    size_t count;
+    double t[MAX_SAMPLES];
+    double rx[MAX_SAMPLES];  /* Zero-lag reference: centred mean of the raw samples */
+    double ry[MAX_SAMPLES];
+} reference_t;
+
+static void reference_build(reference_t *ref, const touch_trace_sample_t *s, size_t count)
+{
+    ref->count = count;
+    for (size_t k = 0; k < count; ++k) {
+        size_t half = k < 2 ? k : 2;
+        if (count - 1 - k < half) {
+            half = count - 1 - k;
+        }
+        double x = 0;
+        double y = 0;
+        for (size_t j = k - half; j <= k + half; ++j) {
+            x += s[j].x;
+            y += s[j].y;
+        }
+        ref->t[k] = s[k].t_us;
+        ref->rx[k] = x / (double)(2 * half + 1);
+        ref->ry[k] = y / (double)(2 * half + 1);
+    }
+}
+
+/* Reference position at time t, false outside the trace */
+static int reference_at(const reference_t *ref, double t, double *x, double *y)
+{
+    if (t < ref->t[0] || t > ref->t[ref->count - 1]) {
+        return 0;
+    }
+    size_t k = 0;
+    while (k + 1 < ref->count && ref->t[k + 1] < t) {
+        ++k;
+    }
+    if (k + 1 == ref->count) {
+        *x = ref->rx[k];
+        *y = ref->ry[k];
+        return 1;
+    }
+    double u = (t - ref->t[k]) / (ref->t[k + 1] - ref->t[k]);
+    *x = ref->rx[k] + u * (ref->rx[k + 1] - ref->rx[k]);
+    *y = ref->ry[k] + u * (ref->ry[k + 1] - ref->ry[k]);
+    return 1;
+}
+
+/* Squared distance to the finger, lag microseconds before display time */
+static double mean_square_error(const reference_t *ref, const double *ox, const double *oy,
+                                int32_t lag, size_t *count)
+{
+    double sum = 0;
+    size_t n = 0;
+    for (size_t k = 0; k < ref->count; ++k) {
+        double x;
+        double y;
+        if (reference_at(ref, ref->t[k] + RENDER_LATENCY_US - lag, &x, &y)) {
+            sum += (ox[k] - x) * (ox[k] - x) + (oy[k] - y) * (oy[k] - y);
+            ++n;
+        }
+    }
+    *count = n;
+    return n ? sum / (double)n : INFINITY;
+}
+
+static metrics_t measure(const reference_t *ref, const double *ox, const double *oy)
+{
+    metrics_t m = {0, 0, 0};
+    size_t n;
+
+    /* Lag: the shift that best aligns what is displayed with where the finger was */
+    double best = INFINITY;
+    for (int32_t lag = LAG_MIN_US; lag <= LAG_MAX_US; lag += LAG_STEP_US) {
+        double mse = mean_square_error(ref, ox, oy, lag, &n);
+        if (n * 2 >= ref->count && mse < best) {
+            best = mse;
+            m.lag_ms = lag / 1000.0;
+        }
+    }
+    /* Error: what the user sees, the content against the finger on screen */
+    m.error_px = sqrt(mean_square_error(ref, ox, oy, 0, &n));
+
+    /* Jitter: white noise of deviation s has a second difference of variance 6 s^2 */
+    double sum = 0;
+    for (size_t k = 2; k < ref->count; ++k) {
+        double ax = ox[k] - 2 * ox[k - 1] + ox[k - 2];
+        double ay = oy[k] - 2 * oy[k - 1] + oy[k - 2];
+        sum += (ax * ax + ay * ay) / 2;
+    }
+    m.jitter_px = ref->count > 2 ? sqrt(sum / (double)(ref->count - 2) / 6) : 0;
+    return m;
+}
+
+typedef struct {
+    double x[STAGE_COUNT][MAX_SAMPLES];
+    double y[STAGE_COUNT][MAX_SAMPLES];
+    metrics_t m[STAGE_COUNT];
+} replay_t;
+
+static void replay(touch_filter_kind_t kind, const touch_trace_sample_t *s, size_t count,
+                   const reference_t *ref, replay_t *r)
+{
+    touch_filter_config_t cfg;
+    touch_filter_t filter;
+
+    assert(count <= MAX_SAMPLES);
+    touch_filter_default_config(kind, RENDER_LATENCY_US, &cfg);
+    touch_filter_init(&filter, &cfg);
+    for (size_t k = 0; k < count; ++k) {
+        touch_filter_out_t out;
+        touch_filter_update(&filter, s[k].t_us, s[k].x, s[k].y, &out);
+        r->x[STAGE_RAW][k] = s[k].x;
+        r->y[STAGE_RAW][k] = s[k].y;
+        r->x[STAGE_SMOOTH][k] = out.smooth_x;
+        r->y[STAGE_SMOOTH][k] = out.smooth_y;
+        r->x[STAGE_PREDICT][k] = out.x;
+        r->y[STAGE_PREDICT][k] = out.y;
+    }
+    for (int stage = 0; stage < STAGE_COUNT; ++stage) {
+        r->m[stage] = measure(ref, r->x[stage], r->y[stage]);
+    }
+}
+
+static void report(const char *trace, touch_filter_kind_t kind, const replay_t *r)
+{
+    int first = kind == TOUCH_FILTER_NONE ? STAGE_RAW : STAGE_SMOOTH;
+    int last = kind == TOUCH_FILTER_NONE ? STAGE_RAW : STAGE_PREDICT;
+    for (int stage = first; stage <= last; ++stage) {
+        printf("%-12s %-7s %-8s lag %6.2f ms  error %5.2f px  jitter %5.2f px\n", trace,
+               filter_names[kind], stage_names[stage], r->m[stage].lag_ms, r->m[stage].error_px,
+               r->m[stage].jitter_px);
+    }
+}
+
+static replay_t replays[3];
+
+static void check_trace(const touch_trace_t *trace)
+{
+    static reference_t ref;
+    reference_build(&ref, trace->samples, trace->count);
+
+    for (int kind = TOUCH_FILTER_NONE; kind <= TOUCH_FILTER_KALMAN; ++kind) {
+        replay((touch_filter_kind_t)kind, trace->samples, trace->count, &ref, &replays[kind]);
+        report(trace->name, (touch_filter_kind_t)kind, &replays[kind]);
+    }
+
+    const metrics_t *raw = &replays[TOUCH_FILTER_NONE].m[STAGE_RAW];
+    for (int kind = TOUCH_FILTER_ONE_EURO; kind <= TOUCH_FILTER_KALMAN; ++kind) {
+        const metrics_t *smooth = &replays[kind].m[STAGE_SMOOTH];
+        const metrics_t *predict = &replays[kind].m[STAGE_PREDICT];
+        if (strcmp(trace->name, "hold") == 0) {
+            /* A resting finger: most of the noise is gone and nothing is predicted */
+            assert(smooth->jitter_px < raw->jitter_px * 0.6);
+            assert(predict->jitter_px == smooth->jitter_px);
+            continue;
+        }
+        /* Moving: raw coordinates are a whole render latency behind at display time */
+        assert(raw->lag_ms > RENDER_LATENCY_US / 1000.0 * 0.75);
+        /* Prediction wins back at least half of it, without amplifying the noise */
+        assert(predict->lag_ms < raw->lag_ms - RENDER_LATENCY_US / 1000.0 / 2);
+        assert(predict->error_px < raw->error_px * 0.75);
+        assert(predict->jitter_px < raw->jitter_px * 1.25);
+    }
+}
+
+/* The drag stops at y = 400: the predicted point must not fly past it */
+static void check_stop_overshoot(void)
+{
+    const touch_trace_t *trace = NULL;
+    for (size_t i = 0; i < sizeof(touch_traces) / sizeof(touch_traces[0]); ++i) {
+        if (strcmp(touch_traces[i].name, "drag_stop") == 0) {
+            trace = &touch_traces[i];
+        }
+    }
+    assert(trace);
+
+    for (int kind = TOUCH_FILTER_ONE_EURO; kind <= TOUCH_FILTER_KALMAN; ++kind) {
+        touch_filter_config_t cfg;
+        touch_filter_t filter;
+        double overshoot = 0;
+        touch_filter_default_config((touch_filter_kind_t)kind, RENDER_LATENCY_US, &cfg);
+        touch_filter_init(&filter, &cfg);
+        for (size_t k = 0; k < trace->count; ++k) {
+            touch_filter_out_t out;
+            touch_filter_update(&filter, trace->samples[k].t_us, trace->samples[k].x,
+                                trace->samples[k].y, &out);
+            if (out.y - 400 > overshoot) {
+                overshoot = out.y - 400;
+            }
+        }
+        printf("%-12s %-7s overshoot %.0f px\n", trace->name, filter_names[kind], overshoot);
+        assert(overshoot <= 10);
+    }
+}
+
+static void test_fixed_point_stages(void)
+{
+    touch_filter_config_t cfg;
+    touch_filter_t filter;
+    touch_filter_out_t out;
+
+    /* No filter: coordinates pass through, no velocity, no lead */
+    touch_filter_default_config(TOUCH_FILTER_NONE, RENDER_LATENCY_US, &cfg);
+    assert(cfg.horizon_us == 0);
+    touch_filter_init(&filter, &cfg);
+    touch_filter_update(&filter, 0, 100, 200, &out);
+    touch_filter_update(&filter, 10000, 150, 180, &out);
+    assert(out.x == 150 && out.y == 180 && out.smooth_x == 150 && out.vx == 0);
+
+    for (int kind = TOUCH_FILTER_ONE_EURO; kind <= TOUCH_FILTER_KALMAN; ++kind) {
+        touch_filter_default_config((touch_filter_kind_t)kind, RENDER_LATENCY_US, &cfg);
+        touch_filter_init(&filter, &cfg);
+
+        /* First sample of a press is taken as is */
+        touch_filter_update(&filter, 0, 100, 300, &out);
+        assert(out.x == 100 && out.y == 300 && out.vx == 0 && out.vy == 0);
+
+        /* Constant 1000 px/s to the right: the velocity converges and the predicted
+         * point leads the finger by v * horizon, smoothing delay included */
+        for (int k = 1; k <= 40; ++k) {
+            touch_filter_update(&filter, k * 10000, 100 + 10 * k, 300, &out);
+        }
+        assert(abs(out.vx - 1000) < 20 && abs(out.vy) < 5);
+        assert(abs(out.x - (500 + 20)) <= 2 && out.y == 300);
+        assert(out.smooth_x <= 500 && out.smooth_x > 480);
+
+        /* Without a horizon the output is the smoothed point */
+        touch_filter_set_horizon(&filter, 0);
+        touch_filter_update(&filter, 41 * 10000, 510, 300, &out);
+        assert(out.x == out.smooth_x);
+
+        /* Lead is bounded, and a new press forgets the old contact */
+        touch_filter_set_horizon(&filter, 1000000);
+        touch_filter_update(&filter, 42 * 10000, 520, 300, &out);
+        assert(out.x - out.smooth_x == cfg.max_lead_px);
+        touch_filter_reset(&filter);
+        touch_filter_update(&filter, 43 * 10000, 20, 40, &out);
+        assert(out.x == 20 && out.y == 40 && out.vx == 0);
+
+        /* A long gap without frames drops the stale velocity */
+        touch_filter_update(&filter, 44 * 10000, 30, 40, &out);
+        touch_filter_update(&filter, 44 * 10000 + TOUCH_FILTER_MAX_GAP_US + 1, 30, 40, &out);
+        assert(abs(out.vx) < (int)cfg.min_speed && out.x == out.smooth_x);
+    }
+}
+
+/* Trace in the simulator format, "t_ms down|move|up x y" per line: report only */
+static int replay_file(const char *path)
+{
+    static touch_trace_sample_t samples[MAX_SAMPLES];
+    static reference_t ref;
+    char line[128];
+    size_t count = 0;
+    int presses = 0;
+
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 1;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        unsigned long t_ms;
+        char kind[8];
+        int x;
+        int y;
+        if (line[0] == '#' || sscanf(line, "%lu %7s %d %d", &t_ms, kind, &x, &y) != 4) {
+            continue;
+        }
+        if (strcmp(kind, "down") == 0) {
+            count = 0;
+        }
+        if (count < MAX_SAMPLES) {
+            samples[count++] = (touch_trace_sample_t){(uint32_t)(t_ms * 1000), (int16_t)x, (int16_t)y};
+        }
+        if (strcmp(kind, "up") == 0 && count >= 5) {
+            char name[32];
+            snprintf(name, sizeof(name), "press %d", ++presses);
+            reference_build(&ref, samples, count);
+            for (int k = TOUCH_FILTER_NONE; k <= TOUCH_FILTER_KALMAN; ++k) {
+                replay((touch_filter_kind_t)k, samples, count, &ref, &replays[k]);
+                report(name, (touch_filter_kind_t)k, &replays[k]);
+            }
+        }
+    }
+    fclose(f);
+    if (!presses) {
+        printf("%s: no press of 5 samples or more\n", path);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1) {
+        int status = 0;
+        for (int i = 1; i < argc; ++i) {
+            status |= replay_file(argv[i]);
+        }
+        return status;
+    }
+
+    test_fixed_point_stages();
+    printf("render latency %d ms\n", RENDER_LATENCY_US / 1000);
+    for (size_t i = 0; i < sizeof(touch_traces) / sizeof(touch_traces[0]); ++i) {
+        check_trace(&touch_traces[i]);
+    }
+    check_stop_overshoot();
+    puts("Touch filter test passed");
+    return 0;
+}
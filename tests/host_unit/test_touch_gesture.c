@@ -0,0 +1,193 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "touch_gesture.h"
+
+/* GT911 report period while touched */
+#define FRAME_US 10000
+
+typedef struct {
+    touch_gesture_engine_t eng;
+    int64_t t_us;
+    touch_gesture_t events[64];
+    size_t count;
+} session_t;
+
+static void session_init(session_t *s)
+{
+    memset(s, 0, sizeof(*s));
+    touch_gesture_init(&s->eng);
+    s->t_us = 1000000;
+}
+
+static void feed(session_t *s, uint8_t count, const touch_point_t *points)
+{
+    touch_frame_t frame = {.t_us = s->t_us, .count = count};
+    touch_gesture_t out[TOUCH_GESTURE_MAX_EVENTS];
+
+    memcpy(frame.points, points, count * sizeof(points[0]));
+    uint8_t n = touch_gesture_update(&s->eng, &frame, out);
+    assert(n <= TOUCH_GESTURE_MAX_EVENTS);
+    for (uint8_t i = 0; i < n && s->count < 64; ++i) {
+        s->events[s->count++] = out[i];
+    }
+    s->t_us += FRAME_US;
+}
+
+static void feed1(session_t *s, uint8_t id, int x, int y)
+{
+    touch_point_t p = {(uint16_t)x, (uint16_t)y, 20, id};
+    feed(s, 1, &p);
+}
+
+static void feed2(session_t *s, uint8_t id_a, int xa, int ya, uint8_t id_b, int xb, int yb)
+{
+    touch_point_t p[2] = {{(uint16_t)xa, (uint16_t)ya, 20, id_a}, {(uint16_t)xb, (uint16_t)yb, 20, id_b}};
+    feed(s, 2, p);
+}
+
+static void release(session_t *s)
+{
+    feed(s, 0, NULL);
+}
+
+static void test_tap(void)
+{
+    session_t s;
+    session_init(&s);
+    for (int i = 0; i < 10; ++i) {
+        feed1(&s, 0, 300 + (i & 1), 200);
+    }
+    release(&s);
+    assert(s.count == 0);
+}
+
+static void test_long_press(void)
+{
+    session_t s;
+    session_init(&s);
+    /* 700 ms still, with sensor noise */
+    for (int i = 0; i < 70; ++i) {
+        feed1(&s, 3, 500 + i % 3, 250 - i % 2);
+    }
+    release(&s);
+    assert(s.count == 1);
+    assert(s.events[0].type == TOUCH_GESTURE_LONG_PRESS && s.events[0].phase == TOUCH_GESTURE_END);
+    assert(s.events[0].t_ms == (1000000 + 50 * FRAME_US) / 1000);
+
+    /* Without frames, the tick reports it */
+    session_init(&s);
+    feed1(&s, 0, 100, 100);
+    touch_gesture_t out[TOUCH_GESTURE_MAX_EVENTS];
+    assert(touch_gesture_tick(&s.eng, s.t_us + 200000, out) == 0);
+    assert(touch_gesture_tick(&s.eng, s.t_us + 600000, out) == 1 && out[0].type == TOUCH_GESTURE_LONG_PRESS);
+    assert(touch_gesture_tick(&s.eng, s.t_us + 900000, out) == 0);
+
+    /* A moving contact is not a long press */
+    session_init(&s);
+    for (int i = 0; i < 70; ++i) {
+        feed1(&s, 0, 100 + i, 100);
+    }
+    release(&s);
+    assert(s.count == 0);
+}
+
+static void test_swipe(void)
+{
+    session_t s;
+    session_init(&s);
+    /* 240 px left in 120 ms */
+    for (int i = 0; i <= 12; ++i) {
+        feed1(&s, 1, 700 - 20 * i, 300 + i);
+    }
+    release(&s);
+    assert(s.count == 1);
+    const touch_gesture_t *g = &s.events[0];
+    assert(g->type == TOUCH_GESTURE_SWIPE && g->dir == TOUCH_GESTURE_DIR_LEFT);
+    assert(g->dx == -240 && g->dy == 12 && g->x == 700 && g->y == 300);
+    assert(g->speed == 240 * 1000 / 130);
+
+    /* Same distance, too slow: a drag */
+    session_init(&s);
+    for (int i = 0; i <= 60; ++i) {
+        feed1(&s, 1, 300, 100 + 4 * i);
+    }
+    release(&s);
+    assert(s.count == 0);
+}
+
+static void test_pinch(void)
+{
+    session_t s;
+    session_init(&s);
+    feed1(&s, 0, 400, 300);
+    /* Second finger 100 px away, then spread to 200 px around the same centre */
+    for (int i = 0; i <= 10; ++i) {
+        feed2(&s, 0, 400 - 5 * i, 300, 1, 500 + 5 * i, 300);
+    }
+    feed1(&s, 1, 550, 300);
+    release(&s);
+
+    assert(s.count >= 3);
+    assert(s.events[0].type == TOUCH_GESTURE_PINCH && s.events[0].phase == TOUCH_GESTURE_BEGIN);
+    const touch_gesture_t *end = &s.events[s.count - 1];
+    assert(end->type == TOUCH_GESTURE_PINCH && end->phase == TOUCH_GESTURE_END);
+    assert(end->scale_q8 == 512 && end->x == 450 && end->y == 300 && end->dx == 0);
+    for (size_t i = 1; i + 1 < s.count; ++i) {
+        assert(s.events[i].phase == TOUCH_GESTURE_UPDATE);
+        assert(s.events[i].scale_q8 > s.events[i - 1].scale_q8);
+    }
+}
+
+static void test_pan_and_track_ids(void)
+{
+    session_t s;
+    session_init(&s);
+    feed2(&s, 4, 200, 200, 7, 300, 200);
+    /* The controller reorders the slots: ids still pair up the same fingers */
+    for (int i = 1; i <= 10; ++i) {
+        if (i & 1) {
+            feed2(&s, 7, 300, 200 + 10 * i, 4, 200, 200 + 10 * i);
+        } else {
+            feed2(&s, 4, 200, 200 + 10 * i, 7, 300, 200 + 10 * i);
+        }
+    }
+    release(&s);
+
+    assert(s.count >= 3);
+    assert(s.events[0].type == TOUCH_GESTURE_PAN && s.events[0].phase == TOUCH_GESTURE_BEGIN);
+    for (size_t i = 0; i < s.count; ++i) {
+        assert(s.events[i].type == TOUCH_GESTURE_PAN);
+        /* Finger spacing never changed */
+        assert(s.events[i].scale_q8 == 256);
+    }
+    const touch_gesture_t *end = &s.events[s.count - 1];
+    assert(end->phase == TOUCH_GESTURE_END && end->dx == 0 && end->dy == 100);
+}
+
+static void test_no_single_gesture_after_two_fingers(void)
+{
+    session_t s;
+    session_init(&s);
+    feed2(&s, 0, 100, 100, 1, 110, 100);
+    /* Second finger lifts, first one runs off: no swipe, no long press */
+    for (int i = 0; i < 80; ++i) {
+        feed1(&s, 0, 100 + 5 * i, 100);
+    }
+    release(&s);
+    assert(s.count == 0);
+}
+
+int main(void)
+{
+    test_tap();
+    test_long_press();
+    test_swipe();
+    test_pinch();
+    test_pan_and_track_ids();
+    test_no_single_gesture_after_two_fingers();
+    printf("touch_gesture_t is %u bytes\n", (unsigned)sizeof(touch_gesture_t));
+    puts("Touch gesture test passed");
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "touch_latency.h"
+
+static void test_empty(void)
+{
+    touch_latency_t lat;
+    touch_latency_stats_t st;
+
+    touch_latency_reset(&lat);
+    touch_latency_get(&lat, &st);
+    assert(st.count == 0 && st.p50_us == 0 && st.p99_us == 0 && st.max_us == 0);
+}
+
+static void test_percentiles(void)
+{
+    touch_latency_t lat;
+    touch_latency_stats_t st;
+
+    /* 1..50 ms shuffled: nearest-rank p50 is 25 ms, p99 is 50 ms */
+    touch_latency_reset(&lat);
+    for (uint32_t i = 0; i < 50; ++i) {
+        touch_latency_add(&lat, ((i * 17) % 50 + 1) * 1000);
+    }
+    touch_latency_get(&lat, &st);
+    assert(st.count == 50);
+    assert(st.p50_us == 25000);
+    assert(st.p99_us == 50000);
+    assert(st.max_us == 50000);
+    assert(st.mean_us == 25500);
+    assert(st.last_us == ((49 * 17) % 50 + 1) * 1000);
+}
+
+static void test_window(void)
+{
+    touch_latency_t lat;
+    touch_latency_stats_t st;
+
+    /* An early spike leaves the window but stays in max and mean */
+    touch_latency_reset(&lat);
+    touch_latency_add(&lat, 200000);
+    for (uint32_t i = 0; i < TOUCH_LATENCY_WINDOW; ++i) {
+        touch_latency_add(&lat, 8000);
+    }
+    touch_latency_get(&lat, &st);
+    assert(st.count == TOUCH_LATENCY_WINDOW + 1);
+    assert(st.p99_us == 8000 && st.p50_us == 8000);
+    assert(st.max_us == 200000);
+    assert(st.mean_us == (200000 + 8000 * TOUCH_LATENCY_WINDOW) / (TOUCH_LATENCY_WINDOW + 1));
+}
+
+int main(void)
+{
+    test_empty();
+    test_percentiles();
+    test_window();
+    puts("Touch latency test passed");
+    return 0;
+}
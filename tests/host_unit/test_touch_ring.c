@@ -0,0 +1,248 @@
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "touch_ring.h"
+
+#define STRESS_FRAMES 20000
+
+static touch_frame_t make_frame(int64_t t, uint8_t count)
+{
+    touch_frame_t f = {0};
+    f.t_us = t;
+    f.count = count;
+    for (uint8_t i = 0; i < count; ++i) {
+        f.points[i].x = (uint16_t)(t + i);
+        f.points[i].y = (uint16_t)(t * 2 + i);
+        f.points[i].track_id = i;
+    }
+    return f;
+}
+
+static void test_fifo(void)
+{
+    touch_ring_t ring;
+    touch_frame_t out;
+    touch_ring_stats_t st;
+
+    touch_ring_init(&ring);
+    assert(!touch_ring_pop(&ring, &out));
+    for (int64_t t = 1; t <= 5; ++t) {
+        assert(touch_ring_push(&ring, &(touch_frame_t){.t_us = t, .count = 1}));
+    }
+    assert(touch_ring_depth(&ring) == 5);
+    for (int64_t t = 1; t <= 5; ++t) {
+        assert(touch_ring_pop(&ring, &out) && out.t_us == t);
+    }
+    assert(touch_ring_depth(&ring) == 0);
+
+    /* Indexes wrap around the slots many times */
+    for (int64_t t = 6; t < 6 + 10 * TOUCH_RING_SIZE; ++t) {
+        touch_frame_t in = make_frame(t, (uint8_t)(t % (TOUCH_FRAME_MAX_POINTS + 1)));
+        assert(touch_ring_push(&ring, &in));
+        assert(touch_ring_pop(&ring, &out));
+        assert(out.t_us == t && out.count == in.count);
+        for (uint8_t i = 0; i < out.count; ++i) {
+            assert(out.points[i].x == in.points[i].x && out.points[i].y == in.points[i].y);
+        }
+    }
+    touch_ring_get_stats(&ring, &st);
+    assert(st.pushed == 5 + 10 * TOUCH_RING_SIZE && st.dropped == 0 && st.max_depth == 5);
+}
+
+static void test_full(void)
+{
+    touch_ring_t ring;
+    touch_frame_t out;
+    touch_ring_stats_t st;
+
+    touch_ring_init(&ring);
+    for (int64_t t = 0; t < TOUCH_RING_SIZE; ++t) {
+        assert(touch_ring_push(&ring, &(touch_frame_t){.t_us = t, .count = 1}));
+    }
+    /* Full: moves of the same contact merge, the release that ends them is kept */
+    assert(!touch_ring_push(&ring, &(touch_frame_t){.t_us = 100, .count = 1}));
+    assert(!touch_ring_push(&ring, &(touch_frame_t){.t_us = 101, .count = 1}));
+    assert(!touch_ring_push(&ring, &(touch_frame_t){.t_us = 102, .count = 0}));
+    assert(!touch_ring_flush(&ring));
+    touch_ring_get_stats(&ring, &st);
+    assert(st.depth == TOUCH_RING_SIZE && st.max_depth == TOUCH_RING_SIZE && st.dropped == 1);
+
+    assert(touch_ring_pop(&ring, &out) && out.t_us == 0);
+    assert(!touch_ring_flush(&ring));
+    assert(touch_ring_pop(&ring, &out) && out.t_us == 1);
+    assert(touch_ring_flush(&ring));
+    for (int64_t t = 2; t < TOUCH_RING_SIZE; ++t) {
+        assert(touch_ring_pop(&ring, &out) && out.t_us == t);
+    }
+    assert(touch_ring_pop(&ring, &out) && out.t_us == 101 && out.count == 1);
+    assert(touch_ring_pop(&ring, &out) && out.t_us == 102 && out.count == 0);
+    assert(!touch_ring_pop(&ring, &out));
+
+    /* Pending frame goes out before a newer one */
+    for (int64_t t = 0; t < TOUCH_RING_SIZE; ++t) {
+        touch_ring_push(&ring, &(touch_frame_t){.t_us = t, .count = 1});
+    }
+    assert(!touch_ring_push(&ring, &(touch_frame_t){.t_us = 200, .count = 1}));
+    assert(touch_ring_pop(&ring, &out) && touch_ring_pop(&ring, &out));
+    assert(touch_ring_push(&ring, &(touch_frame_t){.t_us = 201, .count = 0}));
+    for (int64_t t = 2; t < TOUCH_RING_SIZE; ++t) {
+        assert(touch_ring_pop(&ring, &out) && out.t_us == t);
+    }
+    assert(touch_ring_pop(&ring, &out) && out.t_us == 200);
+    assert(touch_ring_pop(&ring, &out) && out.t_us == 201);
+}
+
+static void drain(touch_ring_t *ring, int64_t first, int64_t end)
+{
+    touch_frame_t out;
+    for (int64_t t = first; t < end; ++t) {
+        assert(touch_ring_pop(ring, &out) && out.t_us == t);
+    }
+}
+
+/* A waiting frame is only merged with one of the same contact state */
+static void test_full_transitions(void)
+{
+    touch_ring_t ring;
+    touch_frame_t out;
+    touch_ring_stats_t st;
+
+    /* Release then press while full: the release is delivered before the press */
+    touch_ring_init(&ring);
+    for (int64_t t = 0; t < TOUCH_RING_SIZE; ++t) {
+        touch_frame_t in = make_frame(t, 1);
+        assert(touch_ring_push(&ring, &in));
+    }
+    touch_frame_t release = make_frame(100, 0);
+    touch_frame_t press = make_frame(101, 1);
+    assert(!touch_ring_push(&ring, &release));
+    assert(!touch_ring_push(&ring, &press));
+    drain(&ring, 0, 2);
+    assert(touch_ring_flush(&ring));
+    drain(&ring, 2, TOUCH_RING_SIZE);
+    assert(touch_ring_pop(&ring, &out) && out.t_us == 100 && out.count == 0);
+    assert(touch_ring_pop(&ring, &out) && out.t_us == 101 && out.count == 1);
+    touch_ring_get_stats(&ring, &st);
+    assert(st.dropped == 0);
+
+    /* Both slots taken: frames that do not end the last state are dropped,
+     * never the waiting release */
+    touch_ring_init(&ring);
+    for (int64_t t = 0; t < TOUCH_RING_SIZE; ++t) {
+        touch_frame_t in = make_frame(t, 1);
+        assert(touch_ring_push(&ring, &in));
+    }
+    press = make_frame(200, 1);
+    release = make_frame(201, 0);
+    touch_frame_t two = make_frame(202, 2);
+    touch_frame_t again = make_frame(203, 0);
+    assert(!touch_ring_push(&ring, &press));
+    assert(!touch_ring_push(&ring, &release));
+    assert(!touch_ring_push(&ring, &two));
+    assert(!touch_ring_push(&ring, &again));
+    touch_ring_get_stats(&ring, &st);
+    assert(st.dropped == 2);
+    drain(&ring, 0, TOUCH_RING_SIZE);
+    assert(touch_ring_flush(&ring));
+    assert(touch_ring_pop(&ring, &out) && out.t_us == 200 && out.count == 1);
+    assert(touch_ring_pop(&ring, &out) && out.t_us == 201 && out.count == 0);
+    assert(!touch_ring_pop(&ring, &out));
+
+    /* A second finger waits behind the first; a release replaces the
+     * waiting press it ends, the one before it is kept */
+    touch_ring_init(&ring);
+    for (int64_t t = 0; t < TOUCH_RING_SIZE; ++t) {
+        touch_frame_t in = make_frame(t, 1);
+        assert(touch_ring_push(&ring, &in));
+    }
+    press = make_frame(300, 1);
+    two = make_frame(301, 2);
+    touch_frame_t moved = make_frame(302, 2);
+    release = make_frame(303, 0);
+    assert(!touch_ring_push(&ring, &press));
+    assert(!touch_ring_push(&ring, &two));
+    assert(!touch_ring_push(&ring, &moved));
+    assert(!touch_ring_push(&ring, &release));
+    drain(&ring, 0, TOUCH_RING_SIZE);
+    assert(touch_ring_flush(&ring));
+    assert(touch_ring_pop(&ring, &out) && out.t_us == 300 && out.count == 1);
+    assert(touch_ring_pop(&ring, &out) && out.t_us == 303 && out.count == 0);
+    touch_ring_get_stats(&ring, &st);
+    assert(st.dropped == 2);
+}
+
+static touch_ring_t stress_ring;
+static atomic_bool stress_started;
+static atomic_bool stress_done;
+
+static void *stress_producer(void *arg)
+{
+    (void)arg;
+    while (!atomic_load(&stress_started)) {
+        sched_yield();
+    }
+    for (int64_t t = 1; t <= STRESS_FRAMES; ++t) {
+        touch_frame_t f = make_frame(t, t == STRESS_FRAMES ? 0 : (uint8_t)(1 + t % TOUCH_FRAME_MAX_POINTS));
+        if (!touch_ring_push(&stress_ring, &f)) {
+            /* Let the consumer catch up, as the GT911 frame period does */
+            sched_yield();
+        }
+    }
+    while (!touch_ring_flush(&stress_ring)) {
+        sched_yield();
+    }
+    atomic_store(&stress_done, true);
+    return NULL;
+}
+
+/* One producer thread, one consumer thread: frames arrive whole and in order */
+static void test_stress(void)
+{
+    pthread_t producer;
+    touch_frame_t out;
+    touch_ring_stats_t st;
+    int64_t last = 0;
+    uint32_t popped = 0;
+
+    touch_ring_init(&stress_ring);
+    atomic_init(&stress_started, false);
+    atomic_init(&stress_done, false);
+    assert(pthread_create(&producer, NULL, stress_producer, NULL) == 0);
+    atomic_store(&stress_started, true);
+    for (;;) {
+        bool done = atomic_load(&stress_done);
+        while (touch_ring_pop(&stress_ring, &out)) {
+            assert(out.t_us > last);
+            for (uint8_t i = 0; i < out.count; ++i) {
+                assert(out.points[i].x == (uint16_t)(out.t_us + i));
+                assert(out.points[i].y == (uint16_t)(out.t_us * 2 + i));
+            }
+            last = out.t_us;
+            ++popped;
+        }
+        if (done) {
+            break;
+        }
+        sched_yield();
+    }
+    pthread_join(producer, NULL);
+
+    touch_ring_get_stats(&stress_ring, &st);
+    assert(last == STRESS_FRAMES && out.count == 0);
+    assert(st.pushed == popped && st.depth == 0);
+    assert(st.pushed + st.dropped == STRESS_FRAMES);
+    printf("stress: %u frames delivered, %u dropped, max depth %u\n", (unsigned)st.pushed,
+           (unsigned)st.dropped, (unsigned)st.max_depth);
+}
+
+int main(void)
+{
+    test_fifo();
+    test_full();
+    test_full_transitions();
+    test_stress();
+    puts("Touch ring test passed");
+    return 0;
+}
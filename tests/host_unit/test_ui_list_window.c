@@ -0,0 +1,166 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "ui_list_window.h"
+
+/* Reptile list geometry of ui_content.c on the 600-line panel */
+#define ROW_HEIGHT 76
+#define ROW_GAP    10
+#define PITCH      (ROW_HEIGHT + ROW_GAP)
+#define VIEWPORT   420
+#define OVERSCAN   2
+
+static size_t shown[UI_LIST_WINDOW_MAX_POOL];
+
+static void bind(uint16_t slot, size_t index, void *ctx)
+{
+    (void)ctx;
+    assert(slot < UI_LIST_WINDOW_MAX_POOL);
+    shown[slot] = index;
+}
+
+/* Every row intersecting the viewport is bound, in its own slot */
+static void check_visible(const ui_list_window_t *win, int32_t scroll)
+{
+    if (!win->count) {
+        return;
+    }
+    size_t top = (size_t)(scroll / PITCH);
+    size_t bottom = (size_t)((scroll + VIEWPORT - 1) / PITCH);
+    if (bottom >= win->count) {
+        bottom = win->count - 1;
+    }
+    assert(win->first <= top && bottom < win->end);
+    for (size_t i = top; i <= bottom; ++i) {
+        assert(shown[i % win->pool] == i);
+    }
+}
+
+static void test_pool_size(void)
+{
+    /* Rows cut at both edges plus the overscan on each side */
+    assert(ui_list_window_pool_size(600, PITCH, OVERSCAN) == 7 + 1 + 2 * OVERSCAN);
+    assert(ui_list_window_pool_size(600, 10, 4) == UI_LIST_WINDOW_MAX_POOL);
+    assert(ui_list_window_pool_size(0, PITCH, OVERSCAN) == 0);
+    assert(ui_list_window_pool_size(600, 0, OVERSCAN) == 0);
+}
+
+static void test_scroll_through(size_t count, uint32_t *binds_out)
+{
+    ui_list_window_t win;
+    uint16_t pool = ui_list_window_pool_size(600, PITCH, OVERSCAN);
+    ui_list_window_init(&win, PITCH, pool, OVERSCAN);
+    ui_list_window_set_count(&win, count);
+    assert(ui_list_window_content_height(&win) == (int32_t)count * PITCH);
+
+    assert(ui_list_window_update(&win, 0, bind, NULL) == pool);
+    check_visible(&win, 0);
+    assert(ui_list_window_update(&win, 0, bind, NULL) == 0);
+
+    /* Slow drag to the end, a few pixels per frame */
+    int32_t max_scroll = ui_list_window_content_height(&win) - ROW_GAP - VIEWPORT;
+    for (int32_t scroll = 0; scroll <= max_scroll; scroll += 7) {
+        uint32_t binds = ui_list_window_update(&win, scroll, bind, NULL);
+        /* One row crossing an edge at most per frame */
+        assert(binds <= 1);
+        check_visible(&win, scroll);
+    }
+    *binds_out = win.binds;
+    /* Each row bound once on the way down */
+    assert(win.binds <= count + pool);
+
+    /* Fling back to the top: at most the whole pool */
+    assert(ui_list_window_update(&win, 0, bind, NULL) <= pool);
+    check_visible(&win, 0);
+}
+
+static void test_short_list(void)
+{
+    ui_list_window_t win;
+    uint16_t pool = ui_list_window_pool_size(600, PITCH, OVERSCAN);
+    ui_list_window_init(&win, PITCH, pool, OVERSCAN);
+    ui_list_window_set_count(&win, 3);
+
+    /* Spare slots are hidden once, then left alone */
+    assert(ui_list_window_update(&win, 0, bind, NULL) == pool);
+    for (uint16_t slot = 0; slot < pool; ++slot) {
+        assert(shown[slot] == (slot < 3 ? slot : UI_LIST_WINDOW_NONE));
+    }
+    assert(ui_list_window_update(&win, 0, bind, NULL) == 0);
+
+    /* New data: every slot is bound again */
+    ui_list_window_set_count(&win, 40);
+    assert(ui_list_window_update(&win, 0, bind, NULL) == pool);
+    check_visible(&win, 0);
+    ui_list_window_invalidate(&win);
+    assert(ui_list_window_update(&win, 0, bind, NULL) == pool);
+
+    /* Emptied list */
+    ui_list_window_set_count(&win, 0);
+    assert(ui_list_window_update(&win, 0, bind, NULL) == pool);
+    assert(win.first == 0 && win.end == 0);
+    for (uint16_t slot = 0; slot < pool; ++slot) {
+        assert(shown[slot] == UI_LIST_WINDOW_NONE);
+    }
+}
+
+static void test_overscan(void)
+{
+    ui_list_window_t win;
+    uint16_t pool = ui_list_window_pool_size(600, PITCH, OVERSCAN);
+    ui_list_window_init(&win, PITCH, pool, OVERSCAN);
+    ui_list_window_set_count(&win, 1000);
+
+    /* Rows above the viewport stay bound while scrolling back */
+    ui_list_window_update(&win, 100 * PITCH, bind, NULL);
+    assert(win.first == 100 - OVERSCAN && win.end == win.first + pool);
+    assert(ui_list_window_update(&win, 100 * PITCH - 1, bind, NULL) == 1);
+    /* Last rows: the window fills up backwards */
+    ui_list_window_update(&win, 1000 * PITCH, bind, NULL);
+    assert(win.end == 1000 && win.first == 1000u - pool);
+}
+
+static void test_visible(void)
+{
+    const int32_t scroll = 100 * PITCH + PITCH / 2;
+    ui_list_window_t win;
+    uint16_t pool = ui_list_window_pool_size(VIEWPORT, PITCH, OVERSCAN);
+    ui_list_window_init(&win, PITCH, pool, OVERSCAN);
+    ui_list_window_set_count(&win, 1000);
+    ui_list_window_update(&win, scroll, bind, NULL);
+
+    /* Overscan rows are bound but not visible */
+    assert(win.first < 99 && !ui_list_window_is_visible(&win, win.first, scroll, VIEWPORT));
+    assert(!ui_list_window_is_visible(&win, win.end - 1, scroll, VIEWPORT));
+    assert(!ui_list_window_is_visible(&win, 99, scroll, VIEWPORT));
+    /* The row cut at the top and the one cut at the bottom are visible */
+    assert(ui_list_window_is_visible(&win, 100, scroll, VIEWPORT));
+    assert(ui_list_window_is_visible(&win, (scroll + VIEWPORT - 1) / PITCH, scroll, VIEWPORT));
+    assert(!ui_list_window_is_visible(&win, (scroll + VIEWPORT) / PITCH + 1, scroll, VIEWPORT));
+    assert(!ui_list_window_is_visible(&win, 1000, 999 * PITCH, VIEWPORT));
+
+    /* A forgotten overscan row is bound again by the next update, and only it */
+    size_t below = win.end - 1;
+    ui_list_window_forget(&win, below);
+    ui_list_window_forget(&win, below + 1);
+    assert(ui_list_window_update(&win, scroll, bind, NULL) == 1);
+    assert(shown[below % win.pool] == below);
+}
+
+int main(void)
+{
+    static const size_t sizes[] = {10, 100, 1000, 5000};
+
+    test_pool_size();
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        uint32_t binds;
+        test_scroll_through(sizes[i], &binds);
+        printf("%5u rows: %u row objects, %u binds scrolling to the end\n", (unsigned)sizes[i],
+               (unsigned)ui_list_window_pool_size(600, PITCH, OVERSCAN), (unsigned)binds);
+    }
+    test_short_list();
+    test_overscan();
+    test_visible();
+    puts("List window test passed");
+    return 0;
+}
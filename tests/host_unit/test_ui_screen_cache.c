@@ -0,0 +1,155 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "ui_screen_cache.h"
+
+#define SCREENS 6
+#define NONE UI_SCREEN_CACHE_SLOTS
+
+/* Stand-in objects: the cache only stores and returns the pointers */
+static int screen_objs[SCREENS];
+
+/* Heap charged per screen when built (bytes) */
+static const size_t screen_bytes[SCREENS] = {9000, 7000, 8000, 5000, 6000, 4000};
+
+/* Navigation as ui_content_load_screen() does it; returns true on a rebuild */
+static bool navigate(ui_screen_cache_t *cache, uint8_t screen, bool heap_tight, uint32_t *deleted)
+{
+    if (ui_screen_cache_get(cache, screen)) {
+        return false;
+    }
+    if (ui_screen_cache_remove(cache, screen)) {
+        (*deleted)++;
+    }
+    while (ui_screen_cache_evict(cache, NONE, heap_tight)) {
+        (*deleted)++;
+    }
+    ui_screen_cache_put(cache, screen, &screen_objs[screen], screen_bytes[screen]);
+    while (ui_screen_cache_evict(cache, screen, heap_tight)) {
+        (*deleted)++;
+    }
+    return true;
+}
+
+static void test_budget_lru(void)
+{
+    ui_screen_cache_t cache;
+    uint32_t deleted = 0;
+    ui_screen_cache_init(&cache, 20000);
+
+    /* 0 (9000) + 1 (7000) fit, adding 2 (8000) evicts 0, the least recent */
+    assert(navigate(&cache, 0, false, &deleted));
+    assert(navigate(&cache, 1, false, &deleted));
+    assert(deleted == 0 && cache.stats.screens == 2);
+    assert(navigate(&cache, 2, false, &deleted));
+    assert(deleted == 1 && cache.entries[0].obj == NULL);
+    assert(cache.stats.bytes == 15000 && cache.stats.evictions == 1);
+
+    /* Going back to 1 is a hit and makes 2 the least recent */
+    assert(!navigate(&cache, 1, false, &deleted));
+    assert(cache.stats.hits == 1);
+    assert(navigate(&cache, 0, false, &deleted));
+    assert(cache.entries[2].obj == NULL && cache.entries[1].obj == &screen_objs[1]);
+    assert(cache.stats.bytes == 16000);
+}
+
+static void test_zero_budget_keeps_only_shown(void)
+{
+    ui_screen_cache_t cache;
+    uint32_t deleted = 0;
+    ui_screen_cache_init(&cache, 0);
+    for (uint8_t s = 0; s < SCREENS; ++s) {
+        assert(navigate(&cache, s, false, &deleted));
+        assert(cache.stats.screens == 1 && cache.entries[s].obj == &screen_objs[s]);
+    }
+    /* Same screen again: still cached, one invalidation instead of a rebuild */
+    assert(!navigate(&cache, SCREENS - 1, false, &deleted));
+    assert(deleted == SCREENS - 1);
+}
+
+static void test_invalidation(void)
+{
+    ui_screen_cache_t cache;
+    uint32_t deleted = 0;
+    ui_screen_cache_init(&cache, 100000);
+    navigate(&cache, 1, false, &deleted);
+    navigate(&cache, 4, false, &deleted);
+
+    /* Data change on a hidden screen: dropped at the next trim, rebuilt on visit */
+    assert(ui_screen_cache_contains(&cache, 1));
+    assert(ui_screen_cache_invalidate(&cache, 1));
+    assert(!ui_screen_cache_contains(&cache, 1) && !ui_screen_cache_contains(&cache, 2));
+    assert(!ui_screen_cache_invalidate(&cache, 1));
+    assert(!ui_screen_cache_invalidate(&cache, 2));
+    assert(ui_screen_cache_pick_victim(&cache, 4, false) == 1);
+    assert(navigate(&cache, 1, false, &deleted));
+    assert(cache.entries[1].obj == &screen_objs[1] && !cache.entries[1].stale);
+    assert(cache.stats.invalidations == 1);
+
+    /* The shown screen is never a victim, even stale */
+    assert(ui_screen_cache_invalidate(&cache, 1));
+    assert(ui_screen_cache_pick_victim(&cache, 1, true) == 4);
+    assert(ui_screen_cache_get(&cache, 1) == NULL);
+}
+
+static void test_heap_tight(void)
+{
+    ui_screen_cache_t cache;
+    uint32_t deleted = 0;
+    ui_screen_cache_init(&cache, 100000);
+    for (uint8_t s = 0; s < SCREENS; ++s) {
+        navigate(&cache, s, false, &deleted);
+    }
+    assert(deleted == 0 && cache.stats.screens == SCREENS);
+
+    /* Heap low: everything but the shown screen goes, LRU first */
+    assert(ui_screen_cache_pick_victim(&cache, 5, true) == 0);
+    while (ui_screen_cache_evict(&cache, 5, true)) {
+    }
+    assert(cache.stats.screens == 1 && cache.entries[5].obj == &screen_objs[5]);
+    assert(cache.stats.bytes == screen_bytes[5]);
+}
+
+/* Sidebar session: mostly dashboard <-> reptiles/terrariums/alerts */
+static uint32_t session_rebuilds(size_t budget, size_t *bytes_max)
+{
+    static const uint8_t clicks[] = {
+        0, 1, 0, 2, 0, 1, 4, 0, 2, 2, 1, 0, 3, 0, 1, 5, 0, 4, 0, 1,
+        2, 0, 1, 0, 2, 4, 0, 1, 3, 0, 2, 1, 0, 1, 0, 4, 2, 0, 1, 0,
+    };
+    ui_screen_cache_t cache;
+    uint32_t deleted = 0;
+    uint32_t rebuilds = 0;
+    ui_screen_cache_init(&cache, budget);
+    *bytes_max = 0;
+    for (size_t i = 0; i < sizeof(clicks); ++i) {
+        rebuilds += navigate(&cache, clicks[i], false, &deleted);
+        if (cache.stats.bytes > *bytes_max) {
+            *bytes_max = cache.stats.bytes;
+        }
+    }
+    return rebuilds;
+}
+
+int main(void)
+{
+    test_budget_lru();
+    test_zero_budget_keeps_only_shown();
+    test_invalidation();
+    test_heap_tight();
+
+    size_t max_none;
+    size_t max_small;
+    size_t max_all;
+    uint32_t none = session_rebuilds(0, &max_none);
+    uint32_t small = session_rebuilds(25000, &max_small);
+    uint32_t all = session_rebuilds(48 * 1024, &max_all);
+    assert(all == SCREENS);
+    assert(small < none && all <= small);
+    assert(max_small <= 25000 && max_all <= 48 * 1024);
+
+    printf("40-click session rebuilds: no cache %u, 25 KB budget %u (max %zu B), "
+           "48 KiB budget %u (max %zu B)\n", none, small, max_small, all, max_all);
+    puts("Screen cache test passed");
+    return 0;
+}
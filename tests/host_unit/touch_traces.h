@@ -0,0 +1,122 @@
+#pragma once
+
+/*
+ * Traces du contact principal au format des trames décodées du GT911 :
+ * instant de l'interruption, coordonnées entières sur 1024 x 600. Trames
+ * toutes les 10 ms avec une gigue d'horodatage de ±0,75 ms, bruit de
+ * position triangulaire de ±2 px. Ces traces sont synthétiques ; une
+ * trace relevée sur la dalle se rejoue avec test_touch_filter FICHIER.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    uint32_t t_us;
+    int16_t x;
+    int16_t y;
+} touch_trace_sample_t;
+
+typedef struct {
+    const char *name;
+    const char *desc;
+    const touch_trace_sample_t *samples;
+    size_t count;
+} touch_trace_t;
+
+static const touch_trace_sample_t trace_fling[] = {
+    {0, 512, 470}, {10025, 512, 469}, {19836, 512, 470}, {30271, 514, 470}, {40459, 512, 471},
+    {50202, 512, 470}, {59476, 512, 470}, {69561, 512, 469}, {79885, 513, 467},
+    {90193, 512, 462}, {100799, 513, 453}, {110611, 512, 445}, {121067, 511, 435},
+    {131141, 513, 421}, {140853, 512, 409}, {150755, 513, 392}, {160528, 515, 374},
+    {170826, 515, 352}, {181568, 514, 329}, {191055, 516, 308}, {200550, 516, 283},
+    {209995, 516, 256}, {220316, 516, 226}, {230886, 517, 194}, {240783, 517, 160},
+    {250367, 519, 126},
+};
+
+static const touch_trace_sample_t trace_drag_stop[] = {
+    {0, 300, 150}, {10373, 301, 149}, {20279, 299, 151}, {30714, 302, 151}, {40711, 301, 148},
+    {50437, 301, 150}, {60565, 301, 152}, {69973, 301, 155}, {79240, 301, 156},
+    {89695, 299, 161}, {100161, 298, 163}, {110358, 299, 169}, {119682, 300, 175},
+    {129645, 300, 179}, {140350, 300, 186}, {150622, 299, 194}, {160285, 300, 200},
+    {169745, 300, 207}, {179461, 301, 213}, {189802, 299, 222}, {200348, 301, 231},
+    {209898, 300, 241}, {220057, 300, 249}, {230161, 301, 257}, {240513, 301, 267},
+    {250126, 300, 276}, {259468, 299, 282}, {268857, 300, 290}, {278699, 300, 300},
+    {288908, 300, 309}, {299016, 299, 318}, {309503, 300, 326}, {319895, 300, 335},
+    {329329, 301, 343}, {339225, 300, 350}, {348500, 299, 356}, {358928, 301, 364},
+    {369376, 301, 369}, {378753, 300, 376}, {388699, 299, 381}, {398301, 300, 385},
+    {408416, 299, 389}, {417713, 301, 392}, {428137, 300, 394}, {438100, 301, 398},
+    {448066, 301, 400}, {457979, 300, 402}, {467785, 301, 400}, {477918, 298, 399},
+    {488360, 299, 400}, {498534, 299, 398}, {508918, 300, 399}, {519192, 299, 399},
+    {529300, 301, 401}, {539827, 301, 401}, {549933, 300, 400}, {560270, 299, 400},
+    {570069, 300, 400}, {580570, 300, 400}, {591094, 301, 399}, {601475, 300, 398},
+    {611877, 300, 400}, {621318, 300, 402}, {631897, 299, 399}, {642355, 300, 400},
+    {652576, 301, 400}, {663132, 301, 399}, {672924, 299, 399}, {682773, 300, 399},
+    {692910, 299, 400}, {702558, 301, 399}, {713249, 299, 401}, {723890, 301, 398},
+    {733899, 301, 400}, {744584, 299, 400}, {754128, 299, 400},
+};
+
+static const touch_trace_sample_t trace_hold[] = {
+    {0, 700, 320}, {10519, 699, 320}, {21106, 700, 320}, {31351, 700, 320}, {41589, 700, 320},
+    {51507, 699, 321}, {61894, 701, 321}, {71810, 702, 319}, {81919, 700, 319},
+    {91798, 699, 320}, {101932, 700, 319}, {112480, 700, 320}, {122417, 701, 321},
+    {131815, 700, 319}, {142017, 701, 319}, {151802, 700, 320}, {162035, 700, 320},
+    {171992, 701, 320}, {181380, 701, 320}, {191520, 701, 319}, {202225, 702, 320},
+    {211626, 700, 320}, {222044, 700, 322}, {232314, 699, 320}, {241579, 701, 319},
+    {252307, 701, 320}, {262104, 700, 319}, {272187, 700, 321}, {281725, 699, 320},
+    {291473, 700, 321}, {301063, 700, 319}, {310871, 699, 320}, {320478, 700, 320},
+    {330790, 699, 321}, {340863, 699, 321}, {350179, 699, 319}, {360202, 701, 319},
+    {370268, 699, 319}, {380633, 700, 321}, {390921, 701, 320}, {400266, 700, 320},
+    {410199, 700, 321}, {420633, 699, 319}, {430201, 700, 319}, {440419, 700, 320},
+    {450197, 701, 320}, {460329, 699, 320}, {470576, 700, 320}, {480851, 700, 320},
+    {491297, 699, 322}, {501941, 699, 321}, {512284, 699, 320}, {522126, 700, 319},
+    {532284, 701, 319}, {541756, 701, 318}, {552386, 700, 321}, {561641, 700, 321},
+    {571064, 701, 321}, {580447, 701, 321}, {590901, 700, 320}, {600674, 699, 320},
+    {610132, 701, 319}, {620055, 700, 320}, {630671, 699, 320}, {641031, 700, 321},
+    {650333, 700, 319}, {659750, 700, 318}, {669884, 700, 319}, {679750, 701, 320},
+    {690327, 700, 320}, {700399, 700, 320}, {710395, 700, 319}, {720244, 700, 320},
+    {729849, 698, 320}, {740438, 700, 319}, {751129, 701, 319}, {760707, 699, 319},
+    {770528, 700, 321}, {780958, 701, 321}, {791585, 699, 319},
+};
+
+static const touch_trace_sample_t trace_back_forth[] = {
+    {0, 512, 301}, {10210, 513, 315}, {20317, 514, 331}, {30565, 516, 346}, {40475, 516, 361},
+    {50669, 518, 376}, {61323, 517, 390}, {70760, 519, 400}, {80742, 522, 411},
+    {91430, 520, 422}, {101597, 522, 431}, {112125, 524, 440}, {122782, 525, 443},
+    {132560, 525, 447}, {142112, 527, 450}, {152114, 526, 449}, {162811, 527, 448},
+    {173019, 528, 446}, {183389, 528, 441}, {194097, 529, 434}, {204567, 528, 425},
+    {214727, 530, 418}, {224149, 531, 405}, {234822, 531, 393}, {244895, 532, 382},
+    {254388, 530, 368}, {264850, 532, 355}, {274186, 531, 340}, {283926, 532, 325},
+    {294353, 533, 308}, {304040, 532, 293}, {313822, 531, 277}, {323132, 532, 264},
+    {333482, 532, 248}, {343362, 531, 233}, {353172, 532, 221}, {363450, 530, 207},
+    {374172, 529, 196}, {383530, 530, 185}, {393427, 530, 176}, {403106, 529, 169},
+    {412865, 530, 162}, {422980, 528, 156}, {432895, 528, 153}, {443223, 527, 150},
+    {453589, 526, 151}, {462883, 526, 151}, {473527, 526, 155}, {483214, 524, 160},
+    {492733, 522, 164}, {502117, 523, 170}, {512052, 520, 179}, {521922, 521, 191},
+    {531458, 518, 202}, {541243, 520, 213}, {550838, 518, 227}, {560380, 516, 240},
+    {570344, 516, 254}, {580965, 514, 270}, {590275, 515, 286}, {600030, 511, 300},
+    {610040, 511, 315}, {619489, 510, 330}, {629199, 510, 346}, {638641, 508, 358},
+    {648880, 507, 373}, {658647, 508, 387}, {668516, 504, 398}, {679159, 504, 412},
+    {689634, 503, 421}, {699564, 502, 431}, {708917, 501, 436}, {719582, 500, 443},
+    {730214, 500, 446}, {739608, 500, 449}, {750229, 498, 450}, {760480, 498, 450},
+    {770375, 496, 445}, {780295, 496, 443}, {789656, 495, 438}, {800133, 494, 431},
+    {809619, 493, 422}, {819235, 494, 411}, {829840, 494, 401}, {839263, 492, 390},
+    {849209, 492, 377}, {858694, 492, 363}, {868870, 493, 349}, {879231, 494, 332},
+    {888881, 492, 319}, {898214, 492, 303}, {907527, 491, 288}, {918030, 492, 270},
+    {928532, 493, 256}, {938245, 492, 242}, {947795, 493, 229}, {958336, 492, 214},
+    {968844, 493, 200}, {979121, 493, 190}, {989784, 494, 179}, {999310, 494, 171},
+    {1009509, 496, 163}, {1020178, 495, 157}, {1029972, 497, 153}, {1040303, 497, 150},
+    {1049876, 497, 150}, {1060252, 498, 152}, {1069790, 499, 154}, {1080510, 500, 156},
+    {1091064, 502, 164}, {1101719, 502, 172}, {1112329, 503, 181}, {1122123, 504, 191},
+    {1132752, 505, 204}, {1143177, 506, 216}, {1153574, 509, 230}, {1162893, 508, 244},
+    {1173036, 508, 260}, {1182831, 509, 272}, {1192806, 511, 289},
+};
+
+#define TOUCH_TRACE(n, d) {#n, d, trace_##n, sizeof(trace_##n) / sizeof(trace_##n[0])}
+
+static const touch_trace_t touch_traces[] = {
+    TOUCH_TRACE(fling, "Lancer vers le haut : 60 ms posé, 380 px accélérés en 200 ms, relâché à 3800 px/s"),
+    TOUCH_TRACE(drag_stop, "Glissé lent de 250 px (~600 px/s), arrêt puis 300 ms immobile"),
+    TOUCH_TRACE(hold, "Doigt posé immobile"),
+    TOUCH_TRACE(back_forth, "Défilement aller-retour, deux périodes de 600 ms, amplitude 150 px"),
+};